@@ -778,20 +778,28 @@ image_init_result nes_cart_slot_device::call_load()
 
 void nes_cart_slot_device::call_unload()
 {
-	if (m_cart)
-	{
-		if (m_cart->get_battery_size() || m_cart->get_mapper_sram_size())
-		{
-			uint32_t tot_size = m_cart->get_battery_size() + m_cart->get_mapper_sram_size();
-			std::vector<uint8_t> temp_nvram(tot_size);
-			if (m_cart->get_battery_size())
-				memcpy(&temp_nvram[0], m_cart->get_battery_base(), m_cart->get_battery_size());
-			if (m_cart->get_mapper_sram_size())
-				memcpy(&temp_nvram[m_cart->get_battery_size()], m_cart->get_mapper_sram_base(), m_cart->get_mapper_sram_size());
-
-			battery_save(&temp_nvram[0], tot_size);
-		}
-	}
+	std::vector<uint8_t> temp_nvram;
+	if (battery_snapshot(temp_nvram))
+		battery_save(&temp_nvram[0], temp_nvram.size());
+}
+
+
+/*-------------------------------------------------
+ battery_snapshot
+ -------------------------------------------------*/
+
+bool nes_cart_slot_device::battery_snapshot(std::vector<uint8_t> &data)
+{
+	if (!m_cart || !(m_cart->get_battery_size() || m_cart->get_mapper_sram_size()))
+		return false;
+
+	// battery RAM first, then mapper SRAM, as on load
+	data.resize(m_cart->get_battery_size() + m_cart->get_mapper_sram_size());
+	if (m_cart->get_battery_size())
+		memcpy(&data[0], m_cart->get_battery_base(), m_cart->get_battery_size());
+	if (m_cart->get_mapper_sram_size())
+		memcpy(&data[m_cart->get_battery_size()], m_cart->get_mapper_sram_base(), m_cart->get_mapper_sram_size());
+	return true;
 }
 
 
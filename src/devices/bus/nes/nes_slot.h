@@ -401,6 +401,7 @@ public:
 	// image-level overrides
 	virtual image_init_result call_load() override;
 	virtual void call_unload() override;
+	virtual bool battery_snapshot(std::vector<u8> &data) override;
 
 	virtual bool is_reset_on_load() const noexcept override { return true; }
 	virtual const char *image_interface() const noexcept override { return "nes_cart"; }
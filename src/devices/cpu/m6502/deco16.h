@@ -21,6 +21,7 @@ public:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 
 	virtual void do_exec_full() override;
+	virtual void do_exec_whole() override;
 	virtual void do_exec_partial() override;
 
 protected:
@@ -30,7 +31,7 @@ protected:
 	virtual space_config_vector memory_space_config() const override;
 	virtual void device_start() override;
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _whole(); void o ## _partial()
 
 	O(brk_16_imp);
 	O(ill_non);
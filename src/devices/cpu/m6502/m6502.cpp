@@ -29,11 +29,22 @@ m6502_device::m6502_device(const machine_config &mconfig, device_type type, cons
 	cpu_device(mconfig, type, tag, owner, clock),
 	sync_w(*this),
 	program_config("program", ENDIANNESS_LITTLE, 8, 16),
-	sprogram_config("decrypted_opcodes", ENDIANNESS_LITTLE, 8, 16), PPC(0), NPC(0), PC(0), SP(0), TMP(0), TMP2(0), A(0), X(0), Y(0), P(0), IR(0), inst_state_base(0), mintf(nullptr),
-	inst_state(0), inst_substate(0), icount(0), nmi_state(false), irq_state(false), apu_irq_state(false), v_state(false), nmi_pending(false), irq_taken(false), sync(false), inhibit_interrupts(false), uses_custom_memory_interface(false)
+	sprogram_config("decrypted_opcodes", ENDIANNESS_LITTLE, 8, 16), PPC(0), NPC(0), PC(0), SP(0), TMP(0), TMP2(0), A(0), X(0), Y(0), P(0), IR(0), inst_state_base(0), mintf(nullptr), dintf(nullptr),
+	inst_state(0), inst_substate(0), icount(0), nmi_state(false), irq_state(false), apu_irq_state(false), v_state(false), nmi_pending(false), irq_taken(false), sync(false), inhibit_interrupts(false), uses_custom_memory_interface(false), has_sync_listener(false),
+	idle_watching(false), idle_head(0), idle_icount(0), idle_A(0), idle_X(0), idle_Y(0), idle_P(0), idle_SP(0)
 {
 }
 
+void m6502_device::add_idle_read_range(uint16_t start, uint16_t end, uint16_t mirror)
+{
+	if(idle_reads.empty())
+		idle_reads.resize(0x10000 / 32, 0);
+
+	for(uint32_t adr = 0; adr < 0x10000; adr++)
+		if((adr & ~mirror) >= start && (adr & ~mirror) <= end)
+			idle_reads[adr >> 5] |= 1U << (adr & 31);
+}
+
 void m6502_device::device_start()
 {
 	if(!uses_custom_memory_interface)
@@ -53,6 +64,12 @@ void m6502_device::init()
 			space(AS_PROGRAM).specific(mintf->program14);
 	}
 
+	dintf = mintf.get();
+	if(!idle_reads.empty())
+		idle_intf = std::make_unique<mi_idle>(*this);
+
+	// nothing listens to SYNC on most systems, so don't call out twice per instruction
+	has_sync_listener = !sync_w.isnull();
 	sync_w.resolve_safe();
 
 	XPC = 0;
@@ -128,7 +145,8 @@ void m6502_device::device_reset()
 	nmi_pending = false;
 	irq_taken = false;
 	sync = false;
-	sync_w(CLEAR_LINE);
+	if(has_sync_listener)
+		sync_w(CLEAR_LINE);
 	inhibit_interrupts = false;
 }
 
@@ -398,17 +416,100 @@ void m6502_device::execute_run()
 	if(inst_substate)
 		do_exec_partial();
 
+	// the debugger is either enabled for the whole session or not at all
+	if(machine().debug_flags & DEBUG_FLAG_ENABLED) {
+		while(icount > 0) {
+			if(inst_state < 0xff00) {
+				PPC = NPC;
+				inst_state = IR | inst_state_base;
+				debugger_instruction_hook(pc_to_external(NPC));
+			}
+			do_exec_full();
+		}
+		return;
+	}
+
+	if(idle_intf) {
+		execute_run_idle();
+		return;
+	}
+
+	// run whole instructions while they can't possibly run out of cycles
+	while(icount > WHOLE_INSTRUCTION_CYCLES) {
+		if(inst_state < 0xff00) {
+			PPC = NPC;
+			inst_state = IR | inst_state_base;
+		}
+		do_exec_whole();
+	}
+
 	while(icount > 0) {
 		if(inst_state < 0xff00) {
 			PPC = NPC;
 			inst_state = IR | inst_state_base;
-			if(machine().debug_flags & DEBUG_FLAG_ENABLED)
-				debugger_instruction_hook(pc_to_external(NPC));
 		}
 		do_exec_full();
 	}
 }
 
+void m6502_device::execute_run_idle()
+{
+	while(icount > 0) {
+		if(inst_state < 0xff00) {
+			idle_boundary();
+			PPC = NPC;
+			inst_state = IR | inst_state_base;
+		}
+		if(icount > WHOLE_INSTRUCTION_CYCLES)
+			do_exec_whole();
+		else
+			do_exec_full();
+	}
+
+	// the values read can change before the next timeslice starts
+	idle_reset();
+}
+
+void m6502_device::idle_reset()
+{
+	idle_watching = false;
+	dintf = mintf.get();
+}
+
+// Called between instructions.  A loop is idle when one pass through it,
+// from one backward branch to the next, performs no writes and no reads
+// outside the allowed ranges, and leaves every register as it found it.
+// Nothing the loop reads can change until the next scheduled event, which
+// is never inside a timeslice, so the passes that would run before the
+// timeslice ends can be skipped wholesale.
+void m6502_device::idle_boundary()
+{
+	if(NPC > PPC || PPC - NPC >= IDLE_LOOP_BYTES) {
+		if(idle_watching && (NPC < idle_head || NPC - idle_head >= IDLE_LOOP_BYTES))
+			idle_reset();
+		return;
+	}
+
+	if(idle_watching && NPC == idle_head && idle_intf->clean &&
+		A == idle_A && X == idle_X && Y == idle_Y && P == idle_P && SP == idle_SP) {
+		// leave the final pass to run normally
+		int const cycles = idle_icount - icount;
+		if(cycles > 0 && icount > cycles)
+			icount -= ((icount - 1) / cycles) * cycles;
+	}
+
+	idle_watching = true;
+	idle_head = NPC;
+	idle_icount = icount;
+	idle_A = A;
+	idle_X = X;
+	idle_Y = Y;
+	idle_P = P;
+	idle_SP = SP;
+	idle_intf->clean = true;
+	dintf = idle_intf.get();
+}
+
 void m6502_device::execute_set_input(int inputnum, int state)
 {
 	switch(inputnum) {
@@ -486,11 +587,13 @@ void m6502_device::state_string_export(const device_state_entry &entry, std::str
 void m6502_device::prefetch()
 {
 	sync = true;
-	sync_w(ASSERT_LINE);
+	if(has_sync_listener)
+		sync_w(ASSERT_LINE);
 	NPC = PC;
 	IR = mintf->read_sync(PC);
 	sync = false;
-	sync_w(CLEAR_LINE);
+	if(has_sync_listener)
+		sync_w(CLEAR_LINE);
 
 	if((nmi_pending || ((irq_state || apu_irq_state) && !(P & F_I))) && !inhibit_interrupts) {
 		irq_taken = true;
@@ -502,11 +605,13 @@ void m6502_device::prefetch()
 void m6502_device::prefetch_noirq()
 {
 	sync = true;
-	sync_w(ASSERT_LINE);
+	if(has_sync_listener)
+		sync_w(ASSERT_LINE);
 	NPC = PC;
 	IR = mintf->read_sync(PC);
 	sync = false;
-	sync_w(CLEAR_LINE);
+	if(has_sync_listener)
+		sync_w(CLEAR_LINE);
 	PC++;
 }
 
@@ -555,6 +660,41 @@ void m6502_device::mi_default::write(uint16_t adr, uint8_t val)
 	program.write_byte(adr, val);
 }
 
+uint8_t m6502_device::mi_idle::read(uint16_t adr)
+{
+	if(!cpu.idle_read_allowed(adr))
+		clean = false;
+	return cpu.mintf->read(adr);
+}
+
+uint8_t m6502_device::mi_idle::read_9(uint16_t adr)
+{
+	clean = false;
+	return cpu.mintf->read_9(adr);
+}
+
+uint8_t m6502_device::mi_idle::read_sync(uint16_t adr)
+{
+	return cpu.mintf->read_sync(adr);
+}
+
+uint8_t m6502_device::mi_idle::read_arg(uint16_t adr)
+{
+	return cpu.mintf->read_arg(adr);
+}
+
+void m6502_device::mi_idle::write(uint16_t adr, uint8_t val)
+{
+	clean = false;
+	cpu.mintf->write(adr, val);
+}
+
+void m6502_device::mi_idle::write_9(uint16_t adr, uint8_t val)
+{
+	clean = false;
+	cpu.mintf->write_9(adr, val);
+}
+
 uint8_t m6502_device::mi_default14::read(uint16_t adr)
 {
 	return program14.read_byte(adr);
@@ -597,15 +737,19 @@ void m6502_mcu_device::execute_run()
 	if(icount > 0 && inst_substate)
 		do_exec_partial();
 
+	bool const debug = machine().debug_flags & DEBUG_FLAG_ENABLED;
 	while(icount > 0) {
 		while(icount > bcount) {
 			if(inst_state < 0xff00) {
 				PPC = NPC;
 				inst_state = IR | inst_state_base;
-				if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+				if(debug)
 					debugger_instruction_hook(NPC);
 			}
-			do_exec_full();
+			if(!debug && icount > bcount + WHOLE_INSTRUCTION_CYCLES)
+				do_exec_whole();
+			else
+				do_exec_full();
 		}
 		if(icount > 0)
 			while(bcount && icount <= bcount)
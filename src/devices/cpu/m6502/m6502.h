@@ -47,6 +47,10 @@ public:
 		mintf = std::move(interface);
 	}
 
+	// idle loop skipping; reads in the range must have no side effects and
+	// must not change value except when a scheduled event fires
+	void add_idle_read_range(uint16_t start, uint16_t end, uint16_t mirror = 0);
+
 	bool get_sync() const { return sync; }
 
 	auto sync_cb() { return sync_w.bind(); }
@@ -72,10 +76,29 @@ protected:
 		virtual void write(uint16_t adr, uint8_t val) override;
 	};
 
+	// watches data accesses while a possible idle loop runs
+	class mi_idle : public memory_interface {
+	public:
+		mi_idle(m6502_device &cpu) : cpu(cpu), clean(true) {}
+		virtual ~mi_idle() = default;
+		virtual uint8_t read(uint16_t adr) override;
+		virtual uint8_t read_9(uint16_t adr) override;
+		virtual uint8_t read_sync(uint16_t adr) override;
+		virtual uint8_t read_arg(uint16_t adr) override;
+		virtual void write(uint16_t adr, uint8_t val) override;
+		virtual void write_9(uint16_t adr, uint8_t val) override;
+
+		m6502_device &cpu;
+		bool clean;
+	};
+
 	enum {
 		STATE_RESET = 0xff00
 	};
 
+	// longest loop body considered for idle skipping, in bytes
+	static constexpr int IDLE_LOOP_BYTES = 16;
+
 	enum {
 		F_N = 0x80,
 		F_V = 0x40,
@@ -129,16 +152,26 @@ protected:
 	int     inst_state_base;        /* Current instruction bank */
 
 	std::unique_ptr<memory_interface> mintf;
+	memory_interface *dintf;          /* data accesses; points at idle_intf while watching a loop */
 	int inst_state, inst_substate;
 	int icount, bcount, count_before_instruction_step;
 	bool nmi_state, irq_state, apu_irq_state, v_state;
 	bool nmi_pending, irq_taken, sync, inhibit_interrupts;
 	bool uses_custom_memory_interface;
-
-	uint8_t read(uint16_t adr) { return mintf->read(adr); }
-	uint8_t read_9(uint16_t adr) { return mintf->read_9(adr); }
-	void write(uint16_t adr, uint8_t val) { mintf->write(adr, val); }
-	void write_9(uint16_t adr, uint8_t val) { mintf->write_9(adr, val); }
+	bool has_sync_listener;
+
+	std::vector<uint32_t> idle_reads;       /* bitmap of addresses that are safe to read in an idle loop */
+	std::unique_ptr<mi_idle> idle_intf;
+	bool idle_watching;
+	uint16_t idle_head;                     /* start of the loop being watched */
+	int idle_icount;                        /* icount at the start of the pass */
+	uint8_t idle_A, idle_X, idle_Y, idle_P; /* registers at the start of the pass */
+	uint16_t idle_SP;
+
+	uint8_t read(uint16_t adr) { return dintf->read(adr); }
+	uint8_t read_9(uint16_t adr) { return dintf->read_9(adr); }
+	void write(uint16_t adr, uint8_t val) { dintf->write(adr, val); }
+	void write_9(uint16_t adr, uint8_t val) { dintf->write_9(adr, val); }
 	uint8_t read_arg(uint16_t adr) { return mintf->read_arg(adr); }
 	uint8_t read_pc() { return mintf->read_arg(PC++); }
 	uint8_t read_pc_noinc() { return mintf->read_arg(PC); }
@@ -146,11 +179,22 @@ protected:
 	void prefetch_noirq();
 	void set_nz(uint8_t v);
 
+	bool idle_read_allowed(uint16_t adr) const { return BIT(idle_reads[adr >> 5], adr & 31); }
+	void idle_boundary();
+	void idle_reset();
+	void execute_run_idle();
+
 	u32 XPC;
 	virtual offs_t pc_to_external(u16 pc); // For paged PCs
 	virtual void do_exec_full();
+	virtual void do_exec_whole();
 	virtual void do_exec_partial();
 
+	// longest bounded instruction of any variant, in bus cycles; with
+	// more than this left, do_exec_whole only checks icount before the
+	// prefetch, where the full variant would also stop if it hit zero
+	static constexpr int WHOLE_INSTRUCTION_CYCLES = 15;
+
 	// inline helpers
 	static inline bool page_changing(uint16_t base, int delta) { return ((base + delta) ^ base) & 0xff00; }
 	static inline uint16_t set_l(uint16_t base, uint8_t val) { return (base & 0xff00) | val; }
@@ -177,7 +221,7 @@ protected:
 	uint8_t do_rol(uint8_t v);
 	uint8_t do_asr(uint8_t v);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _whole(); void o ## _partial()
 
 	// NMOS 6502 opcodes
 	//   documented opcodes
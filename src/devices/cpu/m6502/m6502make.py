@@ -82,6 +82,33 @@ FULL_NONE="""\
 %(ins)s
 """
 
+WHOLE_PROLOG="""\
+void %(device)s_device::%(opcode)s_whole()
+{
+"""
+
+WHOLE_EPILOG="""\
+}
+"""
+
+WHOLE_MEMORY="""\
+%(ins)s
+\ticount--;
+"""
+
+# icount can only reach zero here if something outside the cpu took
+# cycles from it; the prefetch and its interrupt sampling then wait for
+# the next timeslice, exactly as the full variant's check would do
+WHOLE_PREFETCH="""\
+\tif(icount == 0) { inst_substate = %(substate)s; return; }
+%(ins)s
+\ticount--;
+"""
+
+WHOLE_UNBOUNDED="""\
+\t%(opcode)s_full();
+"""
+
 PARTIAL_PROLOG="""\
 void %(device)s_device::%(opcode)s_partial()
 {
@@ -114,12 +141,35 @@ PARTIAL_NONE="""\
 """
 def identify_line_type(ins):
     if "eat-all-cycles" in ins: return "EAT"
+    for s in ["prefetch(", "prefetch_noirq("]:
+        if s in ins:
+            return "PREFETCH"
     for s in ["read", "write", "prefetch(", "prefetch_noirq("]:
         if s in ins:
             return "MEMORY"
     return "NONE"
 
 
+def is_unbounded(instructions):
+    """Check whether an instruction can take an unknown number of cycles"""
+    for ins in instructions:
+        if identify_line_type(ins) == "EAT":
+            return True
+        ins = ins.strip()
+        for s in ["for(", "for (", "while(", "while (", "do {"]:
+            if ins.startswith(s):
+                return True
+    return False
+
+
+def instruction_cycles(instructions):
+    """Count the most bus cycles a bounded instruction can take"""
+    if is_unbounded(instructions):
+        return 0
+    types = [identify_line_type(ins) for ins in instructions]
+    return types.count("MEMORY") + types.count("PREFETCH")
+
+
 def save_opcodes(f, device, opcodes):
     for name, instructions in opcodes:
         d = { "device": device,
@@ -135,13 +185,34 @@ def save_opcodes(f, device, opcodes):
             if line_type == "EAT":
                 emit(f, FULL_EAT_ALL % d)
                 substate += 1
-            elif line_type == "MEMORY":
+            elif line_type == "MEMORY" or line_type == "PREFETCH":
                 emit(f, FULL_MEMORY % d)
                 substate += 1
             else:
                 emit(f, FULL_NONE %d)
         emit(f, FULL_EPILOG % d)
 
+        # whole variant, only run when icount covers the longest
+        # instruction so it never has to stop part way through
+        emit(f, WHOLE_PROLOG % d)
+        if is_unbounded(instructions):
+            emit(f, WHOLE_UNBOUNDED % d)
+        else:
+            substate = 1
+            for ins in instructions:
+                d["substate"] = str(substate)
+                d["ins"] =  ins
+                line_type = identify_line_type(ins)
+                if line_type == "MEMORY":
+                    emit(f, WHOLE_MEMORY % d)
+                    substate += 1
+                elif line_type == "PREFETCH":
+                    emit(f, WHOLE_PREFETCH % d)
+                    substate += 1
+                else:
+                    emit(f, FULL_NONE %d)
+        emit(f, WHOLE_EPILOG % d)
+
         emit(f, PARTIAL_PROLOG % d)
         substate = 1
         for ins in instructions:
@@ -151,7 +222,7 @@ def save_opcodes(f, device, opcodes):
             if line_type == "EAT":
                 emit(f, PARTIAL_EAT_ALL % d)
                 substate += 1
-            elif line_type == "MEMORY":
+            elif line_type == "MEMORY" or line_type == "PREFETCH":
                 emit(f, PARTIAL_MEMORY % d)
                 substate += 1
             else:
@@ -170,6 +241,18 @@ DO_EXEC_FULL_EPILOG="""\
 }
 """
 
+DO_EXEC_WHOLE_PROLOG="""\
+void %(device)s_device::do_exec_whole()
+{
+\tstatic_assert(WHOLE_INSTRUCTION_CYCLES >= %(cycles)d, "instruction longer than WHOLE_INSTRUCTION_CYCLES");
+\tswitch(inst_state) {
+"""
+
+DO_EXEC_WHOLE_EPILOG="""\
+\t}
+}
+"""
+
 DO_EXEC_PARTIAL_PROLOG="""\
 void %(device)s_device::do_exec_partial()
 {
@@ -189,13 +272,14 @@ DISASM_EPILOG="""\
 };
 """
 
-def save_tables(f, device, states):
+def save_tables(f, device, opcodes, states):
     total_states = len(states)
 
     d = { "device": device,
-          "disasm_count": total_states-1
+          "disasm_count": total_states-1,
+          "cycles": max([instruction_cycles(instructions) for name, instructions in opcodes] + [0])
           }
-    
+
     emit(f, DO_EXEC_FULL_PROLOG % d)
     for n, state in enumerate(states):
         if state == ".": continue
@@ -205,6 +289,15 @@ def save_tables(f, device, states):
             emit(f, "\tcase %s: %s_full(); break;" % ("STATE_RESET", state))
     emit(f, DO_EXEC_FULL_EPILOG % d)
 
+    emit(f, DO_EXEC_WHOLE_PROLOG % d)
+    for n, state in enumerate(states):
+        if state == ".": continue
+        if n < total_states - 1:
+            emit(f, "\tcase 0x%02x: %s_whole(); break;" % (n, state))
+        else:
+            emit(f, "\tcase %s: %s_whole(); break;" % ("STATE_RESET", state))
+    emit(f, DO_EXEC_WHOLE_EPILOG % d)
+
     emit(f, DO_EXEC_PARTIAL_PROLOG % d)
     for n, state in enumerate(states):
         if state == ".": continue
@@ -248,7 +341,7 @@ def saves(fname, device, opcodes, states):
         sys.exit(1)
     save_opcodes(f, device, opcodes)
     emit(f, "\n")
-    save_tables(f, device, states)
+    save_tables(f, device, opcodes, states)
     f.close()
 
 
@@ -42,18 +42,19 @@ protected:
 
 	virtual void state_string_export(const device_state_entry &entry, std::string &str) const override;
 
-	virtual void read_dummy(uint16_t adr) { (void)mintf->read(adr); }
-	virtual uint8_t read_data(uint16_t adr) { return mintf->read(adr); }
-	virtual void write_data(uint16_t adr, uint8_t val) { mintf->write(adr, val); }
+	virtual void read_dummy(uint16_t adr) { (void)dintf->read(adr); }
+	virtual uint8_t read_data(uint16_t adr) { return dintf->read(adr); }
+	virtual void write_data(uint16_t adr, uint8_t val) { dintf->write(adr, val); }
 
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 	virtual void do_exec_full() override;
+	virtual void do_exec_whole() override;
 	virtual void do_exec_partial() override;
 	virtual void execute_set_input(int inputnum, int state) override;
 
 	m740_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _whole(); void o ## _partial()
 
 	virtual u32 get_state_base() const override;
 
@@ -28,6 +28,7 @@ protected:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 
 	virtual void do_exec_full() override;
+	virtual void do_exec_whole() override;
 	virtual void do_exec_partial() override;
 
 	virtual u16 get_irq_vector();
@@ -43,7 +44,7 @@ private:
 	void do_add(u8 v);
 	u16 do_accumulate(u16 v, u16 w);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _whole(); void o ## _partial()
 
 	O(adc_ipx);
 	O(add_imm);
@@ -13,6 +13,7 @@
 #include "rspdiv.h"
 
 #include "rsp_dasm.h"
+#include "rspvec.h"
 
 DEFINE_DEVICE_TYPE(RSP, rsp_device, "rsp", "Nintendo & SGI Reality Signal Processor RSP")
 
@@ -21,12 +22,13 @@ DEFINE_DEVICE_TYPE(RSP, rsp_device, "rsp", "Nintendo & SGI Reality Signal Proces
 #define SAVE_DISASM                     0
 #define SAVE_DMEM                       0
 #define RSP_TEST_SYNC                   0
+#define RSP_VERIFY_SIMD                 0
 
 #define PRINT_VECREG(x)     osd_printf_debug("V%d: %04X|%04X|%04X|%04X|%04X|%04X|%04X|%04X\n", x, \
 							m_v[x].w[0], m_v[x].w[1], m_v[x].w[2], m_v[x].w[3], \
 							m_v[x].w[4], m_v[x].w[5], m_v[x].w[6], m_v[x].w[7])
 
-#define PRINT_ACCUM(x)     osd_printf_debug("A%d: %08X|%08X\n", x, (uint32_t)(m_accum[x].q >> 32), (uint32_t)m_accum[x].q);
+#define PRINT_ACCUM(x)     osd_printf_debug("A%d: %04X|%04X|%04X|%04X\n", x, m_accum[SLICE_H].w[x], m_accum[SLICE_M].w[x], m_accum[SLICE_L].w[x], m_accum[SLICE_LL].w[x]);
 
 
 #define SIMM16      ((int32_t)(int16_t)(op))
@@ -296,9 +298,13 @@ void rsp_device::device_start()
 
 	for(auto & elem : m_accum)
 	{
-		elem.q = 0;
+		elem.d[0] = 0;
+		elem.d[1] = 0;
 	}
 
+	if (RSP_VERIFY_SIMD)
+		verify_vector_ops_simd();
+
 	m_pc = 0;
 	m_nextpc = 0xffff;
 	m_sr = RSP_STATUS_HALT;
@@ -538,15 +544,15 @@ void rsp_device::device_reset()
 
 uint16_t rsp_device::SATURATE_ACCUM(int accum, int slice, uint16_t negative, uint16_t positive)
 {
-	if ((int16_t)m_accum[accum].w[SLICE_H] < 0)
+	if ((int16_t)m_accum[SLICE_H].w[accum] < 0)
 	{
-		if ((uint16_t)m_accum[accum].w[SLICE_H] != 0xffff)
+		if ((uint16_t)m_accum[SLICE_H].w[accum] != 0xffff)
 		{
 			return negative;
 		}
 		else
 		{
-			if ((int16_t)m_accum[accum].w[SLICE_M] >= 0)
+			if ((int16_t)m_accum[SLICE_M].w[accum] >= 0)
 			{
 				return negative;
 			}
@@ -554,24 +560,24 @@ uint16_t rsp_device::SATURATE_ACCUM(int accum, int slice, uint16_t negative, uin
 			{
 				if (slice == 0)
 				{
-					return m_accum[accum].w[SLICE_L];
+					return m_accum[SLICE_L].w[accum];
 				}
 				else if (slice == 1)
 				{
-					return m_accum[accum].w[SLICE_M];
+					return m_accum[SLICE_M].w[accum];
 				}
 			}
 		}
 	}
 	else
 	{
-		if ((uint16_t)m_accum[accum].w[SLICE_H] != 0)
+		if ((uint16_t)m_accum[SLICE_H].w[accum] != 0)
 		{
 			return positive;
 		}
 		else
 		{
-			if ((int16_t)m_accum[accum].w[SLICE_M] < 0)
+			if ((int16_t)m_accum[SLICE_M].w[accum] < 0)
 			{
 				return positive;
 			}
@@ -579,11 +585,11 @@ uint16_t rsp_device::SATURATE_ACCUM(int accum, int slice, uint16_t negative, uin
 			{
 				if (slice == 0)
 				{
-					return m_accum[accum].w[SLICE_L];
+					return m_accum[SLICE_L].w[accum];
 				}
 				else
 				{
-					return m_accum[accum].w[SLICE_M];
+					return m_accum[SLICE_M].w[accum];
 				}
 			}
 		}
@@ -620,19 +626,19 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				if (s1 == -32768 && s2 == -32768)
 				{
 					// overflow
-					m_accum[i].w[SLICE_H] = 0;
-					m_accum[i].w[SLICE_M] = -32768;
-					m_accum[i].w[SLICE_L] = -32768;
+					m_accum[SLICE_H].w[i] = 0;
+					m_accum[SLICE_M].w[i] = -32768;
+					m_accum[SLICE_L].w[i] = -32768;
 					vres[i] = 0x7fff;
 				}
 				else
 				{
 					int64_t r =  s1 * s2 * 2;
 					r += 0x8000;    // rounding ?
-					m_accum[i].w[SLICE_H] = (r < 0) ? 0xffff : 0; // Sign-extend to 48-bit
-					m_accum[i].w[SLICE_M] = (int16_t)(r >> 16);
-					m_accum[i].w[SLICE_L] = (uint16_t)r;
-					vres[i] = m_accum[i].w[SLICE_M];
+					m_accum[SLICE_H].w[i] = (r < 0) ? 0xffff : 0; // Sign-extend to 48-bit
+					m_accum[SLICE_M].w[i] = (int16_t)(r >> 16);
+					m_accum[SLICE_L].w[i] = (uint16_t)r;
+					vres[i] = m_accum[SLICE_M].w[i];
 				}
 			}
 			WRITEBACK_RESULT();
@@ -652,24 +658,24 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s1 = m_v[VS1REG].s[i];
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 
-				int64_t r = s1 * s2 * 2;
+				int64_t r = int64_t(s1 * s2) * 2;
 				r += 0x8000;    // rounding ?
 
-				m_accum[i].w[SLICE_H] = (uint16_t)(r >> 32);
-				m_accum[i].w[SLICE_M] = (uint16_t)(r >> 16);
-				m_accum[i].w[SLICE_L] = (uint16_t)r;
+				m_accum[SLICE_H].w[i] = (uint16_t)(r >> 32);
+				m_accum[SLICE_M].w[i] = (uint16_t)(r >> 16);
+				m_accum[SLICE_L].w[i] = (uint16_t)r;
 
 				if (r < 0)
 				{
 					vres[i] = 0;
 				}
-				else if (((int16_t)m_accum[i].w[SLICE_H] ^ (int16_t)m_accum[i].w[SLICE_M]) < 0)
+				else if (((int16_t)m_accum[SLICE_H].w[i] ^ (int16_t)m_accum[SLICE_M].w[i]) < 0)
 				{
 					vres[i] = -1;
 				}
 				else
 				{
-					vres[i] = m_accum[i].w[SLICE_M];
+					vres[i] = m_accum[SLICE_M].w[i];
 				}
 			}
 			WRITEBACK_RESULT();
@@ -693,11 +699,11 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				uint32_t s2 = m_v[VS2REG].w[VEC_EL_2(EL, i)];
 				uint32_t r = s1 * s2;
 
-				m_accum[i].w[SLICE_H] = 0;
-				m_accum[i].w[SLICE_M] = 0;
-				m_accum[i].w[SLICE_L] = (uint16_t)(r >> 16);
+				m_accum[SLICE_H].w[i] = 0;
+				m_accum[SLICE_M].w[i] = 0;
+				m_accum[SLICE_L].w[i] = (uint16_t)(r >> 16);
 
-				vres[i] = m_accum[i].w[SLICE_L];
+				vres[i] = m_accum[SLICE_L].w[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -720,11 +726,11 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s2 = m_v[VS2REG].w[VEC_EL_2(EL, i)];   // not sign-extended
 				int32_t r =  s1 * s2;
 
-				m_accum[i].w[SLICE_H] = (r < 0) ? 0xffff : 0;      // sign-extend to 48-bit
-				m_accum[i].w[SLICE_M] = (int16_t)(r >> 16);
-				m_accum[i].w[SLICE_L] = (uint16_t)r;
+				m_accum[SLICE_H].w[i] = (r < 0) ? 0xffff : 0;      // sign-extend to 48-bit
+				m_accum[SLICE_M].w[i] = (int16_t)(r >> 16);
+				m_accum[SLICE_L].w[i] = (uint16_t)r;
 
-				vres[i] = m_accum[i].w[SLICE_M];
+				vres[i] = m_accum[SLICE_M].w[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -747,11 +753,11 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 				int32_t r = s1 * s2;
 
-				m_accum[i].w[SLICE_H] = (r < 0) ? 0xffff : 0;      // sign-extend to 48-bit
-				m_accum[i].w[SLICE_M] = (int16_t)(r >> 16);
-				m_accum[i].w[SLICE_L] = (uint16_t)(r);
+				m_accum[SLICE_H].w[i] = (r < 0) ? 0xffff : 0;      // sign-extend to 48-bit
+				m_accum[SLICE_M].w[i] = (int16_t)(r >> 16);
+				m_accum[SLICE_L].w[i] = (uint16_t)(r);
 
-				vres[i] = m_accum[i].w[SLICE_L];
+				vres[i] = m_accum[SLICE_L].w[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -774,9 +780,9 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 				int32_t r = s1 * s2;
 
-				m_accum[i].w[SLICE_H] = (int16_t)(r >> 16);
-				m_accum[i].w[SLICE_M] = (uint16_t)(r);
-				m_accum[i].w[SLICE_L] = 0;
+				m_accum[SLICE_H].w[i] = (int16_t)(r >> 16);
+				m_accum[SLICE_M].w[i] = (uint16_t)(r);
+				m_accum[SLICE_L].w[i] = 0;
 
 				if (r < -32768) r = -32768;
 				if (r >  32767) r = 32767;
@@ -802,17 +808,17 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 				int32_t r = s1 * s2;
 
-				uint64_t q = (uint64_t)(uint16_t)m_accum[i].w[SLICE_LL];
-				q |= (((uint64_t)(uint16_t)m_accum[i].w[SLICE_L]) << 16);
-				q |= (((uint64_t)(uint16_t)m_accum[i].w[SLICE_M]) << 32);
-				q |= (((uint64_t)(uint16_t)m_accum[i].w[SLICE_H]) << 48);
+				uint64_t q = (uint64_t)(uint16_t)m_accum[SLICE_LL].w[i];
+				q |= (((uint64_t)(uint16_t)m_accum[SLICE_L].w[i]) << 16);
+				q |= (((uint64_t)(uint16_t)m_accum[SLICE_M].w[i]) << 32);
+				q |= (((uint64_t)(uint16_t)m_accum[SLICE_H].w[i]) << 48);
 
 				q += (int64_t)(r) << 17;
 
-				m_accum[i].w[SLICE_LL] = (uint16_t)q;
-				m_accum[i].w[SLICE_L] = (uint16_t)(q >> 16);
-				m_accum[i].w[SLICE_M] = (uint16_t)(q >> 32);
-				m_accum[i].w[SLICE_H] = (uint16_t)(q >> 48);
+				m_accum[SLICE_LL].w[i] = (uint16_t)q;
+				m_accum[SLICE_L].w[i] = (uint16_t)(q >> 16);
+				m_accum[SLICE_M].w[i] = (uint16_t)(q >> 32);
+				m_accum[SLICE_H].w[i] = (uint16_t)(q >> 48);
 
 				vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
 			}
@@ -833,32 +839,32 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s1 = m_v[VS1REG].s[i];
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 				int32_t r1 = s1 * s2;
-				uint32_t r2 = m_accum[i].w[SLICE_L] + ((uint16_t)r1 * 2);
-				uint32_t r3 = m_accum[i].w[SLICE_M] + (uint16_t)((r1 >> 16) * 2) + (uint16_t)(r2 >> 16);
+				uint32_t r2 = m_accum[SLICE_L].w[i] + ((uint16_t)r1 * 2);
+				uint32_t r3 = m_accum[SLICE_M].w[i] + (uint16_t)((r1 >> 16) * 2) + (uint16_t)(r2 >> 16);
 
-				m_accum[i].w[SLICE_L] = (uint16_t)r2;
-				m_accum[i].w[SLICE_M] = (uint16_t)r3;
-				m_accum[i].w[SLICE_H] += (uint16_t)(r3 >> 16) + (uint16_t)(r1 >> 31);
+				m_accum[SLICE_L].w[i] = (uint16_t)r2;
+				m_accum[SLICE_M].w[i] = (uint16_t)r3;
+				m_accum[SLICE_H].w[i] += (uint16_t)(r3 >> 16) + (uint16_t)(r1 >> 31);
 
-				if ((int16_t)m_accum[i].w[SLICE_H] < 0)
+				if ((int16_t)m_accum[SLICE_H].w[i] < 0)
 				{
 					vres[i] = 0;
 				}
 				else
 				{
-					if (m_accum[i].w[SLICE_H] != 0)
+					if (m_accum[SLICE_H].w[i] != 0)
 					{
 						vres[i] = 0xffff;
 					}
 					else
 					{
-						if ((int16_t)m_accum[i].w[SLICE_M] < 0)
+						if ((int16_t)m_accum[SLICE_M].w[i] < 0)
 						{
 							vres[i] = 0xffff;
 						}
 						else
 						{
-							vres[i] = m_accum[i].w[SLICE_M];
+							vres[i] = m_accum[SLICE_M].w[i];
 						}
 					}
 				}
@@ -883,12 +889,12 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				uint32_t s1 = m_v[VS1REG].w[i];
 				uint32_t s2 = m_v[VS2REG].w[VEC_EL_2(EL, i)];
 				uint32_t r1 = s1 * s2;
-				uint32_t r2 = m_accum[i].w[SLICE_L] + (r1 >> 16);
-				uint32_t r3 = m_accum[i].w[SLICE_M] + (r2 >> 16);
+				uint32_t r2 = m_accum[SLICE_L].w[i] + (r1 >> 16);
+				uint32_t r3 = m_accum[SLICE_M].w[i] + (r2 >> 16);
 
-				m_accum[i].w[SLICE_L] = (uint16_t)r2;
-				m_accum[i].w[SLICE_M] = (uint16_t)r3;
-				m_accum[i].w[SLICE_H] += (int16_t)(r3 >> 16);
+				m_accum[SLICE_L].w[i] = (uint16_t)r2;
+				m_accum[SLICE_M].w[i] = (uint16_t)r3;
+				m_accum[SLICE_H].w[i] += (int16_t)(r3 >> 16);
 
 				vres[i] = SATURATE_ACCUM(i, 0, 0x0000, 0xffff);
 			}
@@ -912,14 +918,14 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				uint32_t s1 = m_v[VS1REG].s[i];
 				uint32_t s2 = m_v[VS2REG].w[VEC_EL_2(EL, i)];   // not sign-extended
 				uint32_t r1 = s1 * s2;
-				uint32_t r2 = (uint16_t)m_accum[i].w[SLICE_L] + (uint16_t)(r1);
-				uint32_t r3 = (uint16_t)m_accum[i].w[SLICE_M] + (r1 >> 16) + (r2 >> 16);
+				uint32_t r2 = (uint16_t)m_accum[SLICE_L].w[i] + (uint16_t)(r1);
+				uint32_t r3 = (uint16_t)m_accum[SLICE_M].w[i] + (r1 >> 16) + (r2 >> 16);
 
-				m_accum[i].w[SLICE_L] = (uint16_t)r2;
-				m_accum[i].w[SLICE_M] = (uint16_t)r3;
-				m_accum[i].w[SLICE_H] += (uint16_t)(r3 >> 16);
+				m_accum[SLICE_L].w[i] = (uint16_t)r2;
+				m_accum[SLICE_M].w[i] = (uint16_t)r3;
+				m_accum[SLICE_H].w[i] += (uint16_t)(r3 >> 16);
 				if ((int32_t)r1 < 0)
-					m_accum[i].w[SLICE_H] -= 1;
+					m_accum[SLICE_H].w[i] -= 1;
 
 				vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
 			}
@@ -943,16 +949,16 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s1 = m_v[VS1REG].w[i];     // not sign-extended
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 
-				uint64_t q = (uint64_t)m_accum[i].w[SLICE_LL];
-				q |= (((uint64_t)m_accum[i].w[SLICE_L]) << 16);
-				q |= (((uint64_t)m_accum[i].w[SLICE_M]) << 32);
-				q |= (((uint64_t)m_accum[i].w[SLICE_H]) << 48);
+				uint64_t q = (uint64_t)m_accum[SLICE_LL].w[i];
+				q |= (((uint64_t)m_accum[SLICE_L].w[i]) << 16);
+				q |= (((uint64_t)m_accum[SLICE_M].w[i]) << 32);
+				q |= (((uint64_t)m_accum[SLICE_H].w[i]) << 48);
 				q += (int64_t)(s1*s2) << 16;
 
-				m_accum[i].w[SLICE_LL] = (uint16_t)q;
-				m_accum[i].w[SLICE_L] = (uint16_t)(q >> 16);
-				m_accum[i].w[SLICE_M] = (uint16_t)(q >> 32);
-				m_accum[i].w[SLICE_H] = (uint16_t)(q >> 48);
+				m_accum[SLICE_LL].w[i] = (uint16_t)q;
+				m_accum[SLICE_L].w[i] = (uint16_t)(q >> 16);
+				m_accum[SLICE_M].w[i] = (uint16_t)(q >> 32);
+				m_accum[SLICE_H].w[i] = (uint16_t)(q >> 48);
 
 				vres[i] = SATURATE_ACCUM(i, 0, 0x0000, 0xffff);
 			}
@@ -977,12 +983,12 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s1 = m_v[VS1REG].s[i];
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 
-				int32_t accum = (uint32_t)(uint16_t)m_accum[i].w[SLICE_M];
-				accum |= ((uint32_t)((uint16_t)m_accum[i].w[SLICE_H])) << 16;
+				int32_t accum = (uint32_t)(uint16_t)m_accum[SLICE_M].w[i];
+				accum |= ((uint32_t)((uint16_t)m_accum[SLICE_H].w[i])) << 16;
 				accum += s1 * s2;
 
-				m_accum[i].w[SLICE_H] = (uint16_t)(accum >> 16);
-				m_accum[i].w[SLICE_M] = (uint16_t)accum;
+				m_accum[SLICE_H].w[i] = (uint16_t)(accum >> 16);
+				m_accum[SLICE_M].w[i] = (uint16_t)accum;
 
 				vres[i] = SATURATE_ACCUM(i, 1, 0x8000, 0x7fff);
 			}
@@ -1007,7 +1013,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 				int32_t r = s1 + s2 + BIT(m_vcarry, i);
 
-				m_accum[i].w[SLICE_L] = (int16_t)r;
+				m_accum[SLICE_L].w[i] = (int16_t)r;
 
 				if (r > 32767) r = 32767;
 				if (r < -32768) r = -32768;
@@ -1036,7 +1042,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t s2 = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 				int32_t r = s1 - s2 - BIT(m_vcarry, i);
 
-				m_accum[i].w[SLICE_L] = (int16_t)r;
+				m_accum[SLICE_L].w[i] = (int16_t)r;
 
 				if (r > 32767) r = 32767;
 				if (r < -32768) r = -32768;
@@ -1084,7 +1090,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					vres[i] = 0;
 				}
 
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1111,7 +1117,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t r = s1 + s2;
 
 				vres[i] = (int16_t)r;
-				m_accum[i].w[SLICE_L] = (int16_t)r;
+				m_accum[SLICE_L].w[i] = (int16_t)r;
 
 				if (r & 0xffff0000)
 				{
@@ -1143,7 +1149,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				int32_t r = s1 - s2;
 
 				vres[i] = (int16_t)(r);
-				m_accum[i].w[SLICE_L] = (uint16_t)r;
+				m_accum[SLICE_L].w[i] = (uint16_t)r;
 
 				if ((uint16_t)r != 0)
 				{
@@ -1173,7 +1179,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				{
 					for (int i = 0; i < 8; i++)
 					{
-						m_v[VDREG].w[i] = m_accum[i].w[SLICE_H];
+						m_v[VDREG].w[i] = m_accum[SLICE_H].w[i];
 					}
 					break;
 				}
@@ -1181,7 +1187,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				{
 					for (int i = 0; i < 8; i++)
 					{
-						m_v[VDREG].w[i] = m_accum[i].w[SLICE_M];
+						m_v[VDREG].w[i] = m_accum[SLICE_M].w[i];
 					}
 					break;
 				}
@@ -1189,7 +1195,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				{
 					for (int i = 0; i < 8; i++)
 					{
-						m_v[VDREG].w[i] = m_accum[i].w[SLICE_L];
+						m_v[VDREG].w[i] = m_accum[SLICE_L].w[i];
 					}
 					break;
 				}
@@ -1238,7 +1244,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					vres[i] = s2;
 				}
 
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 
 			m_vzero = 0;
@@ -1274,7 +1280,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				{
 					vres[i] = s2;
 				}
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 
 			m_vzero = 0;
@@ -1311,7 +1317,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					vres[i] = s2;
 				}
 
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 
 			m_vzero = 0;
@@ -1348,7 +1354,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					vres[i] = s2;
 				}
 
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 
 			m_vzero = 0;
@@ -1377,11 +1383,11 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					{
 						if (BIT(m_vcompare, i)) // vcc_lo
 						{
-							m_accum[i].w[SLICE_L] = -(uint16_t)s2;
+							m_accum[SLICE_L].w[i] = -(uint16_t)s2;
 						}
 						else
 						{
-							m_accum[i].w[SLICE_L] = s1;
+							m_accum[SLICE_L].w[i] = s1;
 						}
 					}
 					else
@@ -1390,12 +1396,12 @@ void rsp_device::handle_vector_ops(uint32_t op)
 						{
 							if (((uint32_t)(uint16_t)(s1) + (uint32_t)(uint16_t)(s2)) > 0x10000)
 							{
-								m_accum[i].w[SLICE_L] = s1;
+								m_accum[SLICE_L].w[i] = s1;
 								m_vcompare &= ~(1 << i);
 							}
 							else
 							{
-								m_accum[i].w[SLICE_L] = -(uint16_t)s2;
+								m_accum[SLICE_L].w[i] = -(uint16_t)s2;
 								m_vcompare |= 1 << i;
 							}
 						}
@@ -1403,12 +1409,12 @@ void rsp_device::handle_vector_ops(uint32_t op)
 						{
 							if (((uint32_t)(uint16_t)(s1) + (uint32_t)(uint16_t)(s2)) != 0)
 							{
-								m_accum[i].w[SLICE_L] = s1;
+								m_accum[SLICE_L].w[i] = s1;
 								m_vcompare &= ~(1 << i);
 							}
 							else
 							{
-								m_accum[i].w[SLICE_L] = -(uint16_t)s2;
+								m_accum[SLICE_L].w[i] = -(uint16_t)s2;
 								m_vcompare |= 1 << i;
 							}
 						}
@@ -1420,29 +1426,29 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					{
 						if (BIT(m_vclip2, i)) // vcc_hi
 						{
-							m_accum[i].w[SLICE_L] = s2;
+							m_accum[SLICE_L].w[i] = s2;
 						}
 						else
 						{
-							m_accum[i].w[SLICE_L] = s1;
+							m_accum[SLICE_L].w[i] = s1;
 						}
 					}
 					else
 					{
 						if (((int32_t)(uint16_t)s1 - (int32_t)(uint16_t)s2) >= 0)
 						{
-							m_accum[i].w[SLICE_L] = s2;
+							m_accum[SLICE_L].w[i] = s2;
 							m_vclip2 |= 1 << i;
 						}
 						else
 						{
-							m_accum[i].w[SLICE_L] = s1;
+							m_accum[SLICE_L].w[i] = s1;
 							m_vclip2 &= ~(1 << i);
 						}
 					}
 				}
 
-				vres[i] = m_accum[i].w[SLICE_L];
+				vres[i] = m_accum[SLICE_L].w[i];
 			}
 
 			m_vzero = 0;
@@ -1531,7 +1537,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					m_vclip1 |= 1 << i;
 				}
 
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1565,12 +1571,12 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					}
 					if ((s1 + s2) <= 0)
 					{
-						m_accum[i].w[SLICE_L] = ~(uint16_t)s2;
+						m_accum[SLICE_L].w[i] = ~(uint16_t)s2;
 						m_vcompare |= 1 << i;
 					}
 					else
 					{
-						m_accum[i].w[SLICE_L] = s1;
+						m_accum[SLICE_L].w[i] = s1;
 					}
 				}
 				else
@@ -1581,16 +1587,16 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					}
 					if ((s1 - s2) >= 0)
 					{
-						m_accum[i].w[SLICE_L] = s2;
+						m_accum[SLICE_L].w[i] = s2;
 						m_vclip2 |= 1 << i;
 					}
 					else
 					{
-						m_accum[i].w[SLICE_L] = s1;
+						m_accum[SLICE_L].w[i] = s1;
 					}
 				}
 
-				vres[i] = m_accum[i].w[SLICE_L];
+				vres[i] = m_accum[SLICE_L].w[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1616,7 +1622,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 					vres[i] = m_v[VS2REG].s[VEC_EL_2(EL, i)];
 				}
 
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1634,7 +1640,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 			for (int i = 0; i < 8; i++)
 			{
 				vres[i] = m_v[VS1REG].w[i] & m_v[VS2REG].w[VEC_EL_2(EL, i)];
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1652,7 +1658,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 			for (int i = 0; i < 8; i++)
 			{
 				vres[i] = ~(m_v[VS1REG].w[i] & m_v[VS2REG].w[VEC_EL_2(EL, i)]);
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1670,7 +1676,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 			for (int i = 0; i < 8; i++)
 			{
 				vres[i] = m_v[VS1REG].w[i] | m_v[VS2REG].w[VEC_EL_2(EL, i)];
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1688,7 +1694,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 			for (int i = 0; i < 8; i++)
 			{
 				vres[i] = ~(m_v[VS1REG].w[i] | m_v[VS2REG].w[VEC_EL_2(EL, i)]);
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1706,7 +1712,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 			for (int i = 0; i < 8; i++)
 			{
 				vres[i] = m_v[VS1REG].w[i] ^ m_v[VS2REG].w[VEC_EL_2(EL, i)];
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1724,7 +1730,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 			for (int i = 0; i < 8; i++)
 			{
 				vres[i] = ~(m_v[VS1REG].w[i] ^ m_v[VS2REG].w[VEC_EL_2(EL, i)]);
-				m_accum[i].w[SLICE_L] = vres[i];
+				m_accum[SLICE_L].w[i] = vres[i];
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1747,7 +1753,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				vres[i] = 0;
 				uint16_t e1 = m_v[VS1REG].w[i];
 				uint16_t e2 = m_v[VS2REG].w[VEC_EL_2(EL, i)];
-				m_accum[i].w[SLICE_L] = e1 + e2;
+				m_accum[SLICE_L].w[i] = e1 + e2;
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -1806,7 +1812,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 
 			for (int i = 0; i < 8; i++)
 			{
-				m_accum[i].w[SLICE_L] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
+				m_accum[SLICE_L].w[i] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
 			}
 			break;
 		}
@@ -1881,7 +1887,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 
 			for (int i = 0; i < 8; i++)
 			{
-				m_accum[i].w[SLICE_L] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
+				m_accum[SLICE_L].w[i] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
 			}
 			break;
 		}
@@ -1900,7 +1906,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 
 			for (int i = 0; i < 8; i++)
 			{
-				m_accum[i].w[SLICE_L] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
+				m_accum[SLICE_L].w[i] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
 			}
 
 			m_v[VDREG].s[VS1REG & 7] = (int16_t)(m_reciprocal_res >> 16);
@@ -1919,7 +1925,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 			m_v[VDREG].w[VS1REG & 7] = m_v[VS2REG].w[VEC_EL_2(EL, VS1REG & 7)];
 			for (int i = 0; i < 8; i++)
 			{
-				m_accum[i].w[SLICE_L] = m_v[VS2REG].w[i];
+				m_accum[SLICE_L].w[i] = m_v[VS2REG].w[i];
 			}
 			break;
 		}
@@ -1979,7 +1985,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 
 			for (int i = 0; i < 8; i++)
 			{
-				m_accum[i].w[SLICE_L] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
+				m_accum[SLICE_L].w[i] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
 			}
 
 			break;
@@ -2058,7 +2064,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 
 			for (int i = 0; i < 8; i++)
 			{
-				m_accum[i].w[SLICE_L] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
+				m_accum[SLICE_L].w[i] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
 			}
 
 			break;
@@ -2078,7 +2084,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 
 			for (int i = 0; i < 8; i++)
 			{
-				m_accum[i].w[SLICE_L] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
+				m_accum[SLICE_L].w[i] = m_v[VS2REG].w[VEC_EL_2(EL, i)];
 			}
 
 			m_v[VDREG].s[VS1REG & 7] = (int16_t)(m_reciprocal_res >> 16);    // store high part
@@ -2113,7 +2119,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 				vres[i] = 0;
 				uint16_t e1 = m_v[VS1REG].w[i];
 				uint16_t e2 = m_v[VS2REG].w[VEC_EL_2(EL, i)];
-				m_accum[i].w[SLICE_L] = e1 + e2;
+				m_accum[SLICE_L].w[i] = e1 + e2;
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -2133,7 +2139,7 @@ void rsp_device::handle_vector_ops(uint32_t op)
 			for (int i = 0; i < 8; i++)
 			{
 				vres[i] = m_v[VS1REG].w[i];
-				m_accum[i].w[SLICE_L] = 0;
+				m_accum[SLICE_L].w[i] = 0;
 			}
 			WRITEBACK_RESULT();
 			break;
@@ -2143,6 +2149,391 @@ void rsp_device::handle_vector_ops(uint32_t op)
 	}
 }
 
+/***************************************************************************
+    SIMD VECTOR UNIT
+***************************************************************************/
+
+// The accumulator is kept as four slices of eight lanes (see rsp.h), so each
+// slice is a single 128-bit vector.  Every operation here must match the
+// corresponding case in handle_vector_ops() bit for bit, including the
+// accumulator and flag side effects; set RSP_VERIFY_SIMD to have
+// device_start() check that against randomized inputs.  Operations that are
+// not handled here (the reciprocal unit, VMOV, VSAW, VNOP and the unused
+// opcodes) return false and fall back to the scalar path.
+
+#if RSP_VEC_SIMD
+
+namespace {
+
+// add the sign-extended 48-bit value a2:a1:a0 to the accumulator slices h:m:l
+inline void accumulate(rsp_vec &h, rsp_vec &m, rsp_vec &l, const rsp_vec &a2, const rsp_vec &a1, const rsp_vec &a0)
+{
+	const rsp_vec l_sum = l + a0;
+	const rsp_vec l_carry = rsp_vec::carry(l, a0, l_sum);
+	const rsp_vec m_part = m + a1;
+	const rsp_vec m_carry = rsp_vec::carry(m, a1, m_part);
+	const rsp_vec m_sum = m_part - l_carry;
+	const rsp_vec m_round = l_carry & rsp_vec::eq(m_sum, rsp_vec::zero());
+	h = h + a2 - (m_carry | m_round);
+	m = m_sum;
+	l = l_sum;
+}
+
+// SATURATE_ACCUM(i, slice, negative, positive) for all lanes at once
+inline rsp_vec saturate_accum_mid(const rsp_vec &h, const rsp_vec &m)
+{
+	const rsp_vec in_range = rsp_vec::eq(h, m.sra<15>());
+	return rsp_vec::select(in_range, m, h.sra<15>() ^ rsp_vec::all(0x7fff));
+}
+
+inline rsp_vec saturate_accum_low(const rsp_vec &h, const rsp_vec &m, const rsp_vec &l)
+{
+	const rsp_vec in_range = rsp_vec::eq(h, m.sra<15>());
+	return rsp_vec::select(in_range, l, ~h.sra<15>());
+}
+
+} // anonymous namespace
+
+bool rsp_device::handle_vector_ops_simd(uint32_t op)
+{
+	const rsp_vec vs = rsp_vec::load(m_v[VS1REG].w);
+	const rsp_vec vt = rsp_vec::load(m_v[VS2REG].w).element(EL);
+	const rsp_vec zero = rsp_vec::zero();
+	rsp_vec h = rsp_vec::load(m_accum[SLICE_H].w);
+	rsp_vec m = rsp_vec::load(m_accum[SLICE_M].w);
+	rsp_vec l;
+	rsp_vec res;
+
+	switch (op & 0x3f)
+	{
+		case 0x00:      /* VMULF */
+		case 0x01:      /* VMULU */
+		{
+			const rsp_vec lo = rsp_vec::mullo(vs, vt);
+			const rsp_vec hi = rsp_vec::mulhi(vs, vt);
+			const rsp_vec special = rsp_vec::eq(vs, rsp_vec::all(0x8000)) & rsp_vec::eq(vt, rsp_vec::all(0x8000));
+			l = lo.sll<1>() ^ rsp_vec::all(0x8000);
+			m = (hi.sll<1>() | lo.srl<15>()) + (lo.srl<14>() & rsp_vec::all(1));
+			h = rsp_vec::andnot(special, m.sra<15>());
+			if ((op & 0x3f) == 0x00)
+				res = rsp_vec::select(special, rsp_vec::all(0x7fff), m);
+			else
+				res = rsp_vec::andnot(h, m | m.sra<15>());
+			break;
+		}
+
+		case 0x04:      /* VMUDL */
+			l = rsp_vec::mulhi_unsigned(vs, vt);
+			m = h = zero;
+			res = l;
+			break;
+
+		case 0x05:      /* VMUDM */
+			l = rsp_vec::mullo(vs, vt);
+			m = rsp_vec::mulhi_mixed(vs, vt);
+			h = m.sra<15>();
+			res = m;
+			break;
+
+		case 0x06:      /* VMUDN */
+			l = rsp_vec::mullo(vs, vt);
+			m = rsp_vec::mulhi_mixed(vt, vs);
+			h = m.sra<15>();
+			res = l;
+			break;
+
+		case 0x07:      /* VMUDH */
+		{
+			const rsp_vec lo = rsp_vec::mullo(vs, vt);
+			const rsp_vec hi = rsp_vec::mulhi(vs, vt);
+			l = zero;
+			m = lo;
+			h = hi;
+			res = rsp_vec::clamp(lo, hi);
+			break;
+		}
+
+		case 0x08:      /* VMACF */
+		case 0x09:      /* VMACU */
+		{
+			const rsp_vec lo = rsp_vec::mullo(vs, vt);
+			const rsp_vec hi = rsp_vec::mulhi(vs, vt);
+			l = rsp_vec::load(m_accum[SLICE_L].w);
+			accumulate(h, m, l, hi.sra<15>(), hi.sll<1>() | lo.srl<15>(), lo.sll<1>());
+			if ((op & 0x3f) == 0x08)
+				res = saturate_accum_mid(h, m);
+			else
+				res = rsp_vec::andnot(h.sra<15>(), m | ~rsp_vec::eq(h, zero) | m.sra<15>());
+			break;
+		}
+
+		case 0x0c:      /* VMADL */
+			l = rsp_vec::load(m_accum[SLICE_L].w);
+			accumulate(h, m, l, zero, zero, rsp_vec::mulhi_unsigned(vs, vt));
+			res = saturate_accum_low(h, m, l);
+			break;
+
+		case 0x0d:      /* VMADM */
+		case 0x0e:      /* VMADN */
+		{
+			const rsp_vec lo = rsp_vec::mullo(vs, vt);
+			const rsp_vec hi = ((op & 0x3f) == 0x0d) ? rsp_vec::mulhi_mixed(vs, vt) : rsp_vec::mulhi_mixed(vt, vs);
+			l = rsp_vec::load(m_accum[SLICE_L].w);
+			accumulate(h, m, l, hi.sra<15>(), hi, lo);
+			res = ((op & 0x3f) == 0x0d) ? saturate_accum_mid(h, m) : saturate_accum_low(h, m, l);
+			break;
+		}
+
+		case 0x0f:      /* VMADH */
+		{
+			const rsp_vec lo = rsp_vec::mullo(vs, vt);
+			const rsp_vec sum = m + lo;
+			h = h + rsp_vec::mulhi(vs, vt) - rsp_vec::carry(m, lo, sum);
+			m = sum;
+			l = rsp_vec::load(m_accum[SLICE_L].w);
+			res = saturate_accum_mid(h, m);
+			break;
+		}
+
+		case 0x10:      /* VADD */
+		{
+			const rsp_vec carry = rsp_vec::from_flags(m_vcarry);
+			l = vs + vt - carry;
+			res = rsp_vec::adds(rsp_vec::adds(rsp_vec::min(vs, vt), carry & rsp_vec::all(1)), rsp_vec::max(vs, vt));
+			m_vzero = 0;
+			m_vcarry = 0;
+			break;
+		}
+
+		case 0x11:      /* VSUB */
+		{
+			// subtract vt + carry, saturating that sum first and compensating with one extra step when it overflowed
+			const rsp_vec carry = rsp_vec::from_flags(m_vcarry);
+			const rsp_vec sub = vt - carry;
+			const rsp_vec sub_sat = rsp_vec::subs(vt, carry);
+			l = vs - sub;
+			res = rsp_vec::adds(rsp_vec::subs(vs, sub_sat), rsp_vec::gt(sub_sat, sub));
+			m_vzero = 0;
+			m_vcarry = 0;
+			break;
+		}
+
+		case 0x13:      /* VABS */
+			res = rsp_vec::select(rsp_vec::lt(vs, zero), rsp_vec::subs(zero, vt), rsp_vec::andnot(rsp_vec::eq(vs, zero), vt));
+			l = res;
+			break;
+
+		case 0x14:      /* VADDC */
+			res = vs + vt;
+			l = res;
+			m_vzero = 0;
+			m_vcarry = rsp_vec::carry(vs, vt, res).flags();
+			break;
+
+		case 0x15:      /* VSUBC */
+			res = vs - vt;
+			l = res;
+			m_vzero = (~rsp_vec::eq(res, zero)).flags();
+			m_vcarry = rsp_vec::lt_unsigned(vs, vt).flags();
+			break;
+
+		case 0x20:      /* VLT */
+		case 0x21:      /* VEQ */
+		case 0x22:      /* VNE */
+		case 0x23:      /* VGE */
+		{
+			const rsp_vec eq = rsp_vec::eq(vs, vt);
+			rsp_vec compare;
+			switch (op & 0x3f)
+			{
+				case 0x20: compare = rsp_vec::lt(vs, vt) | (eq & rsp_vec::from_flags(m_vzero & m_vcarry)); break;
+				case 0x21: compare = rsp_vec::andnot(rsp_vec::from_flags(m_vzero), eq); break;
+				case 0x22: compare = ~eq | rsp_vec::from_flags(m_vzero); break;
+				default:   compare = rsp_vec::andnot(rsp_vec::from_flags(m_vzero & m_vcarry), eq) | rsp_vec::gt(vs, vt); break;
+			}
+			res = rsp_vec::select(compare, vs, vt);
+			l = res;
+			m_vcompare = compare.flags();
+			m_vclip2 = 0;
+			m_vzero = 0;
+			m_vcarry = 0;
+			break;
+		}
+
+		case 0x24:      /* VCL */
+		{
+			const rsp_vec sum = vs + vt;
+			const rsp_vec carry = rsp_vec::carry(vs, vt, sum);
+			const rsp_vec nonzero = ~rsp_vec::eq(sum, zero);
+			const rsp_vec vco_lo = rsp_vec::from_flags(m_vcarry);
+			const rsp_vec vco_hi = rsp_vec::from_flags(m_vzero);
+			const rsp_vec vcc_lo = rsp_vec::from_flags(m_vcompare);
+			const rsp_vec vcc_hi = rsp_vec::from_flags(m_vclip2);
+			const rsp_vec vce = rsp_vec::from_flags(m_vclip1);
+
+			const rsp_vec lo = rsp_vec::select(vco_hi, vcc_lo, ~rsp_vec::select(vce, carry & nonzero, carry | nonzero));
+			const rsp_vec hi = rsp_vec::select(vco_hi, vcc_hi, ~rsp_vec::lt_unsigned(vs, vt));
+			const rsp_vec compare = rsp_vec::select(vco_lo, lo, vcc_lo);
+			const rsp_vec clip2 = rsp_vec::select(vco_lo, vcc_hi, hi);
+
+			res = rsp_vec::select(vco_lo, rsp_vec::select(compare, zero - vt, vs), rsp_vec::select(clip2, vt, vs));
+			l = res;
+			m_vcompare = compare.flags();
+			m_vclip2 = clip2.flags();
+			m_vzero = 0;
+			m_vcarry = 0;
+			m_vclip1 = 0;
+			break;
+		}
+
+		case 0x25:      /* VCH */
+		{
+			const rsp_vec sign = (vs ^ vt).sra<15>();
+			const rsp_vec sum = vs + vt;
+			const rsp_vec diff = vs - vt;
+			const rsp_vec sum_neg1 = rsp_vec::eq(sum, rsp_vec::all(0xffff));
+			const rsp_vec compare = rsp_vec::select(sign, ~rsp_vec::gt(sum, zero), vt.sra<15>());
+			const rsp_vec clip2 = rsp_vec::select(sign, vt.sra<15>(), ~diff.sra<15>());
+			const rsp_vec nonzero = rsp_vec::select(sign, ~(rsp_vec::eq(sum, zero) | sum_neg1), ~rsp_vec::eq(diff, zero));
+
+			res = rsp_vec::select(sign, rsp_vec::select(compare, zero - vt, vs), rsp_vec::select(clip2, vt, vs));
+			l = res;
+			m_vcarry = sign.flags();
+			m_vcompare = compare.flags();
+			m_vclip1 = (sign & sum_neg1).flags();
+			m_vzero = nonzero.flags();
+			m_vclip2 = clip2.flags();
+			break;
+		}
+
+		case 0x26:      /* VCR */
+		{
+			const rsp_vec sign = (vs ^ vt).sra<15>();
+			const rsp_vec compare = rsp_vec::select(sign, ~rsp_vec::gt(vs + vt, zero), vt.sra<15>());
+			const rsp_vec clip2 = rsp_vec::select(sign, vt.sra<15>(), ~(vs - vt).sra<15>());
+
+			res = rsp_vec::select(sign, rsp_vec::select(compare, ~vt, vs), rsp_vec::select(clip2, vt, vs));
+			l = res;
+			m_vcarry = 0;
+			m_vcompare = compare.flags();
+			m_vclip1 = 0;
+			m_vzero = 0;
+			m_vclip2 = clip2.flags();
+			break;
+		}
+
+		case 0x27:      /* VMRG */
+			res = rsp_vec::select(rsp_vec::from_flags(m_vcompare), vs, vt);
+			l = res;
+			break;
+
+		case 0x28:      /* VAND */    res = vs & vt;      l = res; break;
+		case 0x29:      /* VNAND */   res = ~(vs & vt);   l = res; break;
+		case 0x2a:      /* VOR */     res = vs | vt;      l = res; break;
+		case 0x2b:      /* VNOR */    res = ~(vs | vt);   l = res; break;
+		case 0x2c:      /* VXOR */    res = vs ^ vt;      l = res; break;
+		case 0x2d:      /* VNXOR */   res = ~(vs ^ vt);   l = res; break;
+
+		case 0x2e:      /* V056 (Reserved) */
+		case 0x2f:      /* V057 (Reserved) */
+		case 0x3b:      /* V073 (Reserved) */
+			res = zero;
+			l = vs + vt;
+			break;
+
+		case 0x3f:      /* VNULL (Reserved) */
+			res = vs;
+			l = zero;
+			break;
+
+		default:
+			return false;
+	}
+
+	h.store(m_accum[SLICE_H].w);
+	m.store(m_accum[SLICE_M].w);
+	l.store(m_accum[SLICE_L].w);
+	res.store(m_v[VDREG].w);
+	return true;
+}
+
+#else // RSP_VEC_SIMD
+
+bool rsp_device::handle_vector_ops_simd(uint32_t)
+{
+	return false;
+}
+
+#endif // RSP_VEC_SIMD
+
+void rsp_device::verify_vector_ops_simd()
+{
+	static const uint8_t ops[] = {
+		0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x13, 0x14, 0x15,
+		0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x3b, 0x3f };
+	static const uint16_t edges[] = { 0x0000, 0x0001, 0x7fff, 0x8000, 0x8001, 0xffff };
+
+	uint32_t seed = 0x12345678;
+	auto const random = [&seed] () -> uint16_t
+	{
+		seed = seed * 1103515245 + 12345;
+		return uint16_t(seed >> 16);
+	};
+	auto const random_lane = [&random] () -> uint16_t
+	{
+		uint16_t const value = random();
+		return ((value & 3) == 0) ? edges[(value >> 2) % std::size(edges)] : random();
+	};
+
+	for (uint8_t func : ops)
+	{
+		for (int iteration = 0; iteration < 4096; iteration++)
+		{
+			uint32_t const op = 0x4a000000 | ((iteration & 0xf) << 21) | ((random() & 3) << 16) | ((random() & 3) << 11) | ((random() & 3) << 6) | func;
+			for (int reg = 0; reg < 4; reg++)
+				for (int i = 0; i < 8; i++)
+					m_v[reg].w[i] = random_lane();
+			for (int slice = SLICE_LL; slice <= SLICE_H; slice++)
+				for (int i = 0; i < 8; i++)
+					m_accum[slice].w[i] = random_lane();
+			m_vcarry = random();
+			m_vcompare = random();
+			m_vclip1 = random();
+			m_vzero = random();
+			m_vclip2 = random();
+
+			VECTOR_REG const v[4] = { m_v[0], m_v[1], m_v[2], m_v[3] };
+			VECTOR_REG const accum[4] = { m_accum[0], m_accum[1], m_accum[2], m_accum[3] };
+			uint8_t const flags[5] = { m_vcarry, m_vcompare, m_vclip1, m_vzero, m_vclip2 };
+
+			handle_vector_ops(op);
+			VECTOR_REG const scalar_v[4] = { m_v[0], m_v[1], m_v[2], m_v[3] };
+			VECTOR_REG const scalar_accum[4] = { m_accum[0], m_accum[1], m_accum[2], m_accum[3] };
+			uint8_t const scalar_flags[5] = { m_vcarry, m_vcompare, m_vclip1, m_vzero, m_vclip2 };
+
+			std::copy(std::begin(v), std::end(v), m_v);
+			std::copy(std::begin(accum), std::end(accum), m_accum);
+			m_vcarry = flags[0];
+			m_vcompare = flags[1];
+			m_vclip1 = flags[2];
+			m_vzero = flags[3];
+			m_vclip2 = flags[4];
+			if (!handle_vector_ops_simd(op))
+				continue;
+
+			uint8_t const simd_flags[5] = { m_vcarry, m_vcompare, m_vclip1, m_vzero, m_vclip2 };
+			if (memcmp(scalar_v, m_v, sizeof(scalar_v)) || memcmp(scalar_accum, m_accum, sizeof(scalar_accum)) || memcmp(scalar_flags, simd_flags, sizeof(simd_flags)))
+				fatalerror("RSP: SIMD vector op %08x does not match the scalar implementation\n", op);
+		}
+	}
+
+	for (auto &elem : m_v)
+		elem.d[0] = elem.d[1] = 0;
+	for (auto &elem : m_accum)
+		elem.d[0] = elem.d[1] = 0;
+	m_vcarry = m_vcompare = m_vclip1 = m_vzero = m_vclip2 = 0;
+}
+
 void rsp_device::handle_cop2(uint32_t op)
 {
 	switch ((op >> 21) & 0x1f)
@@ -2230,7 +2621,8 @@ void rsp_device::handle_cop2(uint32_t op)
 
 		case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
 		case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
-			handle_vector_ops(op);
+			if (!handle_vector_ops_simd(op))
+				handle_vector_ops(op);
 			break;
 
 		default:
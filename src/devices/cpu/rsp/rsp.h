@@ -159,13 +159,6 @@ private:
 		uint8_t  b[16];
 	};
 
-	union ACCUMULATOR_REG
-	{
-		uint64_t q;
-		uint32_t l[2];
-		uint16_t w[4];
-	};
-
 	uint32_t m_debugger_temp;
 	uint16_t m_pc_temp;
 	uint16_t m_ppc_temp;
@@ -191,8 +184,8 @@ private:
 	uint16_t SATURATE_ACCUM(int accum, int slice, uint16_t negative, uint16_t positive);
 
 	uint16_t          m_vres[8];
-	VECTOR_REG        m_v[32];
-	ACCUMULATOR_REG   m_accum[8];
+	alignas(16) VECTOR_REG m_v[32];
+	alignas(16) VECTOR_REG m_accum[4];  // one slice (SLICE_LL..SLICE_H) per entry, one lane per element
 	uint8_t           m_vcarry;
 	uint8_t           m_vcompare;
 	uint8_t           m_vclip1;
@@ -207,6 +200,8 @@ private:
 	void              handle_lwc2(uint32_t op);
 	void              handle_swc2(uint32_t op);
 	void              handle_vector_ops(uint32_t op);
+	bool              handle_vector_ops_simd(uint32_t op);
+	void              verify_vector_ops_simd();
 
 	uint32_t          m_div_in;
 	uint32_t          m_div_out;
@@ -0,0 +1,261 @@
+// license:BSD-3-Clause
+// copyright-holders:Ville Linde, Ryan Holtz
+/***************************************************************************
+
+    rspvec.h
+
+    128-bit SIMD helpers for the RSP vector unit.  A vector holds the
+    eight 16-bit lanes of a VU register (element 0 in the lowest lane),
+    a comparison result is all ones or all zeroes per lane, and VCC/VCO/
+    VCE style flags convert to and from eight-bit lane masks.
+
+    Only operations that the SSE2 and NEON instruction sets provide
+    directly (or in a couple of instructions) are exposed, so the vector
+    unit code in rsp.cpp is written once for both.
+
+***************************************************************************/
+
+#ifndef MAME_CPU_RSP_RSPVEC_H
+#define MAME_CPU_RSP_RSPVEC_H
+
+#pragma once
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+
+#define RSP_VEC_SSE2    1
+#include <emmintrin.h>
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__ARM_NEON) && defined(__aarch64__)
+
+#define RSP_VEC_NEON    1
+#include <arm_neon.h>
+
+#endif
+
+#if defined(RSP_VEC_SSE2) || defined(RSP_VEC_NEON)
+#define RSP_VEC_SIMD    1
+#else
+#define RSP_VEC_SIMD    0
+#endif
+
+
+#if RSP_VEC_SIMD
+
+/* byte shuffles for the VS2 element specifier, see vector_elements_2 in rsp.cpp */
+alignas(16) static const uint8_t rsp_vec_element_shuffle[16][16] =
+{
+	{ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f }, // none
+	{ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f }, // ???
+	{ 0x00, 0x01, 0x00, 0x01, 0x04, 0x05, 0x04, 0x05, 0x08, 0x09, 0x08, 0x09, 0x0c, 0x0d, 0x0c, 0x0d }, // 0q
+	{ 0x02, 0x03, 0x02, 0x03, 0x06, 0x07, 0x06, 0x07, 0x0a, 0x0b, 0x0a, 0x0b, 0x0e, 0x0f, 0x0e, 0x0f }, // 1q
+	{ 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09 }, // 0h
+	{ 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b }, // 1h
+	{ 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d }, // 2h
+	{ 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f }, // 3h
+	{ 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01 }, // 0
+	{ 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03 }, // 1
+	{ 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05 }, // 2
+	{ 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07 }, // 3
+	{ 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09 }, // 4
+	{ 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b }, // 5
+	{ 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d }, // 6
+	{ 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f }, // 7
+};
+
+alignas(16) static const uint16_t rsp_vec_lane_bits[8] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+class rsp_vec
+{
+public:
+#if defined(RSP_VEC_SSE2)
+	typedef __m128i value_type;
+#else
+	typedef uint16x8_t value_type;
+#endif
+
+	rsp_vec() { }
+	explicit rsp_vec(value_type value) : m_value(value) { }
+
+#if defined(RSP_VEC_SSE2)
+
+	static rsp_vec load(const uint16_t *src) { return rsp_vec(_mm_loadu_si128((const __m128i *)src)); }
+	void store(uint16_t *dst) const { _mm_storeu_si128((__m128i *)dst, m_value); }
+	static rsp_vec zero() { return rsp_vec(_mm_setzero_si128()); }
+	static rsp_vec all(uint16_t value) { return rsp_vec(_mm_set1_epi16(int16_t(value))); }
+
+	rsp_vec operator&(const rsp_vec &b) const { return rsp_vec(_mm_and_si128(m_value, b.m_value)); }
+	rsp_vec operator|(const rsp_vec &b) const { return rsp_vec(_mm_or_si128(m_value, b.m_value)); }
+	rsp_vec operator^(const rsp_vec &b) const { return rsp_vec(_mm_xor_si128(m_value, b.m_value)); }
+	rsp_vec operator~() const { return rsp_vec(_mm_xor_si128(m_value, _mm_set1_epi32(-1))); }
+	rsp_vec operator+(const rsp_vec &b) const { return rsp_vec(_mm_add_epi16(m_value, b.m_value)); }
+	rsp_vec operator-(const rsp_vec &b) const { return rsp_vec(_mm_sub_epi16(m_value, b.m_value)); }
+
+	// ~a & b
+	static rsp_vec andnot(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_andnot_si128(a.m_value, b.m_value)); }
+
+	static rsp_vec select(const rsp_vec &mask, const rsp_vec &a, const rsp_vec &b)
+	{
+#ifdef __SSE4_1__
+		return rsp_vec(_mm_blendv_epi8(b.m_value, a.m_value, mask.m_value));
+#else
+		return rsp_vec(_mm_or_si128(_mm_and_si128(mask.m_value, a.m_value), _mm_andnot_si128(mask.m_value, b.m_value)));
+#endif
+	}
+
+	template <int Shift> rsp_vec sra() const { return rsp_vec(_mm_srai_epi16(m_value, Shift)); }
+	template <int Shift> rsp_vec srl() const { return rsp_vec(_mm_srli_epi16(m_value, Shift)); }
+	template <int Shift> rsp_vec sll() const { return rsp_vec(_mm_slli_epi16(m_value, Shift)); }
+
+	static rsp_vec adds(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_adds_epi16(a.m_value, b.m_value)); }
+	static rsp_vec subs(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_subs_epi16(a.m_value, b.m_value)); }
+	static rsp_vec min(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_min_epi16(a.m_value, b.m_value)); }
+	static rsp_vec max(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_max_epi16(a.m_value, b.m_value)); }
+
+	static rsp_vec mullo(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_mullo_epi16(a.m_value, b.m_value)); }
+	static rsp_vec mulhi(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_mulhi_epi16(a.m_value, b.m_value)); }
+	static rsp_vec mulhi_unsigned(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_mulhi_epu16(a.m_value, b.m_value)); }
+
+	static rsp_vec eq(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_cmpeq_epi16(a.m_value, b.m_value)); }
+	static rsp_vec lt(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_cmplt_epi16(a.m_value, b.m_value)); }
+	static rsp_vec gt(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(_mm_cmpgt_epi16(a.m_value, b.m_value)); }
+	static rsp_vec lt_unsigned(const rsp_vec &a, const rsp_vec &b)
+	{
+		const __m128i bias = _mm_set1_epi16(-32768);
+		return rsp_vec(_mm_cmplt_epi16(_mm_xor_si128(a.m_value, bias), _mm_xor_si128(b.m_value, bias)));
+	}
+
+	// saturate the signed 32-bit values hi:lo to 16 bits
+	static rsp_vec clamp(const rsp_vec &lo, const rsp_vec &hi)
+	{
+		return rsp_vec(_mm_packs_epi32(_mm_unpacklo_epi16(lo.m_value, hi.m_value), _mm_unpackhi_epi16(lo.m_value, hi.m_value)));
+	}
+
+	static rsp_vec from_flags(uint8_t flags)
+	{
+		const __m128i bits = _mm_load_si128((const __m128i *)rsp_vec_lane_bits);
+		return rsp_vec(_mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(flags), bits), bits));
+	}
+
+	uint8_t flags() const { return uint8_t(_mm_movemask_epi8(_mm_packs_epi16(m_value, _mm_setzero_si128()))); }
+
+	rsp_vec element(int el) const
+	{
+#ifdef __SSSE3__
+		return rsp_vec(_mm_shuffle_epi8(m_value, _mm_load_si128((const __m128i *)rsp_vec_element_shuffle[el])));
+#else
+		switch (el)
+		{
+			case 0x2: return rsp_vec(_mm_shufflehi_epi16(_mm_shufflelo_epi16(m_value, 0xa0), 0xa0));
+			case 0x3: return rsp_vec(_mm_shufflehi_epi16(_mm_shufflelo_epi16(m_value, 0xf5), 0xf5));
+			case 0x4: return rsp_vec(_mm_shufflehi_epi16(_mm_shufflelo_epi16(m_value, 0x00), 0x00));
+			case 0x5: return rsp_vec(_mm_shufflehi_epi16(_mm_shufflelo_epi16(m_value, 0x55), 0x55));
+			case 0x6: return rsp_vec(_mm_shufflehi_epi16(_mm_shufflelo_epi16(m_value, 0xaa), 0xaa));
+			case 0x7: return rsp_vec(_mm_shufflehi_epi16(_mm_shufflelo_epi16(m_value, 0xff), 0xff));
+			case 0x8: { const __m128i v = _mm_shufflelo_epi16(m_value, 0x00); return rsp_vec(_mm_unpacklo_epi64(v, v)); }
+			case 0x9: { const __m128i v = _mm_shufflelo_epi16(m_value, 0x55); return rsp_vec(_mm_unpacklo_epi64(v, v)); }
+			case 0xa: { const __m128i v = _mm_shufflelo_epi16(m_value, 0xaa); return rsp_vec(_mm_unpacklo_epi64(v, v)); }
+			case 0xb: { const __m128i v = _mm_shufflelo_epi16(m_value, 0xff); return rsp_vec(_mm_unpacklo_epi64(v, v)); }
+			case 0xc: { const __m128i v = _mm_shufflehi_epi16(m_value, 0x00); return rsp_vec(_mm_unpackhi_epi64(v, v)); }
+			case 0xd: { const __m128i v = _mm_shufflehi_epi16(m_value, 0x55); return rsp_vec(_mm_unpackhi_epi64(v, v)); }
+			case 0xe: { const __m128i v = _mm_shufflehi_epi16(m_value, 0xaa); return rsp_vec(_mm_unpackhi_epi64(v, v)); }
+			case 0xf: { const __m128i v = _mm_shufflehi_epi16(m_value, 0xff); return rsp_vec(_mm_unpackhi_epi64(v, v)); }
+			default: return *this;
+		}
+#endif
+	}
+
+#else // RSP_VEC_NEON
+
+	static rsp_vec load(const uint16_t *src) { return rsp_vec(vld1q_u16(src)); }
+	void store(uint16_t *dst) const { vst1q_u16(dst, m_value); }
+	static rsp_vec zero() { return rsp_vec(vdupq_n_u16(0)); }
+	static rsp_vec all(uint16_t value) { return rsp_vec(vdupq_n_u16(value)); }
+
+	rsp_vec operator&(const rsp_vec &b) const { return rsp_vec(vandq_u16(m_value, b.m_value)); }
+	rsp_vec operator|(const rsp_vec &b) const { return rsp_vec(vorrq_u16(m_value, b.m_value)); }
+	rsp_vec operator^(const rsp_vec &b) const { return rsp_vec(veorq_u16(m_value, b.m_value)); }
+	rsp_vec operator~() const { return rsp_vec(vmvnq_u16(m_value)); }
+	rsp_vec operator+(const rsp_vec &b) const { return rsp_vec(vaddq_u16(m_value, b.m_value)); }
+	rsp_vec operator-(const rsp_vec &b) const { return rsp_vec(vsubq_u16(m_value, b.m_value)); }
+
+	// ~a & b
+	static rsp_vec andnot(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vbicq_u16(b.m_value, a.m_value)); }
+	static rsp_vec select(const rsp_vec &mask, const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vbslq_u16(mask.m_value, a.m_value, b.m_value)); }
+
+	template <int Shift> rsp_vec sra() const { return rsp_vec(vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(m_value), Shift))); }
+	template <int Shift> rsp_vec srl() const { return rsp_vec(vshrq_n_u16(m_value, Shift)); }
+	template <int Shift> rsp_vec sll() const { return rsp_vec(vshlq_n_u16(m_value, Shift)); }
+
+	static rsp_vec adds(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vreinterpretq_u16_s16(vqaddq_s16(a.s16(), b.s16()))); }
+	static rsp_vec subs(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vreinterpretq_u16_s16(vqsubq_s16(a.s16(), b.s16()))); }
+	static rsp_vec min(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vreinterpretq_u16_s16(vminq_s16(a.s16(), b.s16()))); }
+	static rsp_vec max(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vreinterpretq_u16_s16(vmaxq_s16(a.s16(), b.s16()))); }
+
+	static rsp_vec mullo(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vmulq_u16(a.m_value, b.m_value)); }
+	static rsp_vec mulhi(const rsp_vec &a, const rsp_vec &b)
+	{
+		const int32x4_t lo = vmull_s16(vget_low_s16(a.s16()), vget_low_s16(b.s16()));
+		const int32x4_t hi = vmull_high_s16(a.s16(), b.s16());
+		return rsp_vec(vreinterpretq_u16_s16(vuzp2q_s16(vreinterpretq_s16_s32(lo), vreinterpretq_s16_s32(hi))));
+	}
+	static rsp_vec mulhi_unsigned(const rsp_vec &a, const rsp_vec &b)
+	{
+		const uint32x4_t lo = vmull_u16(vget_low_u16(a.m_value), vget_low_u16(b.m_value));
+		const uint32x4_t hi = vmull_high_u16(a.m_value, b.m_value);
+		return rsp_vec(vuzp2q_u16(vreinterpretq_u16_u32(lo), vreinterpretq_u16_u32(hi)));
+	}
+
+	static rsp_vec eq(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vceqq_u16(a.m_value, b.m_value)); }
+	static rsp_vec lt(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vcltq_s16(a.s16(), b.s16())); }
+	static rsp_vec gt(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vcgtq_s16(a.s16(), b.s16())); }
+	static rsp_vec lt_unsigned(const rsp_vec &a, const rsp_vec &b) { return rsp_vec(vcltq_u16(a.m_value, b.m_value)); }
+
+	// saturate the signed 32-bit values hi:lo to 16 bits
+	static rsp_vec clamp(const rsp_vec &lo, const rsp_vec &hi)
+	{
+		const int32x4_t l = vreinterpretq_s32_u16(vzip1q_u16(lo.m_value, hi.m_value));
+		const int32x4_t h = vreinterpretq_s32_u16(vzip2q_u16(lo.m_value, hi.m_value));
+		return rsp_vec(vreinterpretq_u16_s16(vcombine_s16(vqmovn_s32(l), vqmovn_s32(h))));
+	}
+
+	static rsp_vec from_flags(uint8_t flags) { return rsp_vec(vtstq_u16(vdupq_n_u16(flags), vld1q_u16(rsp_vec_lane_bits))); }
+	uint8_t flags() const { return uint8_t(vaddvq_u16(vandq_u16(m_value, vld1q_u16(rsp_vec_lane_bits)))); }
+
+	rsp_vec element(int el) const
+	{
+		return rsp_vec(vreinterpretq_u16_u8(vqtbl1q_u8(vreinterpretq_u8_u16(m_value), vld1q_u8(rsp_vec_element_shuffle[el]))));
+	}
+
+private:
+	int16x8_t s16() const { return vreinterpretq_s16_u16(m_value); }
+
+#endif
+
+public:
+	// high half of signed a times unsigned b
+	static rsp_vec mulhi_mixed(const rsp_vec &a, const rsp_vec &b) { return mulhi(a, b) + (a & b.sra<15>()); }
+
+	// all ones in lanes where the unsigned sum = a + b carried out of 16 bits
+	static rsp_vec carry(const rsp_vec &a, const rsp_vec &b, const rsp_vec &sum)
+	{
+		return ((a & b) | andnot(sum, a | b)).sra<15>();
+	}
+
+private:
+	value_type m_value;
+};
+
+#endif // RSP_VEC_SIMD
+
+#endif // MAME_CPU_RSP_RSPVEC_H
@@ -341,24 +341,26 @@ void netlist_mame_device::register_memregion_source(netlist::nlparse_t &parser,
 void netlist_mame_analog_input_device::write(const double val)
 {
 	m_value_to_sync = val * m_mult + m_offset;
-	if (m_value_to_sync != (*m_param)())
+	// the parameter is owned by the worker while running ahead
+	if (run_ahead() ? (m_value_to_sync != m_last_queued) : (m_value_to_sync != (*m_param)()))
 	{
+		m_last_queued = m_value_to_sync;
 		machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_analog_input_device::sync_callback), this));
 	}
 }
 
 TIMER_CALLBACK_MEMBER(netlist_mame_analog_input_device::sync_callback)
 {
-	update_to_current_time();
 	nl_owner().log_csv().log_add(m_param_name, m_value_to_sync, true);
-	m_param->set(m_value_to_sync);
+	set_param(*m_param, m_value_to_sync);
 }
 
 void netlist_mame_int_input_device::write(const uint32_t val)
 {
 	const uint32_t v = (val >> m_shift) & m_mask;
-	if (v != (*m_param)())
+	if (run_ahead() ? (v != m_last_queued) : (v != (*m_param)()))
 	{
+		m_last_queued = v;
 		LOGDEBUG("write %s\n", this->tag());
 		machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_int_input_device::sync_callback), this), v);
 }
@@ -367,8 +369,9 @@ void netlist_mame_int_input_device::write(const uint32_t val)
 void netlist_mame_logic_input_device::write(const uint32_t val)
 {
 	const uint32_t v = (val >> m_shift) & 1;
-	if (v != (*m_param)())
+	if (run_ahead() ? (v != m_last_queued) : (v != (*m_param)()))
 	{
+		m_last_queued = v;
 		LOGDEBUG("write %s\n", this->tag());
 		machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_logic_input_device::sync_callback), this), v);
 	}
@@ -376,16 +379,14 @@ void netlist_mame_logic_input_device::write(const uint32_t val)
 
 TIMER_CALLBACK_MEMBER(netlist_mame_int_input_device::sync_callback)
 {
-	update_to_current_time();
 	nl_owner().log_csv().log_add(m_param_name, param, false);
-	m_param->set(param);
+	set_param(*m_param, param);
 }
 
 TIMER_CALLBACK_MEMBER(netlist_mame_logic_input_device::sync_callback)
 {
-	update_to_current_time();
 	nl_owner().log_csv().log_add(m_param_name, param, false);
-	m_param->set(param);
+	set_param(*m_param, param);
 }
 
 TIMER_CALLBACK_MEMBER(netlist_mame_ram_pointer_device::sync_callback)
@@ -430,6 +431,7 @@ netlist_mame_analog_input_device::netlist_mame_analog_input_device(const machine
 	, m_auto_port(true)
 	, m_param_name(param_name)
 	, m_value_to_sync(0)
+	, m_last_queued(0)
 {
 }
 
@@ -440,6 +442,7 @@ netlist_mame_analog_input_device::netlist_mame_analog_input_device(const machine
 	, m_auto_port(true)
 	, m_param_name("")
 	, m_value_to_sync(0)
+	, m_last_queued(0)
 {
 }
 
@@ -453,6 +456,9 @@ void netlist_mame_analog_input_device::device_start()
 	{
 		fatalerror("device %s wrong parameter type for %s\n", basetag(), m_param_name);
 	}
+
+	m_last_queued = (*m_param)();
+	save_item(NAME(m_last_queued));
 	if (m_mult != 1.0 || m_offset != 0.0)
 	{
 		// disable automatic scaling for ioports
@@ -585,6 +591,7 @@ netlist_mame_int_input_device::netlist_mame_int_input_device(const machine_confi
 	, m_mask(0xffffffff)
 	, m_shift(0)
 	, m_param_name("")
+	, m_last_queued(0)
 {
 }
 
@@ -605,6 +612,9 @@ void netlist_mame_int_input_device::device_start()
 	{
 		fatalerror("device %s wrong parameter type for %s\n", basetag(), m_param_name);
 	}
+
+	m_last_queued = (*m_param)();
+	save_item(NAME(m_last_queued));
 }
 
 void netlist_mame_int_input_device::validity_helper(validity_checker &valid,
@@ -628,6 +638,7 @@ netlist_mame_logic_input_device::netlist_mame_logic_input_device(const machine_c
 	, m_param(nullptr)
 	, m_shift(0)
 	, m_param_name("")
+	, m_last_queued(0)
 {
 }
 
@@ -647,6 +658,9 @@ void netlist_mame_logic_input_device::device_start()
 	{
 		fatalerror("device %s wrong parameter type for %s\n", basetag(), m_param_name);
 	}
+
+	m_last_queued = (*m_param)();
+	save_item(NAME(m_last_queued));
 }
 
 void netlist_mame_logic_input_device::validity_helper(validity_checker &valid,
@@ -1321,6 +1335,9 @@ netlist_mame_sound_device::netlist_mame_sound_device(const machine_config &mconf
 	, m_sound_clock(clock)
 	, m_attotime_per_clock(attotime::zero)
 	, m_last_update_to_current_time(attotime::zero)
+	, m_run_ahead(true)
+	, m_run_ahead_queue(nullptr)
+	, m_run_ahead_busy(false)
 {
 }
 
@@ -1399,9 +1416,36 @@ void netlist_mame_sound_device::device_start()
 	/* initialize the stream(s) */
 	m_stream = stream_alloc(m_in.size(), m_out.size(), m_sound_clock, STREAM_DISABLE_INPUT_RESAMPLING);
 
+	// Stream inputs are only valid within sound_stream_update, so netlists
+	// consuming them have to be advanced synchronously.
+	if (m_run_ahead && m_in.empty() && machine().options().netlist_run_ahead())
+	{
+		m_run_ahead_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
+		// the worker must not touch the netlist while a state is loaded
+		machine().save().register_preload(save_prepost_delegate(FUNC(netlist_mame_sound_device::run_ahead_wait), this));
+	}
+	LOGDEBUG("run ahead %s\n", run_ahead() ? "enabled" : "disabled");
+
 	LOGDEVCALLS("sound device_start exit\n");
 }
 
+void netlist_mame_sound_device::device_stop()
+{
+	if (m_run_ahead_queue != nullptr)
+	{
+		run_ahead_wait();
+		osd_work_queue_free(m_run_ahead_queue);
+		m_run_ahead_queue = nullptr;
+	}
+	netlist_mame_device::device_stop();
+}
+
+void netlist_mame_sound_device::device_pre_save()
+{
+	run_ahead_wait();
+	netlist_mame_device::device_pre_save();
+}
+
 
 void netlist_mame_sound_device::nl_register_devices(netlist::nlparse_t &parser) const
 {
@@ -1416,10 +1460,70 @@ void netlist_mame_sound_device::register_stream_output(int channel, netlist_mame
 	m_out[channel] = so;
 }
 
+template <typename T>
+void netlist_mame_sound_device::queue_input(netlist::param_num_t<T> &param, T value)
+{
+	const auto apply = [] (void *p, double v) { static_cast<netlist::param_num_t<T> *>(p)->set(static_cast<T>(v)); };
+
+	bool start;
+	{
+		std::lock_guard<std::mutex> lock(m_input_lock);
+		m_inputs.push_back({ nltime_from_attotime(machine().time()), &param, double(value), apply });
+		start = !m_run_ahead_busy;
+		m_run_ahead_busy = true;
+	}
+	if (start)
+		osd_work_item_queue(m_run_ahead_queue, run_ahead_callback, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+void *netlist_mame_sound_device::run_ahead_callback(void *param, int threadid)
+{
+	reinterpret_cast<netlist_mame_sound_device *>(param)->run_ahead_process();
+	return nullptr;
+}
+
+void netlist_mame_sound_device::run_ahead_process()
+{
+	// advance up to the latest input, picking up inputs queued meanwhile
+	for (;;)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_input_lock);
+			m_worker_inputs.clear();
+			std::swap(m_inputs, m_worker_inputs);
+			if (m_worker_inputs.empty())
+			{
+				m_run_ahead_busy = false;
+				return;
+			}
+		}
+		for (auto &e : m_worker_inputs)
+		{
+			const auto cur(netlist().exec().time());
+			if (e.time > cur)
+				netlist().exec().process_queue(e.time - cur);
+			e.apply(e.param, e.value);
+		}
+	}
+}
+
+void netlist_mame_sound_device::run_ahead_wait()
+{
+	// the emulation thread is the only producer, so the worker is idle and
+	// all queued inputs have been applied once the queue has drained
+	if (m_run_ahead_queue != nullptr)
+	{
+		while (!osd_work_queue_wait(m_run_ahead_queue, osd_ticks_per_second() * 10)) { }
+	}
+}
+
 void netlist_mame_sound_device::update_to_current_time()
 {
 	LOGDEBUG("before update\n");
 
+	// synchronous fallback for callers reading back netlist state
+	run_ahead_wait();
+
 	get_stream()->update();
 
 	if (machine().time() < m_last_update_to_current_time)
@@ -1442,6 +1546,9 @@ void netlist_mame_sound_device::update_to_current_time()
 
 void netlist_mame_sound_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
+	// collect the samples the worker produced so far
+	run_ahead_wait();
+
 	for (auto &e : m_in)
 	{
 		auto clock_period = inputs[e.first].sample_period();
@@ -13,6 +13,8 @@
 
 #include <functional>
 #include <deque>
+#include <mutex>
+#include <vector>
 
 #include "../../lib/netlist/nltypes.h"
 
@@ -289,9 +291,18 @@ public:
 	}
 
 
+	// Advance the netlist on a worker thread, ahead of the main emulation.
+	// Only effective for netlists without stream inputs.
+	netlist_mame_sound_device &set_run_ahead(bool enable) { m_run_ahead = enable; return *this; }
+	bool run_ahead() const noexcept { return m_run_ahead_queue != nullptr; }
+
 	inline sound_stream *get_stream() { return m_stream; }
 	void update_to_current_time();
 
+	// queue a parameter change for the run-ahead worker
+	template <typename T>
+	void queue_input(netlist::param_num_t<T> &param, T value);
+
 	void register_stream_output(int channel, netlist_mame_stream_output_device *so);
 
 protected:
@@ -301,6 +312,8 @@ protected:
 
 	// device_t overrides
 	virtual void device_start() override;
+	virtual void device_stop() override;
+	virtual void device_pre_save() override;
 	// device_sound_interface overrides
 	virtual void sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs) override;
 	virtual void device_validity_check(validity_checker &valid) const override;
@@ -315,6 +328,25 @@ private:
 	uint32_t m_sound_clock;
 	attotime m_attotime_per_clock;
 	attotime m_last_update_to_current_time;
+
+	struct queued_input
+	{
+		netlist::netlist_time_ext time;
+		void *param;
+		double value;
+		void (*apply)(void *param, double value);
+	};
+
+	static void *run_ahead_callback(void *param, int threadid);
+	void run_ahead_process();
+	void run_ahead_wait();
+
+	bool m_run_ahead;
+	osd_work_queue *m_run_ahead_queue;
+	std::mutex m_input_lock;
+	std::vector<queued_input> m_inputs;         // guarded by m_input_lock
+	bool m_run_ahead_busy;                      // guarded by m_input_lock
+	std::vector<queued_input> m_worker_inputs;  // worker only
 };
 
 // ----------------------------------------------------------------------------------------
@@ -352,6 +384,21 @@ public:
 		}
 	}
 
+	inline bool run_ahead() const { return m_sound != nullptr && m_sound->run_ahead(); }
+
+	// set a parameter at the current machine time
+	template <typename T, typename V>
+	void set_param(netlist::param_num_t<T> &param, V value)
+	{
+		if (run_ahead())
+			m_sound->queue_input(param, static_cast<T>(value));
+		else
+		{
+			update_to_current_time();
+			param.set(static_cast<T>(value));
+		}
+	}
+
 	void set_mult_offset(const double mult, const double offset);
 
 	netlist_mame_sound_device *sound() { return m_sound;}
@@ -410,6 +457,7 @@ private:
 	bool   m_auto_port;
 	const char *m_param_name;
 	double m_value_to_sync;
+	double m_last_queued;                       // last value passed to sync_callback
 };
 
 // ----------------------------------------------------------------------------------------
@@ -511,6 +559,7 @@ private:
 	uint32_t m_mask;
 	uint32_t m_shift;
 	const char *m_param_name;
+	uint32_t m_last_queued;                     // last value passed to sync_callback
 };
 
 
@@ -552,6 +601,7 @@ private:
 	netlist::param_num_t<bool> *m_param;
 	uint32_t m_shift;
 	const char *m_param_name;
+	uint32_t m_last_queued;                     // last value passed to sync_callback
 };
 
 // ----------------------------------------------------------------------------------------
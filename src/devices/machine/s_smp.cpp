@@ -89,8 +89,7 @@ void s_smp_device::device_start()
 	space(AS_DATA).specific(m_data);
 	space(AS_DATA).cache(m_dcache);
 
-	m_tick_timer = timer_alloc(FUNC(s_smp_device::update_timers), this);
-
+	save_item(NAME(m_timer_cycles));
 	save_item(NAME(m_timer_enabled));
 	save_item(NAME(m_subcounter));
 	save_item(NAME(m_counter));
@@ -129,22 +128,10 @@ void s_smp_device::device_reset()
 		m_subcounter[i] = 0;
 	}
 
-	attotime period = attotime::from_ticks(32, clock());
-	m_tick_timer->adjust(period, 0, period);
+	m_timer_cycles = total_cycles();
 	spc700_device::device_reset();
 }
 
-//-------------------------------------------------
-//  device_clock_changed - called if the clock
-//  changes
-//-------------------------------------------------
-
-void s_smp_device::device_clock_changed()
-{
-	attotime period = attotime::from_ticks(32, clock());
-	m_tick_timer->adjust(period, 0, period);
-}
-
 //-------------------------------------------------
 //  memory_space_config - return a description of
 //  any address spaces owned by this device
@@ -158,31 +145,45 @@ device_memory_interface::space_config_vector s_smp_device::memory_space_config()
 	};
 }
 
-inline void s_smp_device::update_timer_tick(u8 which)
+inline void s_smp_device::advance_timer(u8 which, u64 ticks)
 {
 	if (m_timer_enabled[which] == false)
 		return;
 
-	m_subcounter[which]++;
-
 	// if timer channel is 0 or 1 we update at 64000/8
-	if (m_subcounter[which] >= 8 || which == 2)
+	u64 steps = ticks;
+	if (which != 2)
 	{
-		m_subcounter[which] = 0;
-		m_counter[which]++;
-		if (m_counter[which] >= m_TnDIV[which] ) // minus =
-		{
-			m_counter[which] = 0;
-			m_counter_reg[which]++;
-			m_counter_reg[which] &= 0x0f;
-		}
+		steps = (m_subcounter[which] + ticks) / 8;
+		m_subcounter[which] = (m_subcounter[which] + ticks) % 8;
+	}
+	if (!steps)
+		return;
+
+	// a divider written below the current count wraps on the next step
+	if (m_counter[which] >= m_TnDIV[which])
+	{
+		steps--;
+		m_counter[which] = 0;
+		m_counter_reg[which] = (m_counter_reg[which] + 1) & 0x0f;
 	}
+
+	u64 const count = m_counter[which] + steps;
+	m_counter[which] = count % m_TnDIV[which];
+	m_counter_reg[which] = (m_counter_reg[which] + count / m_TnDIV[which]) & 0x0f;
 }
 
-TIMER_CALLBACK_MEMBER(s_smp_device::update_timers)
+// the timers tick at 64kHz; rather than ending a timeslice for every tick, they're
+// advanced from the cycle count whenever the program can observe or change them
+void s_smp_device::update_timers()
 {
+	u64 const ticks = (total_cycles() - m_timer_cycles) / 32;
+	if (!ticks)
+		return;
+
+	m_timer_cycles += ticks * 32;
 	for (int ch = 0; ch < 3; ch++)
-		update_timer_tick(ch);
+		advance_timer(ch, ticks);
 }
 
 
@@ -223,6 +224,7 @@ u8 s_smp_device::io_r(offs_t offset)
 		case 0xe:       /* Counter 1 */
 		case 0xf:       /* Counter 2 */
 		{
+			update_timers();
 			u8 value = m_counter_reg[offset - 0xd] & 0x0f;
 			if (!machine().side_effects_disabled())
 				m_counter_reg[offset - 0xd] = 0;
@@ -242,6 +244,7 @@ void s_smp_device::io_w(offs_t offset, u8 data)
 			logerror("Warning: write to SOUND TEST register with data %02x!\n", data);
 			break;
 		case 0x1:       /* Control */
+			update_timers();
 			m_ctrl = data;
 			for (int i = 0; i < 3; i++)
 			{
@@ -280,12 +283,13 @@ void s_smp_device::io_w(offs_t offset, u8 data)
 		case 0x7:       /* Port 3 */
 			// osd_printf_debug("%s SPC: %02x to APU @ %d\n", machine().describe_context(), data, offset & 3);
 			m_port_out[offset - 4] = data;
-			// Unneeded, we already run at perfect_interleave
-			// machine().scheduler().perfect_quantum(attotime::from_usec(20));
+			// keep the CPUs in step while they talk, so the S-CPU sees the reply promptly
+			machine().scheduler().perfect_quantum(attotime::from_usec(20));
 			break;
 		case 0xa:       /* Timer 0 */
 		case 0xb:       /* Timer 1 */
 		case 0xc:       /* Timer 2 */
+			update_timers();
 			// if 0 then TnDiv is divided by 256, otherwise it's divided by 1 to 255
 			if (data == 0)
 				m_TnDIV[offset - 0xa] = 256;
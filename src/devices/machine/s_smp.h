@@ -30,9 +30,6 @@ protected:
 	tiny_rom_entry const *device_rom_region() const override;
 	virtual void device_start() override;
 	virtual void device_reset() override;
-	virtual void device_clock_changed() override;
-
-	TIMER_CALLBACK_MEMBER(update_timers);
 
 	// device_memory_interface configuration
 	virtual space_config_vector memory_space_config() const override;
@@ -57,12 +54,13 @@ private:
 	u8 io_r(offs_t offset);
 	void io_w(offs_t offset, u8 data);
 
-	/* timers */
-	emu_timer             *m_tick_timer;
+	/* timers, brought up to date from the cycle count when accessed */
+	u64                   m_timer_cycles;   /* cycle count at the last 64kHz tick accounted for */
 	bool                  m_timer_enabled[3];
 	u16                   m_counter[3];
 	u8                    m_subcounter[3];
-	inline void update_timer_tick(u8 which);
+	void update_timers();
+	inline void advance_timer(u8 which, u64 ticks);
 
 	/* IO ports */
 	u8                    m_port_in[4];         /* SPC input ports */
@@ -14,6 +14,7 @@
 #include "gba_lcd.h"
 
 #include "screen.h"
+#include "video/rgbutil.h"
 
 #include <cstdarg>
 
@@ -155,6 +156,8 @@ gba_lcd_device::gba_lcd_device(const machine_config &mconfig, const char *tag, d
 	, m_int_vcount_cb(*this)
 	, m_dma_hblank_cb(*this)
 	, m_dma_vblank_cb(*this)
+	, m_line_queue(nullptr)
+	, m_batches_queued(0)
 {
 }
 
@@ -176,6 +179,11 @@ inline bool gba_lcd_device::is_set(dispcnt flag)
 	return DISPCNT & underlying_value(flag);
 }
 
+inline bool gba_lcd_device::line_batch::is_set(dispcnt flag)
+{
+	return DISPCNT & underlying_value(flag);
+}
+
 inline void gba_lcd_device::set(dispstat flag)
 {
 	DISPSTAT_SET(underlying_value(flag));
@@ -191,27 +199,27 @@ inline bool gba_lcd_device::is_set(dispstat flag)
 	return DISPSTAT & underlying_value(flag);
 }
 
-inline bool gba_lcd_device::is_set(uint16_t bgxcnt, bgcnt flag)
+inline bool gba_lcd_device::line_batch::is_set(uint16_t bgxcnt, bgcnt flag)
 {
 	return bgxcnt & underlying_value(flag);
 }
 
-inline uint8_t gba_lcd_device::bg_priority(uint16_t bgxcnt)
+inline uint8_t gba_lcd_device::line_batch::bg_priority(uint16_t bgxcnt)
 {
 	return bgxcnt & 0x0003;
 }
 
-inline uint32_t gba_lcd_device::bg_char_base(uint16_t bgxcnt)
+inline uint32_t gba_lcd_device::line_batch::bg_char_base(uint16_t bgxcnt)
 {
 	return ((bgxcnt & 0x003c) >> 2) * 0x4000;
 }
 
-inline uint32_t gba_lcd_device::bg_screen_base(uint16_t bgxcnt)
+inline uint32_t gba_lcd_device::line_batch::bg_screen_base(uint16_t bgxcnt)
 {
 	return ((bgxcnt & 0x1f00) >> 8) * 0x800;
 }
 
-inline void gba_lcd_device::bg_screen_size(uint16_t bgxcnt, bool text, int &width, int &height)
+inline void gba_lcd_device::line_batch::bg_screen_size(uint16_t bgxcnt, bool text, int &width, int &height)
 {
 	static int const size_table[2][4][2] =
 	{
@@ -226,22 +234,22 @@ inline void gba_lcd_device::bg_screen_size(uint16_t bgxcnt, bool text, int &widt
 	height = size_table[mode][size][1];
 }
 
-inline uint16_t gba_lcd_device::mosaic_size(size_type type)
+inline uint16_t gba_lcd_device::line_batch::mosaic_size(size_type type)
 {
 	return ((MOSAIC >> (4 * underlying_value(type))) & 0xf) + 1;
 }
 
-inline gba_lcd_device::sfx gba_lcd_device::color_sfx()
+inline gba_lcd_device::sfx gba_lcd_device::line_batch::color_sfx()
 {
 	return enum_value<sfx>(BLDCNT & 0x00c0);
 }
 
-inline uint8_t gba_lcd_device::color_sfx_target(target id)
+inline uint8_t gba_lcd_device::line_batch::color_sfx_target(target id)
 {
 	return (BLDCNT >> (8 * underlying_value(id))) & 0x3f;
 }
 
-inline void gba_lcd_device::update_mask(uint8_t* mask, int y)
+inline void gba_lcd_device::line_batch::update_mask(uint8_t* mask, int y)
 {
 	bool inwin0 = false;
 	bool inwin1 = false;
@@ -267,9 +275,19 @@ inline void gba_lcd_device::update_mask(uint8_t* mask, int y)
 	}
 }
 
-void gba_lcd_device::draw_scanline(int y)
+void gba_lcd_device::line_batch::draw()
+{
+	for (uint32_t i = 0; i < count; i++)
+		draw_scanline(lines[i]);
+}
+
+void gba_lcd_device::line_batch::draw_scanline(const line_latch &line)
 {
-	uint16_t *const scanline = &m_bitmap.pix(y);
+	std::copy(std::begin(line.regs), std::end(line.regs), m_regs);
+	m_mode = line.mode;
+
+	int const y = line.y;
+	uint16_t *const scanline = &lcd->m_bitmap.pix(y);
 
 	if (is_set(dispcnt::forced_blank))
 	{
@@ -280,7 +298,7 @@ void gba_lcd_device::draw_scanline(int y)
 		return;
 	}
 
-	uint8_t mode = bg_video_mode();
+	uint8_t mode = m_mode;
 
 	uint8_t submode;
 	if (is_set(dispcnt::win0_en) || is_set(dispcnt::win1_en) || is_set(dispcnt::obj_win_en))
@@ -319,16 +337,16 @@ void gba_lcd_device::draw_scanline(int y)
 	case 1:
 		draw_bg_scanline(m_scanline[0], y, dispcnt::bg0_en, BG0CNT, BG0HOFS, BG0VOFS);
 		draw_bg_scanline(m_scanline[1], y, dispcnt::bg1_en, BG1CNT, BG1HOFS, BG1VOFS);
-		draw_roz_scanline(m_scanline[2], y, dispcnt::bg2_en, BG2CNT, BG2X, BG2Y, BG2PA, BG2PB, BG2PC, BG2PD, m_bg2x, m_bg2y);
+		draw_roz_scanline(m_scanline[2], y, dispcnt::bg2_en, BG2CNT, BG2PA, BG2PB, BG2PC, BG2PD, line.bg2x, line.bg2y);
 		break;
 	case 2:
-		draw_roz_scanline(m_scanline[2], y, dispcnt::bg2_en, BG2CNT, BG2X, BG2Y, BG2PA, BG2PB, BG2PC, BG2PD, m_bg2x, m_bg2y);
-		draw_roz_scanline(m_scanline[3], y, dispcnt::bg3_en, BG3CNT, BG3X, BG3Y, BG3PA, BG3PB, BG3PC, BG3PD, m_bg3x, m_bg3y);
+		draw_roz_scanline(m_scanline[2], y, dispcnt::bg2_en, BG2CNT, BG2PA, BG2PB, BG2PC, BG2PD, line.bg2x, line.bg2y);
+		draw_roz_scanline(m_scanline[3], y, dispcnt::bg3_en, BG3CNT, BG3PA, BG3PB, BG3PC, BG3PD, line.bg3x, line.bg3y);
 		break;
 	case 3:
 	case 4:
 	case 5:
-		draw_roz_bitmap_scanline(m_scanline[2], y, dispcnt::bg2_en, BG2CNT, BG2X, BG2Y, BG2PA, BG2PB, BG2PC, BG2PD, m_bg2x, m_bg2y, depth);
+		draw_roz_bitmap_scanline(m_scanline[2], y, dispcnt::bg2_en, BG2CNT, BG2X, BG2Y, BG2PA, BG2PB, BG2PC, BG2PD, line.bg2x, line.bg2y, depth);
 		break;
 	}
 
@@ -347,7 +365,7 @@ void gba_lcd_device::draw_scanline(int y)
 		memset(mask, 0xff, sizeof(mask));
 	}
 
-	uint32_t backdrop = ((uint16_t *)m_pram.get())[0] | 0x30000000;
+	uint32_t backdrop = ((uint16_t *)lcd->m_pram.get())[0] | 0x30000000;
 
 	for (auto x = 0; x < 240; x++)
 	{
@@ -442,14 +460,14 @@ void gba_lcd_device::draw_scanline(int y)
 	}
 }
 
-void gba_lcd_device::draw_roz_bitmap_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, int32_t X, int32_t Y, int32_t PA, int32_t PB, int32_t PC, int32_t PD, internal_reg &currentx, internal_reg &currenty, int depth)
+void gba_lcd_device::line_batch::draw_roz_bitmap_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, int32_t X, int32_t Y, int32_t PA, int32_t PB, int32_t PC, int32_t PD, int32_t currentx, int32_t currenty, int depth)
 {
 	if (!is_set(bg_enable))
 		return;
 
-	uint8_t *src8 = (uint8_t *)m_vram.get();
-	uint16_t *src16 = (uint16_t *)m_vram.get();
-	uint16_t *palette = (uint16_t *)m_pram.get();
+	uint8_t *src8 = (uint8_t *)lcd->m_vram.get();
+	uint16_t *src16 = (uint16_t *)lcd->m_vram.get();
+	uint16_t *palette = (uint16_t *)lcd->m_pram.get();
 	int32_t sx = (depth == 4) ? 160 : 240;
 	int32_t sy = (depth == 4) ? 128 : 160;
 	uint32_t prio = (bg_priority(ctrl) << 25) + 0x1000000;
@@ -471,28 +489,8 @@ void gba_lcd_device::draw_roz_bitmap_scanline(uint32_t *scanline, int ypos, disp
 	if (PC & 0x8000) PC |= 0xffff0000;
 	if (PD & 0x8000) PD |= 0xffff0000;
 
-	if (currentx.update)
-	{
-		currentx.status = X;
-		currentx.update = false;
-	}
-	else
-	{
-		currentx.status += PB;
-	}
-
-	if (currenty.update)
-	{
-		currenty.status = Y;
-		currenty.update = false;
-	}
-	else
-	{
-		currenty.status += PD;
-	}
-
-	int32_t cx = currentx.status;
-	int32_t cy = currenty.status;
+	int32_t cx = currentx;
+	int32_t cy = currenty;
 
 	if (is_set(ctrl, bgcnt::mosaic_en))
 	{
@@ -548,13 +546,13 @@ void gba_lcd_device::draw_roz_bitmap_scanline(uint32_t *scanline, int ypos, disp
 	}
 }
 
-void gba_lcd_device::draw_roz_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, int32_t X, int32_t Y, int32_t PA, int32_t PB, int32_t PC, int32_t PD, internal_reg &currentx, internal_reg &currenty)
+void gba_lcd_device::line_batch::draw_roz_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, int32_t PA, int32_t PB, int32_t PC, int32_t PD, int32_t currentx, int32_t currenty)
 {
 	if (!is_set(bg_enable))
 		return;
 
-	uint8_t *mgba_vram = (uint8_t *)m_vram.get();
-	uint16_t *pgba_pram = (uint16_t *)m_pram.get();
+	uint8_t *mgba_vram = (uint8_t *)lcd->m_vram.get();
+	uint16_t *pgba_pram = (uint16_t *)lcd->m_pram.get();
 	uint32_t priority = (bg_priority(ctrl) << 25) + 0x1000000;
 	uint32_t base = bg_char_base(ctrl);
 	uint32_t mapbase = bg_screen_base(ctrl);
@@ -564,35 +562,13 @@ void gba_lcd_device::draw_roz_scanline(uint32_t *scanline, int ypos, dispcnt bg_
 	bg_screen_size(ctrl, false, width, height);
 
 	// sign extend roz parameters
-	if (X & 0x08000000) X |= 0xf0000000;
-	if (Y & 0x08000000) Y |= 0xf0000000;
 	if (PA & 0x8000) PA |= 0xffff0000;
 	if (PB & 0x8000) PB |= 0xffff0000;
 	if (PC & 0x8000) PC |= 0xffff0000;
 	if (PD & 0x8000) PD |= 0xffff0000;
 
-	if (currentx.update)
-	{
-		currentx.status = X;
-		currentx.update = false;
-	}
-	else
-	{
-		currentx.status += PB;
-	}
-
-	if (currenty.update)
-	{
-		currenty.status = Y;
-		currenty.update = false;
-	}
-	else
-	{
-		currenty.status += PD;
-	}
-
-	int32_t cx = currentx.status;
-	int32_t cy = currenty.status;
+	int32_t cx = currentx;
+	int32_t cy = currenty;
 
 	if (is_set(ctrl, bgcnt::mosaic_en))
 	{
@@ -672,13 +648,13 @@ void gba_lcd_device::draw_roz_scanline(uint32_t *scanline, int ypos, dispcnt bg_
 	}
 }
 
-void gba_lcd_device::draw_bg_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, uint32_t hofs, uint32_t vofs)
+void gba_lcd_device::line_batch::draw_bg_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, uint32_t hofs, uint32_t vofs)
 {
 	if (!is_set(bg_enable))
 		return;
 
-	uint8_t *vram = (uint8_t*)m_vram.get();
-	uint16_t *palette = (uint16_t *)m_pram.get();
+	uint8_t *vram = (uint8_t*)lcd->m_vram.get();
+	uint16_t *palette = (uint16_t *)lcd->m_pram.get();
 	uint8_t *chardata = &vram[bg_char_base(ctrl)];
 	uint16_t *screendata = (uint16_t *)&vram[bg_screen_base(ctrl)];
 	uint32_t priority = (bg_priority(ctrl) << 25) + 0x1000000;
@@ -791,24 +767,24 @@ void gba_lcd_device::draw_bg_scanline(uint32_t *scanline, int ypos, dispcnt bg_e
 	}
 }
 
-void gba_lcd_device::draw_oam_window(uint32_t *scanline, int y)
+void gba_lcd_device::line_batch::draw_oam_window(uint32_t *scanline, int y)
 {
 	if (!is_set(dispcnt::obj_win_en))
 		return;
 
-	uint16_t *oam = (uint16_t *)m_oam.get();
-	uint8_t *src = (uint8_t *)m_vram.get();
+	uint16_t *oam = (uint16_t *)lcd->m_oam.get();
+	uint8_t *src = (uint8_t *)lcd->m_vram.get();
 
 	for (auto obj_index = 127; obj_index >= 0; obj_index--)
 	{
-		object obj(*this, oam, obj_index);
+		object obj(*lcd, oam, obj_index);
 
 		if (obj.mode_enum() != object::mode::window)
 			continue;
 
 		uint32_t tile_number = obj.tile_number();
 
-		if (bg_video_mode() > 2 && tile_number < 0x200)
+		if (m_mode > 2 && tile_number < 0x200)
 			continue;
 
 		int32_t sx = obj.pos_x();
@@ -1058,7 +1034,7 @@ void gba_lcd_device::draw_oam_window(uint32_t *scanline, int y)
 	}
 }
 
-void gba_lcd_device::draw_oam(uint32_t *scanline, int y)
+void gba_lcd_device::line_batch::draw_oam(uint32_t *scanline, int y)
 {
 	if (!is_set(dispcnt::obj_en))
 		return;
@@ -1066,13 +1042,13 @@ void gba_lcd_device::draw_oam(uint32_t *scanline, int y)
 	int32_t mosaiccnt = 0;
 	uint16_t mosaicx = mosaic_size(size_type::obj_h);
 	uint16_t mosaicy = mosaic_size(size_type::obj_v);
-	uint16_t *oam = (uint16_t *)m_oam.get();
-	uint8_t *src = (uint8_t *)m_vram.get();
-	uint16_t *palette = (uint16_t *)m_pram.get();
+	uint16_t *oam = (uint16_t *)lcd->m_oam.get();
+	uint8_t *src = (uint8_t *)lcd->m_vram.get();
+	uint16_t *palette = (uint16_t *)lcd->m_pram.get();
 
 	for (auto obj_index = 0; obj_index < 128; obj_index++)
 	{
-		object obj(*this, oam, obj_index);
+		object obj(*lcd, oam, obj_index);
 
 		if (obj.mode_enum() == object::mode::window)
 			continue;
@@ -1085,7 +1061,7 @@ void gba_lcd_device::draw_oam(uint32_t *scanline, int y)
 
 		uint32_t tile_number = obj.tile_number();
 
-		if (bg_video_mode() > 2 && tile_number < 0x200)
+		if (m_mode > 2 && tile_number < 0x200)
 			continue;
 
 		if (obj.roz())
@@ -1427,7 +1403,7 @@ void gba_lcd_device::draw_oam(uint32_t *scanline, int y)
 	}
 }
 
-inline bool gba_lcd_device::is_in_window_h(int x, int window)
+inline bool gba_lcd_device::line_batch::is_in_window_h(int x, int window)
 {
 	uint16_t reg = (window == 0) ? WIN0H : WIN1H;
 
@@ -1448,7 +1424,7 @@ inline bool gba_lcd_device::is_in_window_h(int x, int window)
 	return false;
 }
 
-inline bool gba_lcd_device::is_in_window_v(int y, int window)
+inline bool gba_lcd_device::line_batch::is_in_window_v(int y, int window)
 {
 	uint16_t reg = (window == 0) ? WIN0V : WIN1V;
 
@@ -1477,69 +1453,63 @@ static int const coeff[32] = {
 	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16
 };
 
-inline uint32_t gba_lcd_device::alpha_blend(uint32_t color0, uint32_t color1)
+// the BGR555 channels of a pixel, one per rgbaint_t lane (alpha unused)
+static inline rgbaint_t unpack_bgr555(uint32_t color)
+{
+	return rgbaint_t(0, (color >> 0) & 0x1f, (color >> 5) & 0x1f, (color >> 10) & 0x1f);
+}
+
+// replace the BGR555 part of a pixel, keeping its priority and flag bits
+static inline uint32_t pack_bgr555(uint32_t color, const rgbaint_t &rgb)
 {
-	int ca = coeff[BLDALPHA & 0x1f];
-	int cb = coeff[(BLDALPHA >> 8) & 0x1f];
+	return (color & 0xffff0000) | (rgb.get_b32() << 10) | (rgb.get_g32() << 5) | rgb.get_r32();
+}
 
+inline uint32_t gba_lcd_device::line_batch::alpha_blend(uint32_t color0, uint32_t color1)
+{
 	if (color0 != TRANSPARENT_PIXEL)
 	{
-		int r0 = (color0 >>  0) & 0x1f;
-		int g0 = (color0 >>  5) & 0x1f;
-		int b0 = (color0 >> 10) & 0x1f;
-		int r1 = (color1 >>  0) & 0x1f;
-		int g1 = (color1 >>  5) & 0x1f;
-		int b1 = (color1 >> 10) & 0x1f;
-		int r = ((r0 * ca) >> 4) + ((r1 * cb) >> 4);
-		int g = ((g0 * ca) >> 4) + ((g1 * cb) >> 4);
-		int b = ((b0 * ca) >> 4) + ((b1 * cb) >> 4);
-
-		if (r > 0x1f) r = 0x1f;
-		if (g > 0x1f) g = 0x1f;
-		if (b > 0x1f) b = 0x1f;
-
-		return (color0 & 0xffff0000) | (b << 10) | (g << 5) | r;
+		rgbaint_t top = unpack_bgr555(color0);
+		rgbaint_t back = unpack_bgr555(color1);
+
+		top.mul_imm(coeff[BLDALPHA & 0x1f]);
+		back.mul_imm(coeff[(BLDALPHA >> 8) & 0x1f]);
+		top.shr_imm(4);
+		back.shr_imm(4);
+		top.add(back);
+		top.min(0x1f);
+
+		return pack_bgr555(color0, top);
 	}
 
 	return color0;
 }
 
-inline uint32_t gba_lcd_device::increase_brightness(uint32_t color)
+inline uint32_t gba_lcd_device::line_batch::increase_brightness(uint32_t color)
 {
-	int cc = coeff[BLDY & 0x1f];
-
-	int r = (color >>  0) & 0x1f;
-	int g = (color >>  5) & 0x1f;
-	int b = (color >> 10) & 0x1f;
+	rgbaint_t rgb = unpack_bgr555(color);
+	rgbaint_t delta = rgb;
 
-	r += ((0x1f - r) * cc) >> 4;
-	g += ((0x1f - g) * cc) >> 4;
-	b += ((0x1f - b) * cc) >> 4;
+	delta.subr_imm(0x1f);
+	delta.mul_imm(coeff[BLDY & 0x1f]);
+	delta.shr_imm(4);
+	rgb.add(delta);
+	rgb.min(0x1f);
 
-	if (r > 0x1f) r = 0x1f;
-	if (g > 0x1f) g = 0x1f;
-	if (b > 0x1f) b = 0x1f;
-
-	return (color & 0xffff0000) | (b << 10) | (g << 5) | r;
+	return pack_bgr555(color, rgb);
 }
 
-inline uint32_t gba_lcd_device::decrease_brightness(uint32_t color)
+inline uint32_t gba_lcd_device::line_batch::decrease_brightness(uint32_t color)
 {
-	int cc = coeff[BLDY & 0x1f];
-
-	int r = (color >>  0) & 0x1f;
-	int g = (color >>  5) & 0x1f;
-	int b = (color >> 10) & 0x1f;
-
-	r -= (r * cc) >> 4;
-	g -= (g * cc) >> 4;
-	b -= (b * cc) >> 4;
+	rgbaint_t rgb = unpack_bgr555(color);
+	rgbaint_t delta = rgb;
 
-	if (r < 0) r = 0;
-	if (g < 0) g = 0;
-	if (b < 0) b = 0;
+	delta.mul_imm(coeff[BLDY & 0x1f]);
+	delta.shr_imm(4);
+	rgb.sub(delta);
+	rgb.max(0);
 
-	return (color & 0xffff0000) | (b << 10) | (g << 5) | r;
+	return pack_bgr555(color, rgb);
 }
 
 static char const *const reg_names[] = {
@@ -1628,6 +1598,7 @@ uint32_t gba_lcd_device::gba_pram_r(offs_t offset)
 
 void gba_lcd_device::gba_pram_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 {
+	flush_scanlines();
 	COMBINE_DATA(&m_pram[offset]);
 }
 
@@ -1638,6 +1609,7 @@ uint32_t gba_lcd_device::gba_vram_r(offs_t offset)
 
 void gba_lcd_device::gba_vram_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 {
+	flush_scanlines();
 	COMBINE_DATA(&m_vram[offset]);
 }
 
@@ -1648,6 +1620,7 @@ uint32_t gba_lcd_device::gba_oam_r(offs_t offset)
 
 void gba_lcd_device::gba_oam_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 {
+	flush_scanlines();
 	COMBINE_DATA(&m_oam[offset]);
 }
 
@@ -1667,7 +1640,7 @@ TIMER_CALLBACK_MEMBER(gba_lcd_device::perform_hbl)
 	// draw only visible scanlines
 	if (scanline < 160)
 	{
-		draw_scanline(scanline);
+		latch_scanline(scanline);
 
 		if (!m_dma_hblank_cb.isnull())
 			m_dma_hblank_cb(ASSERT_LINE);
@@ -1730,6 +1703,104 @@ TIMER_CALLBACK_MEMBER(gba_lcd_device::perform_scan)
 	m_scan_timer->adjust(screen().time_until_pos((scanline + 1) % 228, 0));
 }
 
+void gba_lcd_device::latch_affine(internal_reg &current, uint32_t reference, uint16_t delta)
+{
+	if (current.update)
+	{
+		// 28-bit reference point
+		current.status = util::sext(reference, 28);
+		current.update = false;
+	}
+	else
+	{
+		current.status += int16_t(delta);
+	}
+}
+
+void gba_lcd_device::latch_scanline(int y)
+{
+	line_batch &batch = m_line_batches[m_batches_queued];
+	line_latch &line = batch.lines[batch.count++];
+
+	line.y = y;
+	line.mode = bg_video_mode();
+	std::copy(std::begin(m_regs), std::end(m_regs), line.regs);
+
+	// the affine reference points advance once per drawn line of an enabled rotation/scaling layer
+	if (!is_set(dispcnt::forced_blank))
+	{
+		if (line.mode != 0 && is_set(dispcnt::bg2_en))
+		{
+			latch_affine(m_bg2x, BG2X, BG2PB);
+			latch_affine(m_bg2y, BG2Y, BG2PD);
+		}
+		if (line.mode == 2 && is_set(dispcnt::bg3_en))
+		{
+			latch_affine(m_bg3x, BG3X, BG3PB);
+			latch_affine(m_bg3y, BG3Y, BG3PD);
+		}
+	}
+	line.bg2x = m_bg2x.status;
+	line.bg2y = m_bg2y.status;
+	line.bg3x = m_bg3x.status;
+	line.bg3y = m_bg3y.status;
+
+	if (batch.count == LINE_BATCH)
+		queue_batch();
+}
+
+void gba_lcd_device::flush_scanlines()
+{
+	line_batch &current = m_line_batches[m_batches_queued];
+	if (!m_batches_queued && !current.count)
+		return;
+
+	g_profiler.start(PROFILER_VIDEO);
+
+	// the partial batch is drawn here, so a lone line ahead of a mid-frame VRAM or palette write never touches the queue
+	current.draw();
+	if (m_batches_queued)
+	{
+		// a timed-out wait would leave workers drawing lines while the batches are reset
+		while (!osd_work_queue_wait(m_line_queue, osd_ticks_per_second() * 10)) { }
+	}
+
+	for (uint32_t i = 0; i <= m_batches_queued; i++)
+		m_line_batches[i].count = 0;
+	m_batches_queued = 0;
+
+	g_profiler.stop();
+}
+
+void gba_lcd_device::discard_scanlines()
+{
+	if (m_batches_queued)
+		while (!osd_work_queue_wait(m_line_queue, osd_ticks_per_second() * 10)) { }
+
+	for (uint32_t i = 0; i <= m_batches_queued; i++)
+		m_line_batches[i].count = 0;
+	m_batches_queued = 0;
+}
+
+void gba_lcd_device::queue_batch()
+{
+	if (!m_line_queue)
+	{
+		flush_scanlines();
+		return;
+	}
+
+	osd_work_item_queue(m_line_queue, draw_batch_callback, &m_line_batches[m_batches_queued], WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (++m_batches_queued == MAX_BATCHES)
+		flush_scanlines();
+}
+
+void *gba_lcd_device::draw_batch_callback(void *param, int threadid)
+{
+	static_cast<line_batch *>(param)->draw();
+	return nullptr;
+}
+
 void gba_lcd_device::gba_palette(palette_device &palette) const
 {
 	for (uint8_t b = 0; b < 32; b++)
@@ -1746,6 +1817,7 @@ void gba_lcd_device::gba_palette(palette_device &palette) const
 
 uint32_t gba_lcd_device::screen_update(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect)
 {
+	flush_scanlines();
 	copybitmap(bitmap, m_bitmap, 0, 0, 0, 0, cliprect);
 
 	return 0;
@@ -1789,11 +1861,30 @@ void gba_lcd_device::device_start()
 	save_item(NAME(m_bg3y.status));
 	save_item(NAME(m_bg3y.update));
 
-	save_item(NAME(m_scanline));
+	m_line_batches = std::make_unique<line_batch[]>(MAX_BATCHES);
+	for (unsigned i = 0; i < MAX_BATCHES; i++)
+	{
+		m_line_batches[i].lcd = this;
+		m_line_batches[i].count = 0;
+	}
+	m_line_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
+	// lines queued before a load belong to the discarded state, and the
+	// workers must be done with VRAM, PRAM and OAM before they're overwritten
+	machine().save().register_preload(save_prepost_delegate(FUNC(gba_lcd_device::discard_scanlines), this));
+}
+
+void gba_lcd_device::device_stop()
+{
+	if (m_line_queue)
+		osd_work_queue_free(m_line_queue);
+	m_line_queue = nullptr;
 }
 
 void gba_lcd_device::device_reset()
 {
+	flush_scanlines();
+
 	memset(m_regs, 0, sizeof(m_regs));
 
 	m_bg2x = { 0, false };
@@ -85,6 +85,7 @@ public:
 protected:
 	// device-level overrides
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_reset() override;
 	virtual void device_add_mconfig(machine_config &config) override;
 
@@ -133,12 +134,6 @@ private:
 		palette_256   = 0x0080,
 		wraparound_en = 0x2000
 	};
-	bool is_set(uint16_t bgxcnt, bgcnt flag);
-
-	uint8_t  bg_priority(uint16_t bgxcnt);
-	uint32_t bg_char_base(uint16_t bgxcnt);
-	uint32_t bg_screen_base(uint16_t bgxcnt);
-	void   bg_screen_size(uint16_t bgxcnt, bool text, int &width, int &height);
 
 	enum class size_type
 	{
@@ -147,7 +142,6 @@ private:
 		obj_h,
 		obj_v
 	};
-	uint16_t mosaic_size(size_type type);
 
 	enum class sfx : uint16_t
 	{
@@ -156,33 +150,77 @@ private:
 		lighten = 0x0080,
 		darken  = 0x00c0
 	};
-	sfx color_sfx();
 
 	enum class target
 	{
 		first = 0,
 		second
 	};
-	uint8_t color_sfx_target(target id);
 
-	uint16_t tile_number(uint16_t vram_data) { return vram_data & 0x03ff; }
-	bool   tile_hflip(uint16_t vram_data) { return vram_data & 0x0400; }
-	bool   tile_vflip(uint16_t vram_data) { return vram_data & 0x0800; }
+	// LCD state a scanline is drawn from, latched at H-Blank
+	struct line_latch
+	{
+		int y;
+		uint8_t mode;
+		uint32_t regs[0x060 / 4];
+		int32_t bg2x, bg2y, bg3x, bg3y;     // affine reference points after this line's increment
+	};
 
-	void update_mask(uint8_t *mask, int y);
-	void draw_roz_bitmap_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, int32_t X, int32_t Y, int32_t PA, int32_t PB, int32_t PC, int32_t PD, internal_reg &currentx, internal_reg &currenty, int depth);
-	void draw_roz_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, int32_t X, int32_t Y, int32_t PA, int32_t PB, int32_t PC, int32_t PD, internal_reg &currentx, internal_reg &currenty);
-	void draw_bg_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, uint32_t hofs, uint32_t vofs);
-	void draw_oam_window(uint32_t *scanline, int y);
-	void draw_oam(uint32_t *scanline, int y);
-	void draw_scanline(int y);
+	static constexpr unsigned LINE_BATCH = 16;      // scanlines handed to a worker at once
+	static constexpr unsigned MAX_BATCHES = 8;      // batches in flight before the emulation thread waits
 
-	bool is_in_window_h(int x, int window);
-	bool is_in_window_v(int y, int window);
+	// a run of latched lines plus the layer scratch to draw them; each batch draws independently
+	class line_batch : protected gba_registers<0x060 / 4, 0x000>
+	{
+	public:
+		gba_lcd_device *lcd;
+		line_latch lines[LINE_BATCH];
+		uint32_t count;
+
+		void draw();
+
+	private:
+		void draw_scanline(const line_latch &line);
+
+		bool is_set(dispcnt flag);
+		bool is_set(uint16_t bgxcnt, bgcnt flag);
+
+		uint8_t  bg_priority(uint16_t bgxcnt);
+		uint32_t bg_char_base(uint16_t bgxcnt);
+		uint32_t bg_screen_base(uint16_t bgxcnt);
+		void   bg_screen_size(uint16_t bgxcnt, bool text, int &width, int &height);
+		uint16_t mosaic_size(size_type type);
+		sfx color_sfx();
+		uint8_t color_sfx_target(target id);
+
+		uint16_t tile_number(uint16_t vram_data) { return vram_data & 0x03ff; }
+		bool   tile_hflip(uint16_t vram_data) { return vram_data & 0x0400; }
+		bool   tile_vflip(uint16_t vram_data) { return vram_data & 0x0800; }
+
+		void update_mask(uint8_t *mask, int y);
+		void draw_roz_bitmap_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, int32_t X, int32_t Y, int32_t PA, int32_t PB, int32_t PC, int32_t PD, int32_t currentx, int32_t currenty, int depth);
+		void draw_roz_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, int32_t PA, int32_t PB, int32_t PC, int32_t PD, int32_t currentx, int32_t currenty);
+		void draw_bg_scanline(uint32_t *scanline, int ypos, dispcnt bg_enable, uint32_t ctrl, uint32_t hofs, uint32_t vofs);
+		void draw_oam_window(uint32_t *scanline, int y);
+		void draw_oam(uint32_t *scanline, int y);
+
+		bool is_in_window_h(int x, int window);
+		bool is_in_window_v(int y, int window);
+
+		uint32_t alpha_blend(uint32_t color0, uint32_t color1);
+		uint32_t increase_brightness(uint32_t color);
+		uint32_t decrease_brightness(uint32_t color);
+
+		uint8_t m_mode;
+		uint32_t m_scanline[6][240];
+	};
 
-	uint32_t alpha_blend(uint32_t color0, uint32_t color1);
-	uint32_t increase_brightness(uint32_t color);
-	uint32_t decrease_brightness(uint32_t color);
+	void latch_scanline(int y);
+	void latch_affine(internal_reg &current, uint32_t reference, uint16_t delta);
+	void flush_scanlines();
+	void discard_scanlines();
+	void queue_batch();
+	static void *draw_batch_callback(void *param, int threadid);
 
 	uint32_t screen_update(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect);
 	void gba_palette(palette_device &palette) const;
@@ -201,7 +239,10 @@ private:
 
 	bitmap_ind16 m_bitmap;
 
-	uint32_t m_scanline[6][240];
+	// deferred scanline drawing: lines queue up until VRAM, palette or OAM changes or the frame is shown
+	osd_work_queue *m_line_queue;
+	std::unique_ptr<line_batch[]> m_line_batches;
+	uint32_t m_batches_queued;  // m_line_batches[m_batches_queued] is the batch being filled
 
 	// constants
 	static constexpr uint32_t TRANSPARENT_PIXEL = 0x80000000;
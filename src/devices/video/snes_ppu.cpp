@@ -193,6 +193,8 @@ snes_ppu_device::snes_ppu_device(const machine_config &mconfig, const char *tag,
 	: device_t(mconfig, SNES_PPU, tag, owner, clock)
 	, device_video_interface(mconfig, *this)
 	, device_palette_interface(mconfig, *this)
+	, m_line_queue(nullptr)
+	, m_batches_queued(0)
 	, m_openbus_cb(*this)
 	, m_options(*this, ":OPTIONS")
 	, m_debug1(*this, ":DEBUG1")
@@ -251,12 +253,20 @@ void snes_ppu_device::device_start()
 		}
 	}
 
-	save_item(STRUCT_MEMBER(m_scanlines, enable));
-	save_item(STRUCT_MEMBER(m_scanlines, clip));
-	save_item(STRUCT_MEMBER(m_scanlines, buffer));
-	save_item(STRUCT_MEMBER(m_scanlines, priority));
-	save_item(STRUCT_MEMBER(m_scanlines, layer));
-	save_item(STRUCT_MEMBER(m_scanlines, blend_exception));
+	m_line_batches = std::make_unique<line_batch[]>(MAX_BATCHES);
+	for (unsigned i = 0; i < MAX_BATCHES; i++)
+	{
+		m_line_batches[i].ppu = this;
+		m_line_batches[i].count = 0;
+		m_line_batches[i].stat77 = 0;
+	}
+#if !SNES_LAYER_DEBUG
+	// the debug toggles poll inputs while drawing, so that build always draws on the emulation thread
+	m_line_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	// lines queued before a load belong to the discarded state, and the
+	// workers must be done with VRAM, CGRAM and OAM before they're overwritten
+	machine().save().register_preload(save_prepost_delegate(FUNC(snes_ppu_device::discard_batches), this));
+#endif
 
 	save_item(STRUCT_MEMBER(m_layer, window1_enabled));
 	save_item(STRUCT_MEMBER(m_layer, window1_invert));
@@ -368,8 +378,21 @@ void snes_ppu_device::device_start()
 	save_pointer(NAME(m_cgram), SNES_CGRAM_SIZE/2);
 }
 
+//-------------------------------------------------
+//  device_stop - device-specific shutdown
+//-------------------------------------------------
+
+void snes_ppu_device::device_stop()
+{
+	if (m_line_queue)
+		osd_work_queue_free(m_line_queue);
+	m_line_queue = nullptr;
+}
+
 void snes_ppu_device::device_reset()
 {
+	flush_scanlines();
+
 #if SNES_LAYER_DEBUG
 	memset(&m_debug_options, 0, sizeof(m_debug_options));
 #endif
@@ -418,15 +441,6 @@ void snes_ppu_device::device_reset()
 	memset(&m_oam, 0, sizeof(m_oam));
 	memset(&m_mode7, 0, sizeof(m_mode7));
 
-	for (auto & elem : m_scanlines)
-	{
-		elem.enable = 0;
-		elem.clip = 0;
-		memset(elem.buffer, 0, SNES_SCR_WIDTH * sizeof(uint16_t));
-		memset(elem.priority, 0, SNES_SCR_WIDTH);
-		memset(elem.layer, 0, SNES_SCR_WIDTH);
-		memset(elem.blend_exception, 0, SNES_SCR_WIDTH);
-	}
 
 	for (int i = 0; i < 6; i++)
 	{
@@ -475,51 +489,59 @@ void snes_ppu_device::device_reset()
  * XNOR: ###...##...###     ...###..###...
  *****************************************/
 
-void snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output)
+uint8_t snes_ppu_device::window_lut(const layer_t &self) const
 {
-	layer_t &self = m_layer[layer_idx];
-	if (!enable || (!self.window1_enabled && !self.window2_enabled))
-	{
-		memset(output, 0, 256);
-		return;
-	}
-
-	if (self.window1_enabled && !self.window2_enabled)
+	/* bit n is the mask for a pixel inside window 1 (n & 1) and/or window 2 (n & 2) */
+	uint8_t lut = 0;
+	for (int n = 0; n < 4; n++)
 	{
-		const uint8_t set = 1 ^ self.window1_invert;
-		const uint8_t clear = 1 - set;
-		for (uint16_t x = 0; x < 256; x++)
+		const uint8_t one_mask = BIT(n, 0) ^ self.window1_invert;
+		const uint8_t two_mask = BIT(n, 1) ^ self.window2_invert;
+		uint8_t mask = 0;
+		if (self.window1_enabled && self.window2_enabled)
 		{
-			output[x] = (x >= m_window1_left && x <= m_window1_right) ? set : clear;
+			switch (self.wlog_mask)
+			{
+				case 0: mask = one_mask | two_mask; break;
+				case 1: mask = one_mask & two_mask; break;
+				case 2: mask = one_mask ^ two_mask; break;
+				case 3: mask = 1 - (one_mask ^ two_mask); break;
+			}
 		}
-		return;
+		else if (self.window1_enabled)
+			mask = one_mask;
+		else if (self.window2_enabled)
+			mask = two_mask;
+		lut |= (mask & 1) << n;
 	}
+	return lut;
+}
 
-	if (self.window2_enabled && !self.window1_enabled)
+void snes_ppu_device::fill_window(uint8_t lut, uint8_t *output) const
+{
+	if (lut == 0x0 || lut == 0xf)
 	{
-		const uint8_t set = 1 ^ self.window2_invert;
-		const uint8_t clear = 1 - set;
-		for (uint16_t x = 0; x < 256; x++)
-		{
-			output[x] = (x >= m_window2_left && x <= m_window2_right) ? set : clear;
-		}
+		memset(output, lut & 1, 256);
 		return;
 	}
 
-	for (uint16_t x = 0; x < 256; x++)
+	/* branch-free so the compiler can run it across SIMD lanes */
+	const int left1 = m_window1_left, right1 = m_window1_right;
+	const int left2 = m_window2_left, right2 = m_window2_right;
+	const uint8_t m0 = BIT(lut, 0), m1 = BIT(lut, 1), m2 = BIT(lut, 2), m3 = BIT(lut, 3);
+	for (int x = 0; x < 256; x++)
 	{
-		uint8_t one_mask = ((x >= m_window1_left && x <= m_window1_right) ? 1 : 0) ^ self.window1_invert;
-		uint8_t two_mask = ((x >= m_window2_left && x <= m_window2_right) ? 1 : 0) ^ self.window2_invert;
-		switch (self.wlog_mask)
-		{
-			case 0: output[x] = (one_mask | two_mask); break;
-			case 1: output[x] = (one_mask & two_mask); break;
-			case 2: output[x] = (one_mask ^ two_mask); break;
-			case 3: output[x] = 1 - (one_mask ^ two_mask); break;
-		}
+		const uint8_t in1 = (x >= left1) & (x <= right1);
+		const uint8_t in2 = (x >= left2) & (x <= right2);
+		output[x] = (m0 & ~in1 & ~in2) | (m1 & in1 & ~in2) | (m2 & ~in1 & in2) | (m3 & in1 & in2);
 	}
 }
 
+void snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output)
+{
+	fill_window(enable ? window_lut(m_layer[layer_idx]) : 0, output);
+}
+
 /*************************************************************************************************
  * SNES BG layers
  *
@@ -555,38 +577,38 @@ inline uint32_t snes_ppu_device::get_tile( uint8_t layer_idx, uint32_t hoffset,
 }
 
 /*********************************************
- * plot_above()
+ * plot_above(scanlines, x, source, priority, color, blend_exception)
  *
  * Update a main-screen pixel based on
  * priority.
  *********************************************/
 
-inline void snes_ppu_device::plot_above( uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception )
+inline void snes_ppu_device::plot_above( SNES_SCANLINE *scanlines, uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception )
 {
-	if (priority > m_scanlines[SNES_MAINSCREEN].priority[x])
+	if (priority > scanlines[SNES_MAINSCREEN].priority[x])
 	{
-		m_scanlines[SNES_MAINSCREEN].priority[x] = priority;
-		m_scanlines[SNES_MAINSCREEN].buffer[x] = color;
-		m_scanlines[SNES_MAINSCREEN].layer[x] = source;
-		m_scanlines[SNES_MAINSCREEN].blend_exception[x] = blend_exception;
+		scanlines[SNES_MAINSCREEN].priority[x] = priority;
+		scanlines[SNES_MAINSCREEN].buffer[x] = color;
+		scanlines[SNES_MAINSCREEN].layer[x] = source;
+		scanlines[SNES_MAINSCREEN].blend_exception[x] = blend_exception;
 	}
 }
 
 /*********************************************
- * plot_below()
+ * plot_below(scanlines, x, source, priority, color, blend_exception)
  *
  * Update a sub-screen pixel based on
  * priority.
  *********************************************/
 
-inline void snes_ppu_device::plot_below( uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception )
+inline void snes_ppu_device::plot_below( SNES_SCANLINE *scanlines, uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception )
 {
-	if (priority > m_scanlines[SNES_SUBSCREEN].priority[x])
+	if (priority > scanlines[SNES_SUBSCREEN].priority[x])
 	{
-		m_scanlines[SNES_SUBSCREEN].priority[x] = priority;
-		m_scanlines[SNES_SUBSCREEN].buffer[x] = color;
-		m_scanlines[SNES_SUBSCREEN].layer[x] = source;
-		m_scanlines[SNES_SUBSCREEN].blend_exception[x] = blend_exception;
+		scanlines[SNES_SUBSCREEN].priority[x] = priority;
+		scanlines[SNES_SUBSCREEN].buffer[x] = color;
+		scanlines[SNES_SUBSCREEN].layer[x] = source;
+		scanlines[SNES_SUBSCREEN].blend_exception[x] = blend_exception;
 	}
 }
 
@@ -596,7 +618,7 @@ inline void snes_ppu_device::plot_below( uint16_t x, uint8_t source, uint8_t pri
  * Update an entire line of tiles.
  *********************************************/
 
-void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t direct_colors )
+void snes_ppu_device::update_line( SNES_SCANLINE *scanlines, const line_latch &line, uint8_t layer_idx, uint8_t direct_colors )
 {
 	layer_t &layer = m_layer[layer_idx];
 
@@ -607,10 +629,10 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 		return;
 #endif /* SNES_LAYER_DEBUG */
 
-	m_scanlines[SNES_MAINSCREEN].enable = layer.main_bg_enabled;
-	m_scanlines[SNES_SUBSCREEN].enable = layer.sub_bg_enabled;
+	scanlines[SNES_MAINSCREEN].enable = layer.main_bg_enabled;
+	scanlines[SNES_SUBSCREEN].enable = layer.sub_bg_enabled;
 
-	if (!m_scanlines[SNES_MAINSCREEN].enable && !m_scanlines[SNES_SUBSCREEN].enable)
+	if (!scanlines[SNES_MAINSCREEN].enable && !scanlines[SNES_SUBSCREEN].enable)
 	{
 		return;
 	}
@@ -639,12 +661,12 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 	uint32_t hmask = (width << layer.tile_size << (layer.tilemap_size & 1)) - 1;
 	uint32_t vmask = (width << layer.tile_size << ((layer.tilemap_size & 2) >> 1)) - 1;
 
-	uint32_t y = layer.mosaic_enabled ? layer.mosaic_offset : curline;
+	uint32_t y = layer.mosaic_enabled ? line.mosaic_offset[layer_idx] : line.curline;
 
 	if (hires)
 	{
 		hscroll <<= 1;
-		if (m_interlace == 2) y = (y & ~1) | (m_stat78 >> 7);
+		if (m_interlace == 2) y = (y & ~1) | line.field;
 	}
 
 	uint32_t mosaic_counter = 1;
@@ -758,19 +780,19 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 
 			if (!hires)
 			{
-				if (layer.main_bg_enabled && window_above[x] == 0) plot_above(x, layer_idx, mosaic_priority, mosaic_color);
-				if (layer.sub_bg_enabled  && window_below[x] == 0) plot_below(x, layer_idx, mosaic_priority, mosaic_color);
+				if (layer.main_bg_enabled && window_above[x] == 0) plot_above(scanlines, x, layer_idx, mosaic_priority, mosaic_color);
+				if (layer.sub_bg_enabled  && window_below[x] == 0) plot_below(scanlines, x, layer_idx, mosaic_priority, mosaic_color);
 			}
 			else
 			{
 				uint32_t _x = x >> 1;
 				if (x & 1)
 				{
-					if (layer.main_bg_enabled && window_above[_x] == 0) plot_above(_x, layer_idx, mosaic_priority, mosaic_color);
+					if (layer.main_bg_enabled && window_above[_x] == 0) plot_above(scanlines, _x, layer_idx, mosaic_priority, mosaic_color);
 				}
 				else
 				{
-					if (layer.sub_bg_enabled  && window_below[_x] == 0) plot_below(_x, layer_idx, mosaic_priority, mosaic_color);
+					if (layer.sub_bg_enabled  && window_below[_x] == 0) plot_below(scanlines, _x, layer_idx, mosaic_priority, mosaic_color);
 				}
 			}
 		}
@@ -786,10 +808,10 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 
 #define MODE7_CLIP(x) (((x) & 0x2000) ? ((x) | ~0x03ff) : ((x) & 0x03ff))
 
-void snes_ppu_device::update_line_mode7( uint16_t curline, uint8_t layer_idx )
+void snes_ppu_device::update_line_mode7( SNES_SCANLINE *scanlines, const line_latch &line, uint8_t layer_idx )
 {
 	layer_t &self = m_layer[layer_idx];
-	int _y = self.mosaic_enabled ? self.mosaic_offset : curline;
+	int _y = self.mosaic_enabled ? line.mosaic_offset[layer_idx] : line.curline;
 	int y = !m_mode7.vflip ? _y : 255 - _y;
 
 	int a = m_mode7.matrix_a;
@@ -854,8 +876,8 @@ void snes_ppu_device::update_line_mode7( uint16_t curline, uint8_t layer_idx )
 		}
 		if (!mosaic_palette) continue;
 
-		if (self.main_bg_enabled && window_above[_x] == 0) plot_above(_x, layer_idx, mosaic_priority, mosaic_color);
-		if (self.sub_bg_enabled  && window_below[_x] == 0) plot_below(_x, layer_idx, mosaic_priority, mosaic_color);
+		if (self.main_bg_enabled && window_above[_x] == 0) plot_above(scanlines, _x, layer_idx, mosaic_priority, mosaic_color);
+		if (self.sub_bg_enabled  && window_below[_x] == 0) plot_below(scanlines, _x, layer_idx, mosaic_priority, mosaic_color);
 	}
 }
 
@@ -865,15 +887,17 @@ void snes_ppu_device::update_line_mode7( uint16_t curline, uint8_t layer_idx )
  * Update an entire line of sprites.
  *********************************************/
 
-void snes_ppu_device::update_objects( uint16_t curline )
+uint8_t snes_ppu_device::update_objects( SNES_SCANLINE *scanlines, const line_latch &line )
 {
+	const uint16_t curline = line.curline;
+
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.bg_disabled[SNES_OAM])
-		return;
+		return 0;
 #endif /* SNES_LAYER_DEBUG */
 
 	if (!m_layer[SNES_OAM].main_bg_enabled && !m_layer[SNES_OAM].sub_bg_enabled)
-		return;
+		return 0;
 
 	uint8_t window_above[256];
 	uint8_t window_below[256];
@@ -940,7 +964,7 @@ void snes_ppu_device::update_objects( uint16_t curline )
 
 		if (m_oam.interlace)
 		{
-			y = !obj.vflip ? (y + BIT(m_stat78, 7)) : (y - BIT(m_stat78, 7));
+			y = !obj.vflip ? (y + line.field) : (y - line.field);
 		}
 
 		x &= 0x1ff;
@@ -976,13 +1000,15 @@ void snes_ppu_device::update_objects( uint16_t curline )
 		}
 	}
 
+	uint8_t stat77 = 0;
+
 	/* set Range Over flag if necessary */
 	if (item_count > 32)
-		m_stat77 |= 0x40;
+		stat77 |= 0x40;
 
 	/* set Time Over flag if necessary */
 	if (tile_count > 34)
-		m_stat77 |= 0x80;
+		stat77 |= 0x80;
 
 	uint8_t palbuf[256] = {};
 	uint8_t pribuf[256] = {};
@@ -1017,9 +1043,11 @@ void snes_ppu_device::update_objects( uint16_t curline )
 	{
 		if (!pribuf[x]) continue;
 		int blend = (palbuf[x] < 192) ? 1 : 0;
-		if (m_layer[SNES_OAM].main_bg_enabled && window_above[x] == 0) plot_above(x, SNES_OAM, pribuf[x], pen_indirect(palbuf[x]), blend);
-		if (m_layer[SNES_OAM].sub_bg_enabled  && window_below[x] == 0) plot_below(x, SNES_OAM, pribuf[x], pen_indirect(palbuf[x]), blend);
+		if (m_layer[SNES_OAM].main_bg_enabled && window_above[x] == 0) plot_above(scanlines, x, SNES_OAM, pribuf[x], pen_indirect(palbuf[x]), blend);
+		if (m_layer[SNES_OAM].sub_bg_enabled  && window_below[x] == 0) plot_below(scanlines, x, SNES_OAM, pribuf[x], pen_indirect(palbuf[x]), blend);
 	}
+
+	return stat77;
 }
 
 void snes_ppu_device::oam_address_reset( void )
@@ -1030,6 +1058,7 @@ void snes_ppu_device::oam_address_reset( void )
 
 void snes_ppu_device::oam_set_first_object( void )
 {
+	flush_scanlines();
 	m_oam.first = (!m_oam.priority_rotation ? 0 : ((m_oam.address >> 2) & 0x7f));
 }
 
@@ -1040,86 +1069,86 @@ void snes_ppu_device::oam_set_first_object( void )
  * Update Mode X line.
  *********************************************/
 
-void snes_ppu_device::update_mode_0( uint16_t curline )
+void snes_ppu_device::update_mode_0( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[0])
 		return;
 #endif /* SNES_LAYER_DEBUG */
 
-	update_line(curline, SNES_BG1, 0);
-	update_line(curline, SNES_BG2, 0);
-	update_line(curline, SNES_BG3, 0);
-	update_line(curline, SNES_BG4, 0);
+	update_line(scanlines, line, SNES_BG1, 0);
+	update_line(scanlines, line, SNES_BG2, 0);
+	update_line(scanlines, line, SNES_BG3, 0);
+	update_line(scanlines, line, SNES_BG4, 0);
 }
 
-void snes_ppu_device::update_mode_1( uint16_t curline )
+void snes_ppu_device::update_mode_1( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[1])
 		return;
 #endif /* SNES_LAYER_DEBUG */
 
-	update_line(curline, SNES_BG1, 0);
-	update_line(curline, SNES_BG2, 0);
-	update_line(curline, SNES_BG3, 0);
+	update_line(scanlines, line, SNES_BG1, 0);
+	update_line(scanlines, line, SNES_BG2, 0);
+	update_line(scanlines, line, SNES_BG3, 0);
 }
 
-void snes_ppu_device::update_mode_2( uint16_t curline )
+void snes_ppu_device::update_mode_2( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[2])
 		return;
 #endif /* SNES_LAYER_DEBUG */
 
-	update_line(curline, SNES_BG1, 0);
-	update_line(curline, SNES_BG2, 0);
+	update_line(scanlines, line, SNES_BG1, 0);
+	update_line(scanlines, line, SNES_BG2, 0);
 }
 
-void snes_ppu_device::update_mode_3( uint16_t curline )
+void snes_ppu_device::update_mode_3( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[3])
 		return;
 #endif /* SNES_LAYER_DEBUG */
 
-	update_line(curline, SNES_BG1, m_direct_color);
-	update_line(curline, SNES_BG2, 0);
+	update_line(scanlines, line, SNES_BG1, m_direct_color);
+	update_line(scanlines, line, SNES_BG2, 0);
 }
 
-void snes_ppu_device::update_mode_4( uint16_t curline )
+void snes_ppu_device::update_mode_4( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[4])
 		return;
 #endif /* SNES_LAYER_DEBUG */
 
-	update_line(curline, SNES_BG1, m_direct_color);
-	update_line(curline, SNES_BG2, 0);
+	update_line(scanlines, line, SNES_BG1, m_direct_color);
+	update_line(scanlines, line, SNES_BG2, 0);
 }
 
-void snes_ppu_device::update_mode_5( uint16_t curline )
+void snes_ppu_device::update_mode_5( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[5])
 		return;
 #endif /* SNES_LAYER_DEBUG */
 
-	update_line(curline, SNES_BG1, 0);
-	update_line(curline, SNES_BG2, 0);
+	update_line(scanlines, line, SNES_BG1, 0);
+	update_line(scanlines, line, SNES_BG2, 0);
 }
 
-void snes_ppu_device::update_mode_6( uint16_t curline )
+void snes_ppu_device::update_mode_6( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[6])
 		return;
 #endif /* SNES_LAYER_DEBUG */
 
-	update_line(curline, SNES_BG1, 0);
+	update_line(scanlines, line, SNES_BG1, 0);
 }
 
-void snes_ppu_device::update_mode_7( uint16_t curline )
+void snes_ppu_device::update_mode_7( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[7])
@@ -1128,12 +1157,12 @@ void snes_ppu_device::update_mode_7( uint16_t curline )
 
 	if (!m_mode7.extbg)
 	{
-		update_line_mode7(curline, SNES_BG1);
+		update_line_mode7(scanlines, line, SNES_BG1);
 	}
 	else
 	{
-		update_line_mode7(curline, SNES_BG1);
-		update_line_mode7(curline, SNES_BG2);
+		update_line_mode7(scanlines, line, SNES_BG1);
+		update_line_mode7(scanlines, line, SNES_BG2);
 	}
 }
 
@@ -1143,18 +1172,18 @@ void snes_ppu_device::update_mode_7( uint16_t curline )
  * Draw the whole screen (Mode 0 -> 7).
  *********************************************/
 
-void snes_ppu_device::draw_screens( uint16_t curline )
+void snes_ppu_device::draw_screens( SNES_SCANLINE *scanlines, const line_latch &line )
 {
 	switch (m_mode)
 	{
-		case 0: update_mode_0(curline); break;     /* Mode 0 */
-		case 1: update_mode_1(curline); break;     /* Mode 1 */
-		case 2: update_mode_2(curline); break;     /* Mode 2 - Supports offset per tile */
-		case 3: update_mode_3(curline); break;     /* Mode 3 - Supports direct colour */
-		case 4: update_mode_4(curline); break;     /* Mode 4 - Supports offset per tile and direct colour */
-		case 5: update_mode_5(curline); break;     /* Mode 5 - Supports hires */
-		case 6: update_mode_6(curline); break;     /* Mode 6 - Supports offset per tile and hires */
-		case 7: update_mode_7(curline); break;     /* Mode 7 - Supports direct colour */
+		case 0: update_mode_0(scanlines, line); break;     /* Mode 0 */
+		case 1: update_mode_1(scanlines, line); break;     /* Mode 1 */
+		case 2: update_mode_2(scanlines, line); break;     /* Mode 2 - Supports offset per tile */
+		case 3: update_mode_3(scanlines, line); break;     /* Mode 3 - Supports direct colour */
+		case 4: update_mode_4(scanlines, line); break;     /* Mode 4 - Supports offset per tile and direct colour */
+		case 5: update_mode_5(scanlines, line); break;     /* Mode 5 - Supports hires */
+		case 6: update_mode_6(scanlines, line); break;     /* Mode 6 - Supports offset per tile and hires */
+		case 7: update_mode_7(scanlines, line); break;     /* Mode 7 - Supports direct colour */
 	}
 }
 
@@ -1173,61 +1202,13 @@ void snes_ppu_device::draw_screens( uint16_t curline )
 
 void snes_ppu_device::update_color_windowmasks( uint8_t mask, uint8_t *output )
 {
-	layer_t &self = m_layer[SNES_COLOR];
-	uint8_t set = 0, clear = 0;
+	const uint8_t inside = window_lut(m_layer[SNES_COLOR]);
 	switch (mask)
 	{
-		case 0: memset(output, 1, 256); return; // always
-		case 1: set = 1; clear = 0; break;
-		case 2: set = 0; clear = 1; break;
-		case 3: memset(output, 0, 256); return; // never
-	}
-
-	if (!self.window1_enabled && !self.window2_enabled)
-	{
-		memset(output, clear, 256);
-		return;
-	}
-
-	if (self.window1_enabled && !self.window2_enabled)
-	{
-		if (self.window1_invert)
-		{
-			set ^= 1;
-			clear ^= 1;
-		}
-		for (uint16_t x = 0; x < 256; x++)
-		{
-			output[x] = (x >= m_window1_left && x <= m_window1_right) ? set : clear;
-		}
-		return;
-	}
-
-	if (self.window2_enabled && !self.window1_enabled)
-	{
-		if (self.window2_invert)
-		{
-			set ^= 1;
-			clear ^= 1;
-		}
-		for (uint16_t x = 0; x < 256; x++)
-		{
-			output[x] = (x >= m_window2_left && x <= m_window2_right) ? set : clear;
-		}
-		return;
-	}
-
-	for (uint16_t x = 0; x < 256; x++)
-	{
-		uint8_t one_mask = ((x >= m_window1_left && x <= m_window1_right) ? 1 : 0) ^ self.window1_invert;
-		uint8_t two_mask = ((x >= m_window2_left && x <= m_window2_right) ? 1 : 0) ^ self.window2_invert;
-		switch (self.wlog_mask)
-		{
-			case 0: output[x] = (one_mask | two_mask) == 1 ? set : clear; break;
-			case 1: output[x] = (one_mask & two_mask) == 1 ? set : clear; break;
-			case 2: output[x] = (one_mask ^ two_mask) == 1 ? set : clear; break;
-			case 3: output[x] = (one_mask ^ two_mask) == 0 ? set : clear; break;
-		}
+		case 0: fill_window(0xf, output); break;        // always
+		case 1: fill_window(inside, output); break;
+		case 2: fill_window(~inside & 0xf, output); break;
+		case 3: fill_window(0x0, output); break;        // never
 	}
 }
 
@@ -1252,11 +1233,104 @@ void snes_ppu_device::update_color_windowmasks( uint8_t mask, uint8_t *output )
 
 void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 {
-	bool blurring = m_options.read_safe(0) & 0x01;
+	cache_background();
+
+	/* latch what changes from line to line without a register write; everything else is flushed on write */
+	line_batch &batch = m_line_batches[m_batches_queued];
+	line_latch &line = batch.lines[batch.count++];
+	line.bitmap = &bitmap;
+	line.curline = curline;
+	line.field = BIT(m_stat78, 7);
+	for (int i = SNES_BG1; i <= SNES_BG4; i++)
+		line.mosaic_offset[i] = m_layer[i].mosaic_offset;
+	line.blurring = m_options.read_safe(0) & 0x01;
+
+	if (!m_line_queue)
+		flush_scanlines();
+	else if (batch.count == LINE_BATCH)
+		queue_batch();
+}
+
+/*********************************************
+ * flush_scanlines()
+ *
+ * Finish every deferred line.  Called before
+ * anything that affects drawing changes, and
+ * by the driver at the end of the frame.
+ *********************************************/
+
+void snes_ppu_device::flush_scanlines()
+{
+	line_batch &current = m_line_batches[m_batches_queued];
+	if (!m_batches_queued && !current.count)
+		return;
 
 	g_profiler.start(PROFILER_VIDEO);
 
-	cache_background();
+	/* the partial batch is drawn here, so a lone line ahead of a mid-frame write never touches the queue */
+	draw_batch(current);
+	if (m_batches_queued)
+	{
+		// workers may still be drawing into the batches, so wait for all of them however long it takes
+		while (!osd_work_queue_wait(m_line_queue, osd_ticks_per_second() * 10)) { }
+	}
+
+	for (uint32_t i = 0; i <= m_batches_queued; i++)
+	{
+		m_stat77 |= m_line_batches[i].stat77;
+		m_line_batches[i].stat77 = 0;
+		m_line_batches[i].count = 0;
+	}
+	m_batches_queued = 0;
+
+	g_profiler.stop();
+}
+
+void snes_ppu_device::queue_batch()
+{
+	osd_work_item_queue(m_line_queue, draw_batch_callback, &m_line_batches[m_batches_queued], WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (++m_batches_queued == MAX_BATCHES)
+		flush_scanlines();
+}
+
+void snes_ppu_device::discard_batches()
+{
+	if (m_batches_queued)
+		while (!osd_work_queue_wait(m_line_queue, osd_ticks_per_second() * 10)) { }
+
+	for (uint32_t i = 0; i <= m_batches_queued; i++)
+	{
+		m_line_batches[i].stat77 = 0;
+		m_line_batches[i].count = 0;
+	}
+	m_batches_queued = 0;
+}
+
+void *snes_ppu_device::draw_batch_callback(void *param, int threadid)
+{
+	line_batch &batch = *reinterpret_cast<line_batch *>(param);
+	batch.ppu->draw_batch(batch);
+	return nullptr;
+}
+
+void snes_ppu_device::draw_batch(line_batch &batch)
+{
+	for (uint32_t i = 0; i < batch.count; i++)
+		batch.stat77 |= draw_scanline(batch.scanlines, batch.lines[i]);
+}
+
+/*********************************************
+ * draw_scanline()
+ *
+ * Compose one line into its bitmap.  May run
+ * on a worker thread, so it only reads device
+ * state and returns the STAT77 sprite flags.
+ *********************************************/
+
+uint8_t snes_ppu_device::draw_scanline( SNES_SCANLINE *scanlines, const line_latch &line )
+{
+	bitmap_rgb32 &bitmap = *line.bitmap;
+	uint8_t stat77 = 0;
 
 	if (m_screen_disabled) /* screen is forced blank */
 		for (int x = 0; x < SNES_SCR_WIDTH * 2; x++)
@@ -1266,32 +1340,21 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 		uint8_t window_above[256];
 		uint8_t window_below[256];
 
-		/* Clear priority */
-		memset(m_scanlines[SNES_MAINSCREEN].priority, 0, SNES_SCR_WIDTH);
-		memset(m_scanlines[SNES_SUBSCREEN].priority, 0, SNES_SCR_WIDTH);
-
-		/* Clear layers */
-		memset(m_scanlines[SNES_MAINSCREEN].layer, SNES_COLOR, SNES_SCR_WIDTH);
-		memset(m_scanlines[SNES_SUBSCREEN].layer, SNES_COLOR, SNES_SCR_WIDTH);
-
 		/* Clear blend_exception (only used for OAM) */
-		memset(m_scanlines[SNES_MAINSCREEN].blend_exception, 0, SNES_SCR_WIDTH);
-		memset(m_scanlines[SNES_SUBSCREEN].blend_exception, 0, SNES_SCR_WIDTH);
+		memset(scanlines[SNES_MAINSCREEN].blend_exception, 0, SNES_SCR_WIDTH);
+		memset(scanlines[SNES_SUBSCREEN].blend_exception, 0, SNES_SCR_WIDTH);
 
-		struct SNES_SCANLINE *above = &m_scanlines[SNES_MAINSCREEN];
-		struct SNES_SCANLINE *below = &m_scanlines[SNES_SUBSCREEN];
+		struct SNES_SCANLINE *above = &scanlines[SNES_MAINSCREEN];
+		struct SNES_SCANLINE *below = &scanlines[SNES_SUBSCREEN];
 #if SNES_LAYER_DEBUG
-		if (dbg_video(curline))
-		{
-			g_profiler.stop();
-			return;
-		}
+		if (dbg_video(line.curline))
+			return 0;
 
 		/* Toggle drawing of SNES_SUBSCREEN or SNES_MAINSCREEN */
 		if (m_debug_options.draw_subscreen)
 		{
-			above = &m_scanlines[SNES_SUBSCREEN];
-			below = &m_scanlines[SNES_MAINSCREEN];
+			above = &scanlines[SNES_SUBSCREEN];
+			below = &scanlines[SNES_MAINSCREEN];
 		}
 #endif
 
@@ -1301,102 +1364,128 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 		for (int x = 0; x < SNES_SCR_WIDTH; x++)
 		{
 			above->buffer[x] = above_color;
-			above->priority[x] = 0;
-			above->layer[x] = SNES_COLOR;
-
 			below->buffer[x] = below_color;
-			below->priority[x] = 0;
-			below->layer[x] = SNES_COLOR;
 		}
+		memset(above->priority, 0, SNES_SCR_WIDTH);
+		memset(below->priority, 0, SNES_SCR_WIDTH);
+		memset(above->layer, SNES_COLOR, SNES_SCR_WIDTH);
+		memset(below->layer, SNES_COLOR, SNES_SCR_WIDTH);
 
 		update_color_windowmasks(m_clip_to_black, window_above);
 		update_color_windowmasks(m_prevent_color_math, window_below);
 
 		/* Draw backgrounds */
-		draw_screens(curline);
+		draw_screens(scanlines, line);
 
 		/* Draw OAM */
-		update_objects(curline);
+		stat77 = update_objects(scanlines, line);
 
 		/* Draw the scanline to screen */
-		uint16_t prev = 0;
-
 		uint16_t *luma = &m_light_table[m_screen_brightness][0];
-		for (int x = 0; x < SNES_SCR_WIDTH; x++)
+		uint16_t main_colors[SNES_SCR_WIDTH];
+		color_math(*above, *below, window_above, window_below, false, main_colors);
+		if (!hires)
 		{
-			/* in hires, the first pixel (of 512) is subscreen pixel, then the first mainscreen pixel follows, and so on... */
-			if (!hires)
+			for (int x = 0; x < SNES_SCR_WIDTH; x++)
 			{
-				const uint16_t c = luma[pixel(x, above, below, window_above, window_below)];
+				const uint16_t c = luma[main_colors[x]];
 
 				bitmap.pix(0, x * 2 + 0) = indirect_color(c & 0x7fff);
 				bitmap.pix(0, x * 2 + 1) = indirect_color(c & 0x7fff);
 			}
-			else if (!blurring)
+		}
+		else
+		{
+			/* in hires, the first pixel (of 512) is subscreen pixel, then the first mainscreen pixel follows, and so on... */
+			uint16_t sub_colors[SNES_SCR_WIDTH];
+			color_math(*below, *above, window_above, window_below, false, sub_colors);
+			if (!line.blurring)
 			{
-				const uint16_t c0 = luma[pixel(x, below, above, window_above, window_below)];
-				const uint16_t c1 = luma[pixel(x, above, below, window_above, window_below)];
+				/* the subscreen pixel was clipped to black before the mainscreen pixel blended with it */
+				color_math(*above, *below, window_above, window_below, true, main_colors);
+				for (int x = 0; x < SNES_SCR_WIDTH; x++)
+				{
+					const uint16_t c0 = luma[sub_colors[x]];
+					const uint16_t c1 = luma[main_colors[x]];
 
-				bitmap.pix(0, x * 2 + 0) = indirect_color(c0 & 0x7fff);
-				bitmap.pix(0, x * 2 + 1) = indirect_color(c1 & 0x7fff);
+					bitmap.pix(0, x * 2 + 0) = indirect_color(c0 & 0x7fff);
+					bitmap.pix(0, x * 2 + 1) = indirect_color(c1 & 0x7fff);
+				}
 			}
 			else
 			{
-				uint16_t curr = luma[pixel(x, below, above, window_above, window_below)];
+				color_math(*above, *below, window_above, window_below, true, main_colors);
+				uint16_t prev = 0;
+				for (int x = 0; x < SNES_SCR_WIDTH; x++)
+				{
+					uint16_t curr = luma[sub_colors[x]];
 
-				uint16_t c0 = (prev + curr - ((prev ^ curr) & 0x0421)) >> 1;
-				bitmap.pix(0, x * 2 + 0) = indirect_color(c0 & 0x7fff);
+					uint16_t c0 = (prev + curr - ((prev ^ curr) & 0x0421)) >> 1;
+					bitmap.pix(0, x * 2 + 0) = indirect_color(c0 & 0x7fff);
 
-				prev = curr;
-				curr = luma[pixel(x, above, below, window_above, window_below)];
+					prev = curr;
+					curr = luma[main_colors[x]];
 
-				uint16_t c1 = (prev + curr - ((prev ^ curr) & 0x0421)) >> 1;
-				bitmap.pix(0, x * 2 + 1) = indirect_color(c1 & 0x7fff);
+					uint16_t c1 = (prev + curr - ((prev ^ curr) & 0x0421)) >> 1;
+					bitmap.pix(0, x * 2 + 1) = indirect_color(c1 & 0x7fff);
 
-				prev = curr;
+					prev = curr;
+				}
 			}
 		}
 	}
 
-	g_profiler.stop();
+	return stat77;
 }
 
-uint16_t snes_ppu_device::pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, uint8_t *window_above, uint8_t *window_below)
-{
-	if (!window_above[x]) above->buffer[x] = 0;
-	if (!window_below[x]) return above->buffer[x];
-	if (!m_layer[above->layer[x]].color_math || (above->layer[x] == SNES_OAM && above->blend_exception[x])) return above->buffer[x];
-	if (!m_sub_add_mode) return blend(above->buffer[x], pen_indirect(FIXED_COLOUR), BIT(m_color_modes, 0) != 0 && window_above[x] != 0);
-	return blend(above->buffer[x], below->buffer[x], BIT(m_color_modes, 0) != 0 && window_above[x] != 0 && below->layer[x] != SNES_COLOR);
-}
+/*********************************************
+ * color_math()
+ *
+ * Apply the color window and color math to a
+ * whole line.  Add/subtract is fixed for the
+ * line, so the per-pixel work is branch-free
+ * and vectorizes.  With clip_below set, the
+ * subscreen is clipped by the color window
+ * too, as happens to the hires subscreen.
+ *********************************************/
 
-inline uint16_t snes_ppu_device::blend( uint16_t x, uint16_t y, bool halve )
+void snes_ppu_device::color_math(const SNES_SCANLINE &above, const SNES_SCANLINE &below, const uint8_t *window_above, const uint8_t *window_below, bool clip_below, uint16_t *output)
 {
-	if (!BIT(m_color_modes, 1)) // add
-	{
-		if (!halve)
-		{
-			uint16_t sum = x + y;
-			uint16_t carry = (sum - ((x ^ y) & 0x0421)) & 0x8420;
-			return (sum - carry) | (carry - (carry >> 5));
-		}
-		else
-		{
-			return (x + y - ((x ^ y) & 0x0421)) >> 1;
-		}
-	}
-	else // sub
+	uint8_t math_enabled[8] = { 0 };
+	for (int i = SNES_BG1; i <= SNES_COLOR; i++)
+		math_enabled[i] = m_layer[i].color_math ? 1 : 0;
+
+	const bool subtract = BIT(m_color_modes, 1);
+	const uint16_t halve_enabled = BIT(m_color_modes, 0) ? 0xffff : 0;
+	const uint16_t fixed = pen_indirect(FIXED_COLOUR);
+	const bool fixed_color = !m_sub_add_mode;
+
+	for (int x = 0; x < SNES_SCR_WIDTH; x++)
 	{
-		uint16_t diff = x - y + 0x8420;
-		uint16_t borrow = (diff - ((x ^ y) & 0x8420)) & 0x8420;
-		if (!halve)
+		const uint16_t clip = window_above[x] ? 0xffff : 0;
+		const uint8_t layer = above.layer[x];
+		const uint16_t a = above.buffer[x] & clip;
+		const uint16_t b = fixed_color ? fixed : (below.buffer[x] & (clip_below ? clip : 0xffff));
+		const bool apply = window_below[x] && math_enabled[layer & 7] && !(layer == SNES_OAM && above.blend_exception[x]);
+		const uint16_t halve = halve_enabled & clip & ((fixed_color || below.layer[x] != SNES_COLOR) ? 0xffff : 0);
+
+		uint16_t full, half;
+		if (!subtract)
 		{
-			return (diff - borrow) & (borrow - (borrow >> 5));
+			const uint16_t sum = a + b;
+			const uint16_t carry = (sum - ((a ^ b) & 0x0421)) & 0x8420;
+			full = (sum - carry) | (carry - (carry >> 5));
+			half = (a + b - ((a ^ b) & 0x0421)) >> 1;
 		}
 		else
 		{
-			return (((diff - borrow) & (borrow - (borrow >> 5))) & 0x7bde) >> 1;
+			const uint16_t diff = a - b + 0x8420;
+			const uint16_t borrow = (diff - ((a ^ b) & 0x8420)) & 0x8420;
+			full = (diff - borrow) & (borrow - (borrow >> 5));
+			half = (full & 0x7bde) >> 1;
 		}
+		const uint16_t blended = (full & ~halve) | (half & halve);
+		output[x] = apply ? blended : a;
 	}
 }
 
@@ -2004,6 +2093,7 @@ uint8_t snes_ppu_device::read(uint32_t offset, uint8_t wrio_bit7)
 			m_read_opvct ^= 1;
 			return m_ppu2_open_bus;
 		case STAT77:    /* PPU status flag and version number */
+			flush_scanlines();
 			value = m_stat77 & 0xc0; // 0x80 & 0x40 are Time Over / Range Over Sprite flags, set by the video code
 			// 0x20 - Master/slave mode select. Little is known about this bit. We always seem to read back 0 here.
 			value |= (m_ppu1_open_bus & 0x10);
@@ -2028,6 +2118,9 @@ uint8_t snes_ppu_device::read(uint32_t offset, uint8_t wrio_bit7)
 
 void snes_ppu_device::write(uint32_t offset, uint8_t data)
 {
+	/* queued lines were latched with the old register state */
+	flush_scanlines();
+
 	switch (offset)
 	{
 		case INIDISP:   /* Initial settings for screen */
@@ -48,6 +48,7 @@ public:
 	auto open_bus_callback() { return m_openbus_cb.bind(); }
 
 	void refresh_scanline(bitmap_rgb32 &bitmap, uint16_t curline);
+	void flush_scanlines();
 
 	int16_t current_x() const { return screen().hpos(); }
 	int16_t current_y() const { return screen().vpos(); }
@@ -66,10 +67,11 @@ public:
 	void oam_address_reset();
 	void oam_set_first_object();
 
-	void clear_time_range_over() { m_stat77 &= 0x3f; }
-	void toggle_field() { m_stat78 ^= 0x80; }
+	void clear_time_range_over() { flush_scanlines(); m_stat77 &= 0x3f; }
+	void toggle_field() { flush_scanlines(); m_stat78 ^= 0x80; }
 	void reset_interlace()
 	{
+		flush_scanlines();
 		m_htmult = 1;
 		m_interlace = 1;
 		m_oam.interlace = 0;
@@ -108,9 +110,29 @@ protected:
 		uint8_t  blend_exception[SNES_SCR_WIDTH];
 	};
 
-	uint8_t m_regs[0x40];
+	/* register state a deferred scanline needs beyond the (unchanged) PPU registers */
+	struct line_latch
+	{
+		bitmap_rgb32 *bitmap;
+		uint16_t curline;
+		uint8_t field;          /* STAT78 bit 7, also touched by H/V latching */
+		uint16_t mosaic_offset[4];
+		bool blurring;
+	};
 
-	SNES_SCANLINE m_scanlines[2];
+	static constexpr unsigned LINE_BATCH = 16;      /* scanlines handed to a worker at once */
+	static constexpr unsigned MAX_BATCHES = 16;     /* batches in flight before the emulation thread waits */
+
+	struct line_batch
+	{
+		snes_ppu_device *ppu;
+		line_latch lines[LINE_BATCH];
+		uint32_t count;
+		uint8_t stat77;                             /* Time Over / Range Over flags raised while drawing */
+		SNES_SCANLINE scanlines[2];
+	};
+
+	uint8_t m_regs[0x40];
 
 	struct layer_t
 	{
@@ -270,27 +292,33 @@ protected:
 	};
 
 	inline uint32_t get_tile(uint8_t layer_idx, uint32_t hoffset, uint32_t voffset);
-	void update_line(uint16_t curline, uint8_t layer, uint8_t direct_colors);
-	void update_line_mode7(uint16_t curline, uint8_t layer_idx);
-	void update_objects(uint16_t curline);
-	void update_mode_0(uint16_t curline);
-	void update_mode_1(uint16_t curline);
-	void update_mode_2(uint16_t curline);
-	void update_mode_3(uint16_t curline);
-	void update_mode_4(uint16_t curline);
-	void update_mode_5(uint16_t curline);
-	void update_mode_6(uint16_t curline);
-	void update_mode_7(uint16_t curline);
-	void draw_screens(uint16_t curline);
+	void update_line(SNES_SCANLINE *scanlines, const line_latch &line, uint8_t layer, uint8_t direct_colors);
+	void update_line_mode7(SNES_SCANLINE *scanlines, const line_latch &line, uint8_t layer_idx);
+	uint8_t update_objects(SNES_SCANLINE *scanlines, const line_latch &line);
+	void update_mode_0(SNES_SCANLINE *scanlines, const line_latch &line);
+	void update_mode_1(SNES_SCANLINE *scanlines, const line_latch &line);
+	void update_mode_2(SNES_SCANLINE *scanlines, const line_latch &line);
+	void update_mode_3(SNES_SCANLINE *scanlines, const line_latch &line);
+	void update_mode_4(SNES_SCANLINE *scanlines, const line_latch &line);
+	void update_mode_5(SNES_SCANLINE *scanlines, const line_latch &line);
+	void update_mode_6(SNES_SCANLINE *scanlines, const line_latch &line);
+	void update_mode_7(SNES_SCANLINE *scanlines, const line_latch &line);
+	void draw_screens(SNES_SCANLINE *scanlines, const line_latch &line);
+	uint8_t window_lut(const layer_t &self) const;
+	void fill_window(uint8_t lut, uint8_t *output) const;
 	void render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output);
-	inline void plot_above(uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
-	inline void plot_below(uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
+	static inline void plot_above(SNES_SCANLINE *scanlines, uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
+	static inline void plot_below(SNES_SCANLINE *scanlines, uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
 	void update_color_windowmasks(uint8_t mask, uint8_t *output);
 	void update_video_mode(void);
 	void cache_background();
-	uint16_t pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, uint8_t *window_above, uint8_t *window_below);
+	void color_math(const SNES_SCANLINE &above, const SNES_SCANLINE &below, const uint8_t *window_above, const uint8_t *window_below, bool clip_below, uint16_t *output);
 	uint16_t direct_color(uint16_t palette, uint16_t group);
-	inline uint16_t blend(uint16_t x, uint16_t y, bool halve);
+	uint8_t draw_scanline(SNES_SCANLINE *scanlines, const line_latch &line);
+	void draw_batch(line_batch &batch);
+	static void *draw_batch_callback(void *param, int threadid);
+	void queue_batch();
+	void discard_batches();
 
 	void dynamic_res_change();
 	inline uint32_t get_vram_address();
@@ -309,8 +337,14 @@ protected:
 	std::unique_ptr<uint8_t[]> m_vram;    /* Video RAM (TODO: Should be 16-bit, but it's easier this way) */
 	std::unique_ptr<std::unique_ptr<uint16_t[]>[]> m_light_table; /* Luma ramp */
 
+	/* deferred scanline compositing: lines queue up while nothing that affects drawing changes */
+	osd_work_queue *m_line_queue;
+	std::unique_ptr<line_batch[]> m_line_batches;
+	uint32_t m_batches_queued;  /* m_line_batches[m_batches_queued] is the batch being filled */
+
 	// device-level overrides
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_reset() override;
 
 	// device_palette_interface overrides
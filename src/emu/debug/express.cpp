@@ -101,6 +101,13 @@ enum
 	TVL_EXECUTEFUNC
 };
 
+// compiled instructions that don't correspond to an operator
+enum
+{
+	CVL_CONSTANT = TVL_EXECUTEFUNC + 1,
+	CVL_LOAD
+};
+
 
 
 //**************************************************************************
@@ -625,10 +632,51 @@ void symbol_table::notify_memory_modified()
 //-------------------------------------------------
 
 u64 symbol_table::memory_value(const char *name, expression_space spacenum, u32 address, int size, bool disable_se)
+{
+	if (spacenum == EXPSPACE_REGION)
+		return name ? read_memory_region(name, address, size) : 0;
+
+	address_space *const space = memory_space(name, spacenum);
+	return space ? memory_value(*space, spacenum, address, size, disable_se) : 0;
+}
+
+
+//-------------------------------------------------
+//  memory_value - read 1,2,4 or 8 bytes at the
+//  given offset in a space found by memory_space
+//-------------------------------------------------
+
+u64 symbol_table::memory_value(address_space &space, expression_space spacenum, u32 address, int size, bool disable_se)
+{
+	auto dis = m_machine.disable_side_effects(disable_se);
+	switch (spacenum)
+	{
+	case EXPSPACE_PROGRAM_PHYSICAL:
+	case EXPSPACE_DATA_PHYSICAL:
+	case EXPSPACE_IO_PHYSICAL:
+	case EXPSPACE_OPCODE_PHYSICAL:
+		return read_memory(space, address, size, false);
+
+	case EXPSPACE_PRGDIRECT:
+	case EXPSPACE_OPDIRECT:
+		return read_program_direct(space, (spacenum == EXPSPACE_OPDIRECT) ? 1 : 0, address, size);
+
+	default:
+		return read_memory(space, address, size, true);
+	}
+}
+
+
+//-------------------------------------------------
+//  memory_space - find the address space a
+//  memory operator refers to, or nullptr for
+//  regions and missing spaces
+//-------------------------------------------------
+
+address_space *symbol_table::memory_space(const char *name, expression_space spacenum)
 {
 	device_memory_interface *memory = m_memintf;
 
-	bool logical = true;
 	int space = -1;
 	switch (spacenum)
 	{
@@ -636,43 +684,27 @@ u64 symbol_table::memory_value(const char *name, expression_space spacenum, u32
 	case EXPSPACE_DATA_PHYSICAL:
 	case EXPSPACE_IO_PHYSICAL:
 	case EXPSPACE_OPCODE_PHYSICAL:
-		spacenum = expression_space(spacenum - (EXPSPACE_PROGRAM_PHYSICAL - EXPSPACE_PROGRAM_LOGICAL));
-		logical = false;
-		[[fallthrough]];
+		space = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_PHYSICAL);
+		break;
+
 	case EXPSPACE_PROGRAM_LOGICAL:
 	case EXPSPACE_DATA_LOGICAL:
 	case EXPSPACE_IO_LOGICAL:
 	case EXPSPACE_OPCODE_LOGICAL:
 		space = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_LOGICAL);
-		expression_get_space(name, space, memory);
-		if (memory)
-		{
-			auto dis = m_machine.disable_side_effects(disable_se);
-			return read_memory(memory->space(space), address, size, logical);
-		}
 		break;
 
 	case EXPSPACE_PRGDIRECT:
 	case EXPSPACE_OPDIRECT:
 		space = (spacenum == EXPSPACE_OPDIRECT) ? AS_OPCODES : AS_PROGRAM;
-		expression_get_space(name, space, memory);
-		if (memory)
-		{
-			auto dis = m_machine.disable_side_effects(disable_se);
-			return read_program_direct(memory->space(space), (spacenum == EXPSPACE_OPDIRECT) ? 1 : 0, address, size);
-		}
-		break;
-
-	case EXPSPACE_REGION:
-		if (name)
-			return read_memory_region(name, address, size);
 		break;
 
 	default:
-		break;
+		return nullptr;
 	}
 
-	return 0;
+	expression_get_space(name, space, memory);
+	return memory ? &memory->space(space) : nullptr;
 }
 
 
@@ -784,49 +816,44 @@ u64 symbol_table::read_memory_region(const char *rgntag, offs_t address, int siz
 
 void symbol_table::set_memory_value(const char *name, expression_space spacenum, u32 address, int size, u64 data, bool disable_se)
 {
-	device_memory_interface *memory = m_memintf;
+	if (spacenum == EXPSPACE_REGION)
+	{
+		if (name)
+			write_memory_region(name, address, size, data);
+		return;
+	}
 
-	bool logical = true;
-	int space = -1;
+	address_space *const space = memory_space(name, spacenum);
+	if (space)
+		set_memory_value(*space, spacenum, address, size, data, disable_se);
+}
+
+
+//-------------------------------------------------
+//  set_memory_value - write 1,2,4 or 8 bytes at
+//  the given offset in a space found by
+//  memory_space
+//-------------------------------------------------
+
+void symbol_table::set_memory_value(address_space &space, expression_space spacenum, u32 address, int size, u64 data, bool disable_se)
+{
+	auto dis = m_machine.disable_side_effects(disable_se);
 	switch (spacenum)
 	{
 	case EXPSPACE_PROGRAM_PHYSICAL:
 	case EXPSPACE_DATA_PHYSICAL:
 	case EXPSPACE_IO_PHYSICAL:
 	case EXPSPACE_OPCODE_PHYSICAL:
-		spacenum = expression_space(spacenum - (EXPSPACE_PROGRAM_PHYSICAL - EXPSPACE_PROGRAM_LOGICAL));
-		logical = false;
-		[[fallthrough]];
-	case EXPSPACE_PROGRAM_LOGICAL:
-	case EXPSPACE_DATA_LOGICAL:
-	case EXPSPACE_IO_LOGICAL:
-	case EXPSPACE_OPCODE_LOGICAL:
-		space = AS_PROGRAM + (spacenum - EXPSPACE_PROGRAM_LOGICAL);
-		expression_get_space(name, space, memory);
-		if (memory)
-		{
-			auto dis = m_machine.disable_side_effects(disable_se);
-			write_memory(memory->space(space), address, data, size, logical);
-		}
+		write_memory(space, address, data, size, false);
 		break;
 
 	case EXPSPACE_PRGDIRECT:
 	case EXPSPACE_OPDIRECT:
-		space = (spacenum == EXPSPACE_OPDIRECT) ? AS_OPCODES : AS_PROGRAM;
-		expression_get_space(name, space, memory);
-		if (memory)
-		{
-			auto dis = m_machine.disable_side_effects(disable_se);
-			write_program_direct(memory->space(space), (spacenum == EXPSPACE_OPDIRECT) ? 1 : 0, address, size, data);
-		}
-		break;
-
-	case EXPSPACE_REGION:
-		if (name)
-			write_memory_region(name, address, size, data);
+		write_program_direct(space, (spacenum == EXPSPACE_OPDIRECT) ? 1 : 0, address, size, data);
 		break;
 
 	default:
+		write_memory(space, address, data, size, true);
 		break;
 	}
 }
@@ -1037,6 +1064,7 @@ parsed_expression::parsed_expression(const parsed_expression &src)
 {
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
+	compile_tokens();
 }
 
 
@@ -1050,12 +1078,16 @@ void parsed_expression::parse(std::string_view expression)
 	m_original_string.assign(expression);
 	m_tokenlist.clear();
 	m_stringlist.clear();
+	m_program.clear();
 
 	// first parse the tokens into the token array in order
 	parse_string_into_tokens();
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// then flatten them for fast execution
+	compile_tokens();
 }
 
 
@@ -1068,8 +1100,10 @@ void parsed_expression::copy(const parsed_expression &src)
 	m_symtable = src.m_symtable;
 	m_default_base = src.m_default_base;
 	m_original_string.assign(src.m_original_string);
+	m_program.clear();
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
+	compile_tokens();
 }
 
 
@@ -2141,6 +2175,350 @@ u64 parsed_expression::execute_tokens()
 }
 
 
+//-------------------------------------------------
+//  compile_tokens - flatten a postfix sequence of
+//  tokens into instructions, leaving the program
+//  empty if executing the tokens would fail for
+//  any reason other than a value computed at run
+//  time, so the token path reports the error
+//-------------------------------------------------
+
+void parsed_expression::compile_tokens()
+{
+	// what each stack slot holds at this point in execution
+	enum slot_type { SLOT_NUMBER, SLOT_STRING, SLOT_SYMBOL, SLOT_MEMORY };
+	struct slot_info
+	{
+		slot_type       type;
+		int             offset;
+		symbol_entry *  symbol;
+		u32             memory;
+	};
+
+	m_program.clear();
+	m_memories.clear();
+	m_slots.clear();
+
+	std::vector<slot_info> stack;
+	size_t maxdepth = 0;
+	int result_offset = 0; // execute_tokens reuses a token whose offset memory operands inherit
+	std::vector<compiled_op> program;
+
+	auto const emit =
+			[&program] (u8 opcode, size_t dst, int offset) -> compiled_op &
+			{
+				return program.emplace_back(compiled_op{ opcode, u16(dst), 0, offset, 0, nullptr, 0 });
+			};
+	auto const push =
+			[&stack, &maxdepth] (slot_type type, int offset, symbol_entry *symbol = nullptr, u32 memory = 0)
+			{
+				stack.push_back(slot_info{ type, offset, symbol, memory });
+				maxdepth = std::max(maxdepth, stack.size());
+			};
+
+	// symbol and memory operands are read at the point they're popped, as in execute_tokens
+	auto const pop_rval =
+			[&stack, &emit] (slot_info &slot) -> bool
+			{
+				if (stack.empty())
+					return false;
+				slot = stack.back();
+				stack.pop_back();
+				if (slot.type == SLOT_SYMBOL && !slot.symbol->is_function())
+					emit(CVL_LOAD, stack.size(), slot.offset).symbol = slot.symbol;
+				else if (slot.type == SLOT_MEMORY)
+					emit(CVL_LOAD, stack.size(), slot.offset).memory = slot.memory;
+				else if (slot.type != SLOT_NUMBER)
+					return false;
+				return true;
+			};
+	auto const pop_lval =
+			[&stack] (slot_info &slot) -> bool
+			{
+				if (stack.empty())
+					return false;
+				slot = stack.back();
+				stack.pop_back();
+				return (slot.type == SLOT_SYMBOL && slot.symbol->is_lval()) || slot.type == SLOT_MEMORY;
+			};
+
+	slot_info t1, t2;
+	for (parse_token &token : m_tokenlist)
+	{
+		if (token.is_number())
+		{
+			emit(CVL_CONSTANT, stack.size(), token.offset()).value = token.value();
+			push(SLOT_NUMBER, token.offset());
+			continue;
+		}
+		else if (token.is_string())
+		{
+			push(SLOT_STRING, token.offset());
+			continue;
+		}
+		else if (token.is_symbol())
+		{
+			push(SLOT_SYMBOL, token.offset(), &token.symbol());
+			continue;
+		}
+		else if (!token.is_operator())
+		{
+			return;
+		}
+
+		u8 const optype = token.optype();
+		switch (optype)
+		{
+			case TVL_PREINCREMENT:
+			case TVL_PREDECREMENT:
+			case TVL_POSTINCREMENT:
+			case TVL_POSTDECREMENT:
+				if (!pop_lval(t1))
+					return;
+				emit(optype, stack.size(), t1.offset).symbol = t1.symbol;
+				program.back().memory = t1.memory;
+				push(SLOT_NUMBER, result_offset = t1.offset);
+				break;
+
+			case TVL_COMPLEMENT:
+			case TVL_NOT:
+			case TVL_UPLUS:
+			case TVL_UMINUS:
+				if (!pop_rval(t1))
+					return;
+				emit(optype, stack.size(), t1.offset);
+				push(SLOT_NUMBER, result_offset = t1.offset);
+				break;
+
+			case TVL_MULTIPLY:
+			case TVL_DIVIDE:
+			case TVL_MODULO:
+			case TVL_ADD:
+			case TVL_SUBTRACT:
+			case TVL_LSHIFT:
+			case TVL_RSHIFT:
+			case TVL_LESS:
+			case TVL_LESSOREQUAL:
+			case TVL_GREATER:
+			case TVL_GREATEROREQUAL:
+			case TVL_EQUAL:
+			case TVL_NOTEQUAL:
+			case TVL_BAND:
+			case TVL_BXOR:
+			case TVL_BOR:
+			case TVL_LAND:
+			case TVL_LOR:
+				if (!pop_rval(t2) || !pop_rval(t1))
+					return;
+				emit(optype, stack.size(), t2.offset).src = u16(stack.size() + 1);
+				push(SLOT_NUMBER, result_offset = std::min(t1.offset, t2.offset));
+				break;
+
+			case TVL_ASSIGN:
+			case TVL_ASSIGNMULTIPLY:
+			case TVL_ASSIGNDIVIDE:
+			case TVL_ASSIGNMODULO:
+			case TVL_ASSIGNADD:
+			case TVL_ASSIGNSUBTRACT:
+			case TVL_ASSIGNLSHIFT:
+			case TVL_ASSIGNRSHIFT:
+			case TVL_ASSIGNBAND:
+			case TVL_ASSIGNBXOR:
+			case TVL_ASSIGNBOR:
+				if (!pop_rval(t2) || !pop_lval(t1))
+					return;
+				emit(optype, stack.size(), t2.offset).src = u16(stack.size() + 1);
+				program.back().symbol = t1.symbol;
+				program.back().memory = t1.memory;
+				push(SLOT_NUMBER, result_offset = (optype == TVL_ASSIGN) ? t2.offset : std::min(t1.offset, t2.offset));
+				break;
+
+			case TVL_COMMA:
+				if (!token.is_function_separator())
+				{
+					if (!pop_rval(t2) || !pop_rval(t1))
+						return;
+					emit(optype, stack.size(), t2.offset).src = u16(stack.size() + 1);
+					push(SLOT_NUMBER, t2.offset);
+				}
+				break;
+
+			case TVL_MEMORYAT:
+				if (!pop_rval(t1))
+					return;
+				m_memories.emplace_back(compiled_memory{
+						m_symtable.get().memory_space(token.memory_source(), token.memory_space()),
+						token.memory_source(),
+						token.memory_space(),
+						1 << token.memory_size(),
+						token.memory_side_effects() });
+				push(SLOT_MEMORY, result_offset, nullptr, u32(m_memories.size() - 1));
+				break;
+
+			case TVL_EXECUTEFUNC:
+			{
+				// parameters sit in the slots immediately above the function
+				symbol_entry *function = nullptr;
+				int paramcount = 0;
+				while (paramcount < MAX_FUNCTION_PARAMS)
+				{
+					if (stack.empty())
+						return;
+					if (stack.back().type == SLOT_SYMBOL && stack.back().symbol->is_function())
+					{
+						function = stack.back().symbol;
+						stack.pop_back();
+						break;
+					}
+					if (!pop_rval(t1))
+						return;
+					paramcount++;
+				}
+				if (paramcount == MAX_FUNCTION_PARAMS)
+					return;
+
+				function_symbol_entry const &entry = *downcast<function_symbol_entry *>(function);
+				if (paramcount < entry.minparams() || paramcount > entry.maxparams())
+					return;
+				emit(optype, stack.size(), token.offset()).symbol = function;
+				program.back().src = u16(paramcount);
+				push(SLOT_NUMBER, token.offset());
+				break;
+			}
+
+			default:
+				return;
+		}
+	}
+
+	// the final result must be the only thing left
+	if (!pop_rval(t1) || !stack.empty() || maxdepth > 0xffff)
+		return;
+
+	m_program = std::move(program);
+	m_slots.resize(maxdepth);
+}
+
+
+//-------------------------------------------------
+//  get_compiled_lval - read the symbol or memory
+//  operand of a compiled instruction
+//-------------------------------------------------
+
+inline u64 parsed_expression::get_compiled_lval(const compiled_op &op, u64 address)
+{
+	if (op.symbol)
+		return op.symbol->value();
+
+	compiled_memory const &mem = m_memories[op.memory];
+	if (mem.space)
+		return m_symtable.get().memory_value(*mem.space, mem.spacenum, address, mem.size, mem.disable_se);
+	else
+		return m_symtable.get().memory_value(mem.name, mem.spacenum, address, mem.size, mem.disable_se);
+}
+
+
+//-------------------------------------------------
+//  set_compiled_lval - write the symbol or memory
+//  operand of a compiled instruction
+//-------------------------------------------------
+
+inline void parsed_expression::set_compiled_lval(const compiled_op &op, u64 address, u64 value)
+{
+	if (op.symbol)
+	{
+		op.symbol->set_value(value);
+		return;
+	}
+
+	compiled_memory const &mem = m_memories[op.memory];
+	if (mem.space)
+		m_symtable.get().set_memory_value(*mem.space, mem.spacenum, address, mem.size, value, mem.disable_se);
+	else
+		m_symtable.get().set_memory_value(mem.name, mem.spacenum, address, mem.size, value, mem.disable_se);
+}
+
+
+//-------------------------------------------------
+//  execute_program - execute compiled tokens
+//-------------------------------------------------
+
+u64 parsed_expression::execute_program()
+{
+	u64 *const slots = m_slots.data();
+	for (compiled_op const &op : m_program)
+	{
+		// memory operands keep their address in the destination slot
+		u64 &dst = slots[op.dst];
+		u64 const src = slots[op.src];
+		u64 const address = dst;
+		switch (op.opcode)
+		{
+			case CVL_CONSTANT:          dst = op.value;                                         break;
+			case CVL_LOAD:              dst = get_compiled_lval(op, address);                   break;
+
+			case TVL_PREINCREMENT:      dst = get_compiled_lval(op, address) + 1;   set_compiled_lval(op, address, dst);        break;
+			case TVL_PREDECREMENT:      dst = get_compiled_lval(op, address) - 1;   set_compiled_lval(op, address, dst);        break;
+			case TVL_POSTINCREMENT:     dst = get_compiled_lval(op, address);       set_compiled_lval(op, address, dst + 1);    break;
+			case TVL_POSTDECREMENT:     dst = get_compiled_lval(op, address);       set_compiled_lval(op, address, dst - 1);    break;
+
+			case TVL_COMPLEMENT:        dst = !dst;                                             break;
+			case TVL_NOT:               dst = ~dst;                                             break;
+			case TVL_UPLUS:                                                                     break;
+			case TVL_UMINUS:            dst = -dst;                                             break;
+
+			case TVL_DIVIDE:
+			case TVL_MODULO:
+			case TVL_ASSIGNDIVIDE:
+			case TVL_ASSIGNMODULO:
+				if (src == 0)
+					throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+				switch (op.opcode)
+				{
+					case TVL_DIVIDE:        dst /= src;                                             break;
+					case TVL_MODULO:        dst %= src;                                             break;
+					case TVL_ASSIGNDIVIDE:  dst = get_compiled_lval(op, address) / src;  set_compiled_lval(op, address, dst);  break;
+					case TVL_ASSIGNMODULO:  dst = get_compiled_lval(op, address) % src;  set_compiled_lval(op, address, dst);  break;
+				}
+				break;
+
+			case TVL_MULTIPLY:          dst *= src;                                             break;
+			case TVL_ADD:               dst += src;                                             break;
+			case TVL_SUBTRACT:          dst -= src;                                             break;
+			case TVL_LSHIFT:            dst <<= src;                                            break;
+			case TVL_RSHIFT:            dst >>= src;                                            break;
+			case TVL_LESS:              dst = dst < src;                                        break;
+			case TVL_LESSOREQUAL:       dst = dst <= src;                                       break;
+			case TVL_GREATER:           dst = dst > src;                                        break;
+			case TVL_GREATEROREQUAL:    dst = dst >= src;                                       break;
+			case TVL_EQUAL:             dst = dst == src;                                       break;
+			case TVL_NOTEQUAL:          dst = dst != src;                                       break;
+			case TVL_BAND:              dst &= src;                                             break;
+			case TVL_BXOR:              dst ^= src;                                             break;
+			case TVL_BOR:               dst |= src;                                             break;
+			case TVL_LAND:              dst = dst && src;                                       break;
+			case TVL_LOR:               dst = dst || src;                                       break;
+			case TVL_COMMA:             dst = src;                                              break;
+
+			case TVL_ASSIGN:            dst = src;                                              set_compiled_lval(op, address, dst);  break;
+			case TVL_ASSIGNMULTIPLY:    dst = get_compiled_lval(op, address) * src;             set_compiled_lval(op, address, dst);  break;
+			case TVL_ASSIGNADD:         dst = get_compiled_lval(op, address) + src;             set_compiled_lval(op, address, dst);  break;
+			case TVL_ASSIGNSUBTRACT:    dst = get_compiled_lval(op, address) - src;             set_compiled_lval(op, address, dst);  break;
+			case TVL_ASSIGNLSHIFT:      dst = get_compiled_lval(op, address) << src;            set_compiled_lval(op, address, dst);  break;
+			case TVL_ASSIGNRSHIFT:      dst = get_compiled_lval(op, address) >> src;            set_compiled_lval(op, address, dst);  break;
+			case TVL_ASSIGNBAND:        dst = get_compiled_lval(op, address) & src;             set_compiled_lval(op, address, dst);  break;
+			case TVL_ASSIGNBXOR:        dst = get_compiled_lval(op, address) ^ src;             set_compiled_lval(op, address, dst);  break;
+			case TVL_ASSIGNBOR:         dst = get_compiled_lval(op, address) | src;             set_compiled_lval(op, address, dst);  break;
+
+			case TVL_EXECUTEFUNC:
+				dst = downcast<function_symbol_entry *>(op.symbol)->execute(op.src, &slots[op.dst + 1]);
+				break;
+		}
+	}
+	return slots[0];
+}
+
+
 
 //**************************************************************************
 //  PARSE TOKEN
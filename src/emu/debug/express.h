@@ -20,6 +20,7 @@
 #include <list>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -199,6 +200,11 @@ public:
 	u64 read_memory(address_space &space, offs_t address, int size, bool apply_translation);
 	void write_memory(address_space &space, offs_t address, u64 data, int size, bool apply_translation);
 
+	// pre-resolved memory accessors
+	address_space *memory_space(const char *name, expression_space space);
+	u64 memory_value(address_space &space, expression_space spacenum, u32 offset, int size, bool disable_se);
+	void set_memory_value(address_space &space, expression_space spacenum, u32 offset, int size, u64 value, bool disable_se);
+
 private:
 	// memory helpers
 	u64 read_program_direct(address_space &space, int opcode, offs_t address, int size);
@@ -240,12 +246,12 @@ public:
 	symbol_table &symbols() const { return m_symtable.get(); }
 
 	// setters
-	void set_symbols(symbol_table &symtable) { m_symtable = std::reference_wrapper<symbol_table>(symtable); }
+	void set_symbols(symbol_table &symtable) { m_symtable = std::reference_wrapper<symbol_table>(symtable); compile_tokens(); }
 	void set_default_base(int base) { assert(base == 8 || base == 10 || base == 16); m_default_base = base; }
 
 	// execution
 	void parse(std::string_view string);
-	u64 execute() { return execute_tokens(); }
+	u64 execute() { return m_program.empty() ? execute_tokens() : execute_program(); }
 
 private:
 	// a single token
@@ -307,6 +313,7 @@ private:
 		expression_space memory_space() const { assert(m_type == OPERATOR || m_type == MEMORY); return expression_space((m_flags & TIN_MEMORY_SPACE_MASK) >> TIN_MEMORY_SPACE_SHIFT); }
 		int memory_size() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_MEMORY_SIZE_MASK) >> TIN_MEMORY_SIZE_SHIFT; }
 		bool memory_side_effects() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_SIDE_EFFECT_MASK) >> TIN_SIDE_EFFECT_SHIFT; }
+		const char *memory_source() const { assert(m_type == OPERATOR || m_type == MEMORY); return m_string; }
 
 		// setters
 		parse_token &set_offset(int offset) { m_offset = offset; return *this; }
@@ -340,6 +347,29 @@ private:
 		symbol_entry *          m_symbol;           // symbol pointer
 	};
 
+	// a memory operand of a compiled expression
+	struct compiled_memory
+	{
+		address_space *         space;              // pre-resolved address space, or nullptr
+		const char *            name;               // memory name, used when there is no space
+		expression_space        spacenum;           // expression space
+		int                     size;               // access size in bytes
+		bool                    disable_se;         // disable side effects
+	};
+
+	// a single compiled instruction; operands live in fixed stack slots
+	// because the depth of the stack at every step is known in advance
+	struct compiled_op
+	{
+		u8                      opcode;             // operation
+		u16                     dst;                // destination and first operand slot
+		u16                     src;                // second operand slot, or parameter count
+		int                     offset;             // string offset for errors
+		u64                     value;              // constant value
+		symbol_entry *          symbol;             // symbol to read, write or call
+		u32                     memory;             // memory operand index when there is no symbol
+	};
+
 	// internal helpers
 	void copy(const parsed_expression &src);
 	void print_tokens();
@@ -362,6 +392,12 @@ private:
 	u64 execute_tokens();
 	void execute_function(parse_token &token);
 
+	// compiled execution helpers
+	void compile_tokens();
+	u64 execute_program();
+	u64 get_compiled_lval(const compiled_op &op, u64 address);
+	void set_compiled_lval(const compiled_op &op, u64 address, u64 value);
+
 	// constants
 	static const int MAX_FUNCTION_PARAMS = 16;
 
@@ -372,6 +408,9 @@ private:
 	std::list<parse_token> m_tokenlist;                 // token list
 	std::list<std::string> m_stringlist;                // string list
 	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<compiled_op> m_program;                 // compiled tokens, or empty to interpret them
+	std::vector<compiled_memory> m_memories;            // memory operands of the compiled tokens
+	std::vector<u64>    m_slots;                        // stack slots (used during compiled execution)
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
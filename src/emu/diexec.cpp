@@ -64,6 +64,9 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_trigger(0)
 	, m_inttrigger(0)
 	, m_totalcycles(0)
+	, m_host_ticks(0)
+	, m_timing_weight(1)
+	, m_timing_countdown(0)
 	, m_divisor(0)
 	, m_divshift(0)
 	, m_cycles_per_second(0)
@@ -186,6 +186,10 @@ public:
 	attotime local_time() const noexcept;
 	u64 total_cycles() const noexcept;
 
+	// host time spent executing since last reset, for frame telemetry
+	osd_ticks_t host_ticks() const noexcept { return m_host_ticks; }
+	void reset_host_ticks() noexcept { m_host_ticks = 0; }
+
 	// required operation overrides
 	void run() { execute_run(); }
 
@@ -318,6 +322,9 @@ private:
 
 	// clock and timing information
 	u64                     m_totalcycles;              // total device cycles executed
+	osd_ticks_t             m_host_ticks;               // host time spent executing since last reset
+	u32                     m_timing_weight;            // timeslices each timed one stands for
+	u32                     m_timing_countdown;         // untimed timeslices left before the next timed one
 	attotime                m_localtime;                // local time, relative to the timer system's global time
 	s32                     m_divisor;                  // 32-bit attoseconds_per_cycle divisor
 	u8                      m_divshift;                 // right shift amount to fit the divisor into 32 bits
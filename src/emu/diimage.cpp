@@ -439,7 +439,7 @@ void device_image_interface::battery_load(void *buffer, int length, int fill)
 	if (!buffer || (length <= 0))
 		throw emu_fatalerror("device_image_interface::battery_load: Must specify sensical buffer/length");
 
-	std::string const fname = std::string(device().machine().system().name).append(PATH_SEPARATOR).append(m_basename_noext).append(".nv");
+	std::string const fname = battery_filename();
 
 	/* try to open the battery file and read it in, if possible */
 	emu_file file(device().machine().options().nvram_directory(), OPEN_FLAG_READ);
@@ -457,7 +457,7 @@ void device_image_interface::battery_load(void *buffer, int length, const void *
 	if (!buffer || (length <= 0))
 		throw emu_fatalerror("device_image_interface::battery_load: Must specify sensical buffer/length");
 
-	std::string const fname = std::string(device().machine().system().name).append(PATH_SEPARATOR).append(m_basename_noext).append(".nv");
+	std::string const fname = battery_filename();
 
 	// try to open the battery file and read it in, if possible
 	emu_file file(device().machine().options().nvram_directory(), OPEN_FLAG_READ);
@@ -487,7 +487,7 @@ void device_image_interface::battery_save(const void *buffer, int length)
 	if (!device().machine().options().nvram_save())
 		return;
 
-	std::string fname = std::string(device().machine().system().name).append(PATH_SEPARATOR).append(m_basename_noext).append(".nv");
+	std::string const fname = battery_filename();
 
 	// try to open the battery file and write it out, if possible
 	emu_file file(device().machine().options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
@@ -497,6 +497,18 @@ void device_image_interface::battery_save(const void *buffer, int length)
 }
 
 
+//-------------------------------------------------
+//  battery_filename - name of the battery file
+//  for the current image, relative to the NVRAM
+//  directory
+//-------------------------------------------------
+
+std::string device_image_interface::battery_filename() const
+{
+	return std::string(device().machine().system().name).append(PATH_SEPARATOR).append(m_basename_noext).append(".nv");
+}
+
+
 // ***************************************************************************
 // IMAGE LOADING
 // ***************************************************************************
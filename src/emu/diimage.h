@@ -93,6 +93,7 @@ public:
 	virtual image_init_result call_load() { return image_init_result::PASS; }
 	virtual image_init_result call_create(int format_type, util::option_resolution *format_options) { return image_init_result::PASS; }
 	virtual void call_unload() { }
+	virtual bool battery_snapshot(std::vector<u8> &data) { return false; }
 	virtual std::string call_display() { return std::string(); }
 	virtual u32 unhashed_header_length() const noexcept { return 0; }
 	virtual bool core_opens_image_file() const noexcept { return true; }
@@ -199,6 +200,7 @@ public:
 	void battery_load(void *buffer, int length, int fill);
 	void battery_load(void *buffer, int length, const void *def_buffer);
 	void battery_save(const void *buffer, int length);
+	std::string battery_filename() const;
 
 	const std::string &instance_name() const { return m_instance_name; }
 	const std::string &brief_instance_name() const { return m_brief_instance_name; }
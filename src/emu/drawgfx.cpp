@@ -11,6 +11,18 @@
 #include "emu.h"
 #include "drawgfxt.ipp"
 
+// use SSE2 or NEON to skip transparent runs where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define DRAWGFX_SSE2    1
+#include <emmintrin.h>
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__ARM_NEON) && defined(__aarch64__)
+#define DRAWGFX_NEON    1
+#include <arm_neon.h>
+#endif
+
+// set to 1 to check the span blitters against the per-pixel cores on random sprites
+#define DRAWGFX_VERIFY_SIMD     0
+
 
 /***************************************************************************
     INLINE FUNCTIONS
@@ -51,6 +63,211 @@ static inline s32 normalize_yscroll(const bitmap_t &bitmap, s32 yscroll)
 }
 
 
+/*-------------------------------------------------
+    opaque_mask16 - return a bitmask of which of
+    the next 16 pens differ from trans_pen
+-------------------------------------------------*/
+
+#if defined(DRAWGFX_SSE2)
+static inline u32 opaque_mask16(const u8 *src, u8 trans_pen)
+{
+	__m128i pens = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+	return ~_mm_movemask_epi8(_mm_cmpeq_epi8(pens, _mm_set1_epi8(trans_pen))) & 0xffff;
+}
+#elif defined(DRAWGFX_NEON)
+static inline u32 opaque_mask16(const u8 *src, u8 trans_pen)
+{
+	static const u8 s_bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	uint8x16_t opaque = vmvnq_u8(vceqq_u8(vld1q_u8(src), vdupq_n_u8(trans_pen)));
+	uint8x16_t bits = vandq_u8(opaque, vld1q_u8(s_bits));
+	return vaddv_u8(vget_low_u8(bits)) | (vaddv_u8(vget_high_u8(bits)) << 8);
+}
+#endif
+
+
+/*-------------------------------------------------
+    span_transpen - apply a per-pixel operation
+    across a run of pens, skipping blocks of 16
+    that are entirely trans_pen
+-------------------------------------------------*/
+
+template <typename FunctionClass>
+static inline void span_transpen(const u8 *src, s32 count, u32 trans_pen, FunctionClass pixel_op)
+{
+	s32 i = 0;
+#if defined(DRAWGFX_SSE2) || defined(DRAWGFX_NEON)
+	if (trans_pen <= 0xff)
+		for ( ; i + 16 <= count; i += 16)
+			if (opaque_mask16(&src[i], trans_pen) != 0)
+				for (s32 j = i; j < i + 16; j++)
+					pixel_op(j);
+#endif
+	for ( ; i < count; i++)
+		pixel_op(i);
+}
+
+
+/*-------------------------------------------------
+    span_transpen_ind16 - draw a run of pens into
+    a 16bpp destination, adding 'color' to all
+    pens except trans_pen
+-------------------------------------------------*/
+
+static inline void span_transpen_ind16(u16 *dest, const u8 *src, s32 count, u32 trans_pen, u16 color)
+{
+	s32 i = 0;
+#if defined(DRAWGFX_SSE2)
+	const __m128i vtrans = _mm_set1_epi8(trans_pen);
+	const __m128i vcolor = _mm_set1_epi16(color);
+	const __m128i zero = _mm_setzero_si128();
+	for ( ; trans_pen <= 0xff && i + 16 <= count; i += 16)
+	{
+		__m128i pens = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[i]));
+		__m128i trans = _mm_cmpeq_epi8(pens, vtrans);
+		if (_mm_movemask_epi8(trans) == 0xffff)
+			continue;
+
+		__m128i *d = reinterpret_cast<__m128i *>(&dest[i]);
+		__m128i translo = _mm_unpacklo_epi8(trans, trans);
+		__m128i transhi = _mm_unpackhi_epi8(trans, trans);
+		__m128i pixlo = _mm_add_epi16(_mm_unpacklo_epi8(pens, zero), vcolor);
+		__m128i pixhi = _mm_add_epi16(_mm_unpackhi_epi8(pens, zero), vcolor);
+		_mm_storeu_si128(&d[0], _mm_or_si128(_mm_and_si128(translo, _mm_loadu_si128(&d[0])), _mm_andnot_si128(translo, pixlo)));
+		_mm_storeu_si128(&d[1], _mm_or_si128(_mm_and_si128(transhi, _mm_loadu_si128(&d[1])), _mm_andnot_si128(transhi, pixhi)));
+	}
+#elif defined(DRAWGFX_NEON)
+	const uint8x16_t vtrans = vdupq_n_u8(trans_pen);
+	const uint16x8_t vcolor = vdupq_n_u16(color);
+	for ( ; trans_pen <= 0xff && i + 16 <= count; i += 16)
+	{
+		uint8x16_t pens = vld1q_u8(&src[i]);
+		uint8x16_t trans = vceqq_u8(pens, vtrans);
+		if (vminvq_u8(trans) == 0xff)
+			continue;
+
+		uint16x8_t translo = vreinterpretq_u16_u8(vzip1q_u8(trans, trans));
+		uint16x8_t transhi = vreinterpretq_u16_u8(vzip2q_u8(trans, trans));
+		uint16x8_t pixlo = vaddq_u16(vmovl_u8(vget_low_u8(pens)), vcolor);
+		uint16x8_t pixhi = vaddq_u16(vmovl_u8(vget_high_u8(pens)), vcolor);
+		vst1q_u16(&dest[i + 0], vbslq_u16(translo, vld1q_u16(&dest[i + 0]), pixlo));
+		vst1q_u16(&dest[i + 8], vbslq_u16(transhi, vld1q_u16(&dest[i + 8]), pixhi));
+	}
+#endif
+	for ( ; i < count; i++)
+		if (src[i] != trans_pen)
+			dest[i] = color + src[i];
+}
+
+
+/*-------------------------------------------------
+    verify_span_blitters - draw random sprites
+    with the span blitters and with the original
+    per-pixel cores, and make sure the results
+    are identical
+-------------------------------------------------*/
+
+static void verify_span_blitters()
+{
+	constexpr int BITMAP_SIZE = 96;
+	u32 seed = 0x2468ace1;
+	auto rand = [&seed] () { seed = seed * 1103515245 + 12345; return (seed >> 16) & 0x7fff; };
+
+	std::vector<u8> pens(64 * 64);
+	pen_t paldata[256];
+	for (pen_t &pen : paldata)
+		pen = (rand() << 17) ^ rand();
+
+	bitmap_ind16 dest16(BITMAP_SIZE, BITMAP_SIZE), ref16(BITMAP_SIZE, BITMAP_SIZE);
+	bitmap_rgb32 dest32(BITMAP_SIZE, BITMAP_SIZE), ref32(BITMAP_SIZE, BITMAP_SIZE);
+	bitmap_ind8 priority(BITMAP_SIZE, BITMAP_SIZE), refpriority(BITMAP_SIZE, BITMAP_SIZE);
+
+	for (int iter = 0; iter < 20000; iter++)
+	{
+		// random sprite with long transparent runs
+		u32 const trans_pen = (rand() % 16) ? (rand() & 0x0f) : 0x100;
+		int const density = rand() % 5;
+		for (u8 &pen : pens)
+			pen = (int(rand() % 4) < density) ? (rand() & 0x0f) : u8(trans_pen);
+		gfx_element gfx(nullptr, &pens[0], 1 + rand() % 64, 1 + rand() % 64, 64, 256, 0, 16);
+
+		// random placement, scale and clipping
+		int const flipx = rand() & 1, flipy = rand() & 1;
+		s32 const destx = int(rand() % (BITMAP_SIZE + 80)) - 80, desty = int(rand() % (BITMAP_SIZE + 80)) - 80;
+		u32 const scalex = (rand() & 1) ? 0x10000 : (0x2000 + rand() * 6);
+		u32 const scaley = (rand() & 1) ? 0x10000 : (0x2000 + rand() * 6);
+		s32 const minx = rand() % BITMAP_SIZE, miny = rand() % BITMAP_SIZE;
+		rectangle const clip(minx, minx + rand() % (BITMAP_SIZE - minx), miny, miny + rand() % (BITMAP_SIZE - miny));
+		u32 const color = rand() & 0xfff0;
+		u32 const pmask = (rand() << 16) ^ rand() ^ (1 << 31);
+		u8 const alpha_val = rand();
+
+		for (int y = 0; y < BITMAP_SIZE; y++)
+			for (int x = 0; x < BITMAP_SIZE; x++)
+			{
+				dest16.pix(y, x) = ref16.pix(y, x) = rand();
+				dest32.pix(y, x) = ref32.pix(y, x) = (rand() << 17) ^ rand();
+				priority.pix(y, x) = refpriority.pix(y, x) = rand() & 0x1f;
+			}
+
+		// draw with the original cores, using the unzoomed ones where the public entry points would
+		bool const unzoomed = (scalex == 0x10000 && scaley == 0x10000);
+		auto reference = [&] (auto &dest, auto pixel_op)
+		{
+			if (unzoomed)
+				gfx.drawgfx_core(dest, clip, 0, flipx, flipy, destx, desty, pixel_op);
+			else
+				gfx.drawgfxzoom_core(dest, clip, 0, flipx, flipy, destx, desty, scalex, scaley, pixel_op);
+		};
+		auto reference_prio = [&] (auto &dest, auto pixel_op)
+		{
+			if (unzoomed)
+				gfx.drawgfx_core(dest, clip, 0, flipx, flipy, destx, desty, refpriority, pixel_op);
+			else
+				gfx.drawgfxzoom_core(dest, clip, 0, flipx, flipy, destx, desty, scalex, scaley, refpriority, pixel_op);
+		};
+
+		int const test = iter % 5;
+		switch (test)
+		{
+		case 0:
+			reference(ref16, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+			gfx.drawgfx_span_core(dest16, clip, 0, flipx, flipy, destx, desty, scalex, scaley, nullptr,
+					[trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen_ind16(destp, srcp, count, trans_pen, color); });
+			break;
+
+		case 1:
+			reference(ref32, [trans_pen, &paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+			gfx.drawgfx_span_core(dest32, clip, 0, flipx, flipy, destx, desty, scalex, scaley, nullptr,
+					[trans_pen, &paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [trans_pen, &paldata, destp, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN(destp[i], srcp[i]); }); });
+			break;
+
+		case 2:
+			reference_prio(ref16, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+			gfx.drawgfx_span_core(dest16, clip, 0, flipx, flipy, destx, desty, scalex, scaley, &priority,
+					[pmask, trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, color, destp, prip, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
+			break;
+
+		case 3:
+			reference_prio(ref32, [pmask, trans_pen, &paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); });
+			gfx.drawgfx_span_core(dest32, clip, 0, flipx, flipy, destx, desty, scalex, scaley, &priority,
+					[pmask, trans_pen, &paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, &paldata, destp, prip, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
+			break;
+
+		case 4:
+			reference(ref32, [trans_pen, alpha_val, &paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32(destp, srcp); });
+			gfx.drawgfx_span_core(dest32, clip, 0, flipx, flipy, destx, desty, scalex, scaley, nullptr,
+					[trans_pen, alpha_val, &paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [trans_pen, alpha_val, &paldata, destp, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32(destp[i], srcp[i]); }); });
+			break;
+		}
+
+		for (int y = 0; y < BITMAP_SIZE; y++)
+			for (int x = 0; x < BITMAP_SIZE; x++)
+				if (dest16.pix(y, x) != ref16.pix(y, x) || dest32.pix(y, x) != ref32.pix(y, x) || priority.pix(y, x) != refpriority.pix(y, x))
+					fatalerror("drawgfx: span blitter %d differs from the reference at (%d,%d) (iteration %d)\n", test, x, y, iter);
+	}
+}
+
+
 
 //**************************************************************************
 //  DEVICE DEFINITIONS
@@ -126,6 +343,13 @@ gfx_element::gfx_element(device_palette_interface *palette, const gfx_layout &gl
 {
 	// set the layout
 	set_layout(gl, srcdata);
+
+	// run the span blitter check once, before anything is drawn
+	if (DRAWGFX_VERIFY_SIMD)
+	{
+		static bool const verified = (verify_span_blitters(), true);
+		(void)verified;
+	}
 }
 
 
@@ -395,7 +619,8 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, nullptr,
+			[trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen_ind16(destp, srcp, count, trans_pen, color); });
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -422,7 +647,8 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, nullptr,
+			[trans_pen, paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [trans_pen, paldata, destp, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN(destp[i], srcp[i]); }); });
 }
 
 
@@ -442,7 +668,8 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, nullptr,
+			[trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen_ind16(destp, srcp, count, trans_pen, color); });
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -455,7 +682,8 @@ void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u32 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, nullptr,
+			[trans_pen, color](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [trans_pen, color, destp, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN(destp[i], srcp[i]); }); });
 }
 
 
@@ -487,6 +715,10 @@ void gfx_element::transmask(bitmap_ind16 &dest, const rectangle &cliprect,
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 	}
 
+	// a single transparent pen draws exactly like transpen (pen usage implies pens below 32)
+	if (has_pen_usage() && (trans_mask & (trans_mask - 1)) == 0)
+		return transpen(dest, cliprect, code, color, flipx, flipy, destx, desty, 31 - count_leading_zeros_32(trans_mask));
+
 	// render
 	color = colorbase() + granularity() * (color % colors());
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_mask, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSMASK(destp, srcp); });
@@ -514,6 +746,10 @@ void gfx_element::transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 	}
 
+	// a single transparent pen draws exactly like transpen (pen usage implies pens below 32)
+	if (has_pen_usage() && (trans_mask & (trans_mask - 1)) == 0)
+		return transpen(dest, cliprect, code, color, flipx, flipy, destx, desty, 31 - count_leading_zeros_32(trans_mask));
+
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_mask, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSMASK(destp, srcp); });
@@ -574,7 +810,8 @@ void gfx_element::alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// get final code and color, and grab lookup tables
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, alpha_val, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, nullptr,
+			[trans_pen, alpha_val, paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [trans_pen, alpha_val, paldata, destp, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32(destp[i], srcp[i]); }); });
 }
 
 
@@ -650,7 +887,8 @@ void gfx_element::zoom_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, nullptr,
+			[trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen_ind16(destp, srcp, count, trans_pen, color); });
 }
 
 void gfx_element::zoom_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -681,7 +919,8 @@ void gfx_element::zoom_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, nullptr,
+			[trans_pen, paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [trans_pen, paldata, destp, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN(destp[i], srcp[i]); }); });
 }
 
 
@@ -705,7 +944,8 @@ void gfx_element::zoom_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 		return;
 
 	// render
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, nullptr,
+			[trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen_ind16(destp, srcp, count, trans_pen, color); });
 }
 
 void gfx_element::zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -722,7 +962,8 @@ void gfx_element::zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprec
 		return;
 
 	// render
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, [trans_pen, color](u32 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, nullptr,
+			[trans_pen, color](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [trans_pen, color, destp, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN(destp[i], srcp[i]); }); });
 }
 
 
@@ -758,6 +999,10 @@ void gfx_element::zoom_transmask(bitmap_ind16 &dest, const rectangle &cliprect,
 			return zoom_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley);
 	}
 
+	// a single transparent pen draws exactly like transpen (pen usage implies pens below 32)
+	if (has_pen_usage() && (trans_mask & (trans_mask - 1)) == 0)
+		return zoom_transpen(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, 31 - count_leading_zeros_32(trans_mask));
+
 	// render
 	color = colorbase() + granularity() * (color % colors());
 	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, [trans_mask, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSMASK(destp, srcp); });
@@ -789,6 +1034,10 @@ void gfx_element::zoom_transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
 			return zoom_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley);
 	}
 
+	// a single transparent pen draws exactly like transpen (pen usage implies pens below 32)
+	if (has_pen_usage() && (trans_mask & (trans_mask - 1)) == 0)
+		return zoom_transpen(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, 31 - count_leading_zeros_32(trans_mask));
+
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, [trans_mask, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSMASK(destp, srcp); });
@@ -861,7 +1110,8 @@ void gfx_element::zoom_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, [trans_pen, alpha_val, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32(destp, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, nullptr,
+			[trans_pen, alpha_val, paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [trans_pen, alpha_val, paldata, destp, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32(destp[i], srcp[i]); }); });
 }
 
 
@@ -936,7 +1186,8 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, &priority,
+			[pmask, trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, color, destp, prip, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -966,7 +1217,8 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, &priority,
+			[pmask, trans_pen, paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, paldata, destp, prip, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 
@@ -989,7 +1241,8 @@ void gfx_element::prio_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, &priority,
+			[pmask, trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, color, destp, prip, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1005,7 +1258,8 @@ void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, &priority,
+			[pmask, trans_pen, color](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, color, destp, prip, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 
@@ -1037,6 +1291,10 @@ void gfx_element::prio_transmask(bitmap_ind16 &dest, const rectangle &cliprect,
 			return prio_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, priority, pmask);
 	}
 
+	// a single transparent pen draws exactly like transpen (pen usage implies pens below 32)
+	if (has_pen_usage() && (trans_mask & (trans_mask - 1)) == 0)
+		return prio_transpen(dest, cliprect, code, color, flipx, flipy, destx, desty, priority, pmask, 31 - count_leading_zeros_32(trans_mask));
+
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
@@ -1067,6 +1325,10 @@ void gfx_element::prio_transmask(bitmap_rgb32 &dest, const rectangle &cliprect,
 			return prio_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, priority, pmask);
 	}
 
+	// a single transparent pen draws exactly like transpen (pen usage implies pens below 32)
+	if (has_pen_usage() && (trans_mask & (trans_mask - 1)) == 0)
+		return prio_transpen(dest, cliprect, code, color, flipx, flipy, destx, desty, priority, pmask, 31 - count_leading_zeros_32(trans_mask));
+
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
@@ -1141,7 +1403,8 @@ void gfx_element::prio_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, alpha_val, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, 0x10000, 0x10000, &priority,
+			[pmask, trans_pen, alpha_val, paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, alpha_val, paldata, destp, prip, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 
@@ -1229,7 +1492,8 @@ void gfx_element::prio_zoom_transpen(bitmap_ind16 &dest, const rectangle &clipre
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, &priority,
+			[pmask, trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, color, destp, prip, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 void gfx_element::prio_zoom_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1264,7 +1528,8 @@ void gfx_element::prio_zoom_transpen(bitmap_rgb32 &dest, const rectangle &clipre
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, [pmask, trans_pen, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, &priority,
+			[pmask, trans_pen, paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, paldata, destp, prip, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 
@@ -1293,7 +1558,8 @@ void gfx_element::prio_zoom_transpen_raw(bitmap_ind16 &dest, const rectangle &cl
 	pmask |= 1 << 31;
 
 	// render
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, &priority,
+			[pmask, trans_pen, color](u16 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, color, destp, prip, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 void gfx_element::prio_zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1314,7 +1580,8 @@ void gfx_element::prio_zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cl
 	pmask |= 1 << 31;
 
 	// render
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, [pmask, trans_pen, color](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, &priority,
+			[pmask, trans_pen, color](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, color, destp, prip, srcp](s32 i) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 
@@ -1352,6 +1619,10 @@ void gfx_element::prio_zoom_transmask(bitmap_ind16 &dest, const rectangle &clipr
 			return prio_zoom_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, priority, pmask);
 	}
 
+	// a single transparent pen draws exactly like transpen (pen usage implies pens below 32)
+	if (has_pen_usage() && (trans_mask & (trans_mask - 1)) == 0)
+		return prio_zoom_transpen(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, priority, pmask, 31 - count_leading_zeros_32(trans_mask));
+
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
@@ -1387,6 +1658,10 @@ void gfx_element::prio_zoom_transmask(bitmap_rgb32 &dest, const rectangle &clipr
 			return prio_zoom_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, priority, pmask);
 	}
 
+	// a single transparent pen draws exactly like transpen (pen usage implies pens below 32)
+	if (has_pen_usage() && (trans_mask & (trans_mask - 1)) == 0)
+		return prio_zoom_transpen(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, priority, pmask, 31 - count_leading_zeros_32(trans_mask));
+
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
@@ -1477,7 +1752,8 @@ void gfx_element::prio_zoom_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfxzoom_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, priority, [pmask, trans_pen, alpha_val, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32_PRIORITY(destp, pri, srcp); });
+	drawgfx_span_core(dest, cliprect, code, flipx, flipy, destx, desty, scalex, scaley, &priority,
+			[pmask, trans_pen, alpha_val, paldata](u32 *destp, u8 *prip, const u8 *srcp, s32 count) { span_transpen(srcp, count, trans_pen, [pmask, trans_pen, alpha_val, paldata, destp, prip, srcp](s32 i) { PIXEL_OP_REMAP_TRANSPEN_ALPHA32_PRIORITY(destp[i], prip[i], srcp[i]); }); });
 }
 
 
@@ -955,6 +955,144 @@ inline void gfx_element::drawgfxzoom_core(BitmapType &dest, const rectangle &cli
 
 
 
+/***************************************************************************
+    BASIC SPAN CORE
+***************************************************************************/
+
+/*
+    Input parameters:
+
+        bitmap_t &dest - the bitmap to render to
+        const rectangle &cliprect - a clipping rectangle (assumed to be clipped to the size of 'dest')
+        u32 code - index of the entry within gfx_element
+        int flipx - non-zero means render right-to-left instead of left-to-right
+        int flipy - non-zero means render bottom-to-top instead of top-to-bottom
+        s32 destx - the top-left X coordinate to render to
+        s32 desty - the top-left Y coordinate to render to
+        u32 scalex - the 16.16 scale factor in the X dimension
+        u32 scaley - the 16.16 scale factor in the Y dimension
+        bitmap_t *priority - the priority bitmap, or nullptr if priority is not to be applied
+
+    Clipping and stepping are identical to drawgfxzoom_core, which also
+    covers the unzoomed case exactly. span_op is called as
+    span_op(destptr, priptr, srcptr, count) with runs of source pens in
+    destination order; priptr is nullptr when there is no priority bitmap.
+    Unflipped, unzoomed rows are passed straight from the element data,
+    anything else is gathered into a small buffer first.
+*/
+
+template <typename BitmapType, typename FunctionClass>
+inline void gfx_element::drawgfx_span_core(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, u32 scalex, u32 scaley, bitmap_ind8 *priority, FunctionClass span_op)
+{
+	g_profiler.start(PROFILER_DRAWGFX);
+	do {
+		assert(dest.valid());
+		assert(priority == nullptr || priority->valid());
+		assert(dest.cliprect().contains(cliprect));
+		assert(code < elements());
+
+		// ignore empty/invalid cliprects
+		if (cliprect.empty())
+			break;
+
+		// compute scaled size
+		u32 dstwidth = (scalex * width() + 0x8000) >> 16;
+		u32 dstheight = (scaley * height() + 0x8000) >> 16;
+		if (dstwidth < 1 || dstheight < 1)
+			break;
+
+		// compute 16.16 source steps in dx and dy
+		s32 dx = (width() << 16) / dstwidth;
+		s32 dy = (height() << 16) / dstheight;
+
+		// compute final pixel in X and exit if we are entirely clipped
+		s32 destendx = destx + dstwidth - 1;
+		if (destx > cliprect.right() || destendx < cliprect.left())
+			break;
+
+		// apply left clip
+		s32 srcx = 0;
+		if (destx < cliprect.left())
+		{
+			srcx = (cliprect.left() - destx) * dx;
+			destx = cliprect.left();
+		}
+
+		// apply right clip
+		if (destendx > cliprect.right())
+			destendx = cliprect.right();
+
+		// compute final pixel in Y and exit if we are entirely clipped
+		s32 destendy = desty + dstheight - 1;
+		if (desty > cliprect.bottom() || destendy < cliprect.top())
+			break;
+
+		// apply top clip
+		s32 srcy = 0;
+		if (desty < cliprect.top())
+		{
+			srcy = (cliprect.top() - desty) * dy;
+			desty = cliprect.top();
+		}
+
+		// apply bottom clip
+		if (destendy > cliprect.bottom())
+			destendy = cliprect.bottom();
+
+		// apply X flipping
+		if (flipx)
+		{
+			srcx = (dstwidth - 1) * dx - srcx;
+			dx = -dx;
+		}
+
+		// apply Y flipping
+		if (flipy)
+		{
+			srcy = (dstheight - 1) * dy - srcy;
+			dy = -dy;
+		}
+
+		// fetch the source data
+		const u8 *srcdata = get_data(code);
+		s32 const numpixels = destendx + 1 - destx;
+
+		// iterate over pixels in Y
+		for (s32 cury = desty; cury <= destendy; cury++)
+		{
+			auto *destptr = &dest.pix(cury, destx);
+			u8 *priptr = priority ? &priority->pix(cury, destx) : nullptr;
+			const u8 *srcptr = srcdata + (srcy >> 16) * rowbytes();
+			srcy += dy;
+
+			// straight copy of the source row
+			if (dx == 0x10000)
+			{
+				span_op(destptr, priptr, &srcptr[srcx >> 16], numpixels);
+				continue;
+			}
+
+			// otherwise gather flipped/scaled pens a chunk at a time
+			u8 rowbuf[256];
+			s32 cursrcx = srcx;
+			for (s32 curx = 0; curx < numpixels; )
+			{
+				s32 const chunk = std::min<s32>(numpixels - curx, std::size(rowbuf));
+				for (s32 i = 0; i < chunk; i++)
+				{
+					rowbuf[i] = srcptr[cursrcx >> 16];
+					cursrcx += dx;
+				}
+				span_op(destptr + curx, priptr ? (priptr + curx) : nullptr, rowbuf, chunk);
+				curx += chunk;
+			}
+		}
+	} while (0);
+	g_profiler.stop();
+}
+
+
+
 /***************************************************************************
     BASIC COPYBITMAP CORE
 ***************************************************************************/
@@ -35,6 +35,7 @@
 #include "eminline.h"
 #include "xtal.h"
 #include "attotime.h"
+#include "osdtrace.h"
 #include "profiler.h"
 
 // commonly-referenced utilities imported from lib/util
@@ -160,6 +160,9 @@ class emu_options;
 // declared in fileio.h
 class emu_file;
 
+// declared in frametime.h
+class frame_telemetry;
+
 // declared in http.h
 class http_manager;
 
@@ -198,6 +201,9 @@ class machine_config;
 // declared in natkeyboard.h
 class natural_keyboard;
 
+// declared in nvramsave.h
+class nvram_autosave_manager;
+
 // declared in network.h
 class network_manager;
 
@@ -1038,6 +1038,8 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	: m_machine(machine),
 		m_name(std::move(name)),
 		m_buffer(length),
+		m_base(length ? &m_buffer[0] : nullptr),
+		m_length(length),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
@@ -1045,6 +1047,16 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	assert(width == 1 || width == 2 || width == 4 || width == 8);
 }
 
+void memory_region::attach_mapping(std::shared_ptr<u8> &&data)
+{
+	assert(data);
+
+	// the mapping must cover the whole region; release our own buffer
+	m_mapping = std::move(data);
+	m_base = m_mapping.get();
+	std::vector<u8>().swap(m_buffer);
+}
+
 std::string memory_share::compare(u8 width, size_t bytes, endianness_t endianness) const
 {
 	if (width != m_bitwidth)
@@ -2528,10 +2528,11 @@ public:
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
-	u8 *end() { return base() + m_buffer.size(); }
-	u32 bytes() const { return m_buffer.size(); }
+	u8 *base() { return m_base; }
+	u8 *end() { return m_base + m_length; }
+	u32 bytes() const { return m_length; }
 	const std::string &name() const { return m_name; }
+	bool is_mapped() const { return bool(m_mapping); }
 
 	// flag expansion
 	endianness_t endianness() const { return m_endianness; }
@@ -2539,16 +2540,22 @@ public:
 	u8 bytewidth() const { return m_bytewidth; }
 
 	// data access
-	u8 &as_u8(offs_t offset = 0) { return m_buffer[offset]; }
+	u8 &as_u8(offs_t offset = 0) { return m_base[offset]; }
 	u16 &as_u16(offs_t offset = 0) { return reinterpret_cast<u16 *>(base())[offset]; }
 	u32 &as_u32(offs_t offset = 0) { return reinterpret_cast<u32 *>(base())[offset]; }
 	u64 &as_u64(offs_t offset = 0) { return reinterpret_cast<u64 *>(base())[offset]; }
 
+	// back the region with a copy-on-write file mapping instead of its own buffer
+	void attach_mapping(std::shared_ptr<u8> &&data);
+
 private:
 	// internal data
 	running_machine &       m_machine;
 	std::string             m_name;
 	std::vector<u8>         m_buffer;
+	std::shared_ptr<u8>     m_mapping;
+	u8 *                    m_base;
+	u32                     m_length;
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -61,6 +61,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      core_options::option_type::STRING,     "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  core_options::option_type::STRING,     "directory to save debugger comments" },
 	{ OPTION_SHARE_DIRECTORY,                            "share",     core_options::option_type::STRING,     "directory to share with emulated machines" },
+	{ OPTION_ARTCACHE_DIRECTORY,                         nullptr,     core_options::option_type::STRING,     "directory to cache rendered artwork elements in (not limited in size; empty to disable)" },
 
 	// state/playback options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
@@ -92,6 +93,16 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       core_options::option_type::FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         core_options::option_type::BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         core_options::option_type::BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_NETLIST_RUN_AHEAD,                          "1",         core_options::option_type::BOOLEAN,    "advance sound netlists ahead of the emulation on a worker thread" },
+	{ OPTION_TRACE_STARTUP,                              nullptr,     core_options::option_type::STRING,     "optional filename to write a trace of startup phases to on exit (Chrome trace JSON for .json, text otherwise)" },
+	{ OPTION_BENCH_STARTUP,                              "0",         core_options::option_type::INTEGER,    "start the system N times headless and report time to first frame; implies -video none -sound none -nothrottle" },
+	{ OPTION_BENCH_MANIFEST,                             nullptr,     core_options::option_type::STRING,     "run every system listed in a benchmark manifest headless and report speed and output hashes; implies -video none -sound none -nothrottle" },
+	{ OPTION_BENCH_RESULTS,                              nullptr,     core_options::option_type::STRING,     "optional filename to write -bench_manifest results to as JSON" },
+	{ OPTION_BENCH_WORKQUEUE,                            "0",         core_options::option_type::INTEGER,    "run the work queue contention benchmark for N seconds and report throughput and latency" },
+	{ OPTION_TELEMETRY_INTERVAL "(1-3600)",              "10",        core_options::option_type::INTEGER,    "seconds of frame timing to gather before publishing percentiles as outputs" },
+	{ OPTION_TELEMETRY_LOG,                              "0",         core_options::option_type::BOOLEAN,    "print a frame timing summary each telemetry interval" },
+	{ OPTION_TRACE_EVENTS,                               nullptr,     core_options::option_type::STRING,     "optional filename to write a Chrome trace of profiler scopes, device timeslices, timer callbacks and work items to on exit" },
+	{ OPTION_TRACE_WINDOW "(0-3600)",                    "0",         core_options::option_type::FLOAT,      "seconds of events before exit to include in the -trace_events file; 0 writes everything still buffered" },
 
 	// render options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE RENDER OPTIONS" },
@@ -208,6 +219,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UI_MOUSE,                                   "1",         core_options::option_type::BOOLEAN,    "display UI mouse cursor" },
 	{ OPTION_LANGUAGE ";lang",                           "",          core_options::option_type::STRING,     "set UI display language" },
 	{ OPTION_NVRAM_SAVE ";nvwrite",                      "1",         core_options::option_type::BOOLEAN,    "save NVRAM data on exit" },
+	{ OPTION_NVRAM_AUTOSAVE "(0-3600)",                  "0",         core_options::option_type::INTEGER,    "write changed NVRAM data every N seconds while running (0 = only on exit)" },
 
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "SCRIPTING OPTIONS" },
 	{ OPTION_AUTOBOOT_COMMAND ";ab",                     nullptr,     core_options::option_type::STRING,     "command to execute after machine boot" },
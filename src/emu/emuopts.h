@@ -48,6 +48,7 @@
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
 #define OPTION_SHARE_DIRECTORY      "share_directory"
+#define OPTION_ARTCACHE_DIRECTORY   "artcache_directory"
 
 // core state/playback options
 #define OPTION_STATE                "state"
@@ -76,6 +77,16 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_NETLIST_RUN_AHEAD    "netlist_run_ahead"
+#define OPTION_TRACE_STARTUP        "trace_startup"
+#define OPTION_BENCH_STARTUP        "bench_startup"
+#define OPTION_BENCH_MANIFEST       "bench_manifest"
+#define OPTION_BENCH_RESULTS        "bench_results"
+#define OPTION_BENCH_WORKQUEUE      "bench_workqueue"
+#define OPTION_TELEMETRY_INTERVAL   "telemetry_interval"
+#define OPTION_TELEMETRY_LOG        "telemetry_log"
+#define OPTION_TRACE_EVENTS         "trace_events"
+#define OPTION_TRACE_WINDOW         "trace_window"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -171,6 +182,7 @@
 #define OPTION_UI                   "ui"
 #define OPTION_RAMSIZE              "ramsize"
 #define OPTION_NVRAM_SAVE           "nvram_save"
+#define OPTION_NVRAM_AUTOSAVE       "nvram_autosave"
 
 // core comm options
 #define OPTION_COMM_LOCAL_HOST      "comm_localhost"
@@ -333,6 +345,7 @@ public:
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
 	const char *share_directory() const { return value(OPTION_SHARE_DIRECTORY); }
+	const char *artcache_directory() const { return value(OPTION_ARTCACHE_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
@@ -361,6 +374,16 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	bool netlist_run_ahead() const { return bool_value(OPTION_NETLIST_RUN_AHEAD); }
+	const char *trace_startup() const { return value(OPTION_TRACE_STARTUP); }
+	int bench_startup() const { return int_value(OPTION_BENCH_STARTUP); }
+	const char *bench_manifest() const { return value(OPTION_BENCH_MANIFEST); }
+	const char *bench_results() const { return value(OPTION_BENCH_RESULTS); }
+	int bench_workqueue() const { return int_value(OPTION_BENCH_WORKQUEUE); }
+	int telemetry_interval() const { return int_value(OPTION_TELEMETRY_INTERVAL); }
+	bool telemetry_log() const { return bool_value(OPTION_TELEMETRY_LOG); }
+	const char *trace_events() const { return value(OPTION_TRACE_EVENTS); }
+	float trace_window() const { return float_value(OPTION_TRACE_WINDOW); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -454,6 +477,7 @@ public:
 	ui_option ui() const { return m_ui; }
 	const char *ram_size() const { return value(OPTION_RAMSIZE); }
 	bool nvram_save() const { return bool_value(OPTION_NVRAM_SAVE); }
+	int nvram_autosave() const { return int_value(OPTION_NVRAM_AUTOSAVE); }
 
 	// core comm options
 	const char *comm_localhost() const { return value(OPTION_COMM_LOCAL_HOST); }
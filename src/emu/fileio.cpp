@@ -211,6 +211,7 @@ emu_file::emu_file(u32 openflags, empty_t)
 	, m_openflags(openflags)
 	, m_zipfile(nullptr)
 	, m_ziplength(0)
+	, m_maplength(0)
 	, m_remove_on_close(false)
 	, m_restrict_to_mediapath(0)
 {
@@ -267,7 +268,7 @@ util::hash_collection &emu_file::hashes(std::string_view types)
 		return m_hashes;
 
 	// load the ZIP file if needed
-	if (compressed_file_ready())
+	if (!m_mapping && compressed_file_ready())
 		return m_hashes;
 	if (m_file == nullptr)
 		return m_hashes;
@@ -279,6 +280,13 @@ util::hash_collection &emu_file::hashes(std::string_view types)
 		return m_hashes;
 	}
 
+	// likewise if the file is mapped
+	if (m_mapping)
+	{
+		m_hashes.compute(m_mapping.get(), m_maplength, needed.c_str());
+		return m_hashes;
+	}
+
 	std::uint64_t length;
 	if (m_file->length(length))
 		return m_hashes;
@@ -420,6 +428,8 @@ void emu_file::close()
 	m_file.reset();
 
 	m_zipdata.clear();
+	m_mapping.reset();
+	m_maplength = 0;
 
 	if (m_remove_on_close)
 		osd_file::remove(m_fullpath);
@@ -646,6 +656,63 @@ void emu_file::flush()
 }
 
 
+//-------------------------------------------------
+//  map - map the whole file into memory with
+//  copy-on-write pages, avoiding a copy for
+//  loose files and stored archive members
+//-------------------------------------------------
+
+std::error_condition emu_file::map(std::shared_ptr<u8> &data)
+{
+	// hand out the existing mapping if we have one
+	if (m_mapping)
+	{
+		data = m_mapping;
+		return std::error_condition();
+	}
+
+	if (m_zipfile)
+	{
+		// stored archive members can be mapped without decompressing
+		std::shared_ptr<u8> mapping;
+		std::error_condition err = m_zipfile->map(mapping);
+		if (err)
+			return err;
+
+		// reads go through the mapping from now on
+		err = util::core_file::open_ram(mapping.get(), m_ziplength, m_openflags, m_file);
+		if (err)
+			return err;
+		m_zipfile.reset();
+		m_mapping = std::move(mapping);
+		m_maplength = m_ziplength;
+	}
+	else if (m_file && m_zipdata.empty())
+	{
+		// plain files can be mapped if the OSD layer supports it
+		std::uint64_t length;
+		std::error_condition err = m_file->length(length);
+		if (err)
+			return err;
+		if (!length || (std::size_t(length) != length))
+			return std::errc::not_supported;
+		std::shared_ptr<u8> mapping;
+		err = m_file->map(0, std::size_t(length), mapping);
+		if (err)
+			return err;
+		m_mapping = std::move(mapping);
+		m_maplength = length;
+	}
+	else
+	{
+		return std::errc::not_supported;
+	}
+
+	data = m_mapping;
+	return std::error_condition();
+}
+
+
 //-------------------------------------------------
 //  part_of_mediapath - checks if 'path' is part of
 //  any media path
@@ -191,6 +191,9 @@ public:
 	// buffers
 	void flush();
 
+	// memory mapping
+	std::error_condition map(std::shared_ptr<u8> &data);
+
 private:
 	emu_file(u32 openflags, empty_t);
 	emu_file(path_iterator &&searchpath, u32 openflags);
@@ -232,6 +235,9 @@ private:
 	std::vector<u8>         m_zipdata;              // ZIP file data
 	u64                     m_ziplength;            // ZIP file length
 
+	std::shared_ptr<u8>     m_mapping;              // mapped file data
+	u64                     m_maplength;            // mapped file length
+
 	bool                    m_remove_on_close;      // flag: remove the file when closing
 	int                     m_restrict_to_mediapath; // flag: restrict to paths inside the media-path
 };
@@ -0,0 +1,306 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+/***************************************************************************
+
+    frametime.cpp
+
+    Always-on per-frame timing telemetry.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "frametime.h"
+
+#include "emuopts.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+
+//**************************************************************************
+//  FRAME HISTOGRAM
+//**************************************************************************
+
+//-------------------------------------------------
+//  bucket - get the bucket for a value; four
+//  buckets per power of two
+//-------------------------------------------------
+
+inline unsigned frame_histogram::bucket(u32 usec) noexcept
+{
+	if (usec < 4)
+		return usec;
+	unsigned const exponent = 31 - count_leading_zeros_32(usec);
+	return ((exponent - 1) << 2) | ((usec >> (exponent - 2)) & 3);
+}
+
+
+//-------------------------------------------------
+//  bucket_limit - get the largest value that
+//  falls in a bucket
+//-------------------------------------------------
+
+inline u32 frame_histogram::bucket_limit(unsigned index) noexcept
+{
+	if (index < 4)
+		return index;
+	unsigned const exponent = (index >> 2) + 1;
+	return (u64(5 + (index & 3)) << (exponent - 2)) - 1;
+}
+
+
+//-------------------------------------------------
+//  record - add a value to the histogram
+//-------------------------------------------------
+
+void frame_histogram::record(u32 usec) noexcept
+{
+	m_buckets[bucket(usec)].fetch_add(1, std::memory_order_relaxed);
+	m_count.fetch_add(1, std::memory_order_relaxed);
+
+	u32 previous = m_max.load(std::memory_order_relaxed);
+	while ((previous < usec) && !m_max.compare_exchange_weak(previous, usec, std::memory_order_relaxed)) { }
+}
+
+
+//-------------------------------------------------
+//  reset - clear all counts
+//-------------------------------------------------
+
+void frame_histogram::reset() noexcept
+{
+	for (std::atomic<u32> &count : m_buckets)
+		count.store(0, std::memory_order_relaxed);
+	m_count.store(0, std::memory_order_relaxed);
+	m_max.store(0, std::memory_order_relaxed);
+}
+
+
+//-------------------------------------------------
+//  percentile - get the value below which the
+//  given fraction of samples fall
+//-------------------------------------------------
+
+u32 frame_histogram::percentile(double fraction) const noexcept
+{
+	u32 const total = count();
+	if (!total)
+		return 0;
+
+	u32 const rank = std::clamp<u32>(u32(std::ceil(fraction * double(total))), 1, total);
+	u32 seen = 0;
+	for (unsigned index = 0; BUCKETS > index; ++index)
+	{
+		seen += m_buckets[index].load(std::memory_order_relaxed);
+		if (seen >= rank)
+			return (std::min)(bucket_limit(index), max());
+	}
+	return max();
+}
+
+
+
+//**************************************************************************
+//  FRAME TELEMETRY
+//**************************************************************************
+
+//-------------------------------------------------
+//  frame_telemetry - constructor
+//-------------------------------------------------
+
+frame_telemetry::frame_telemetry(running_machine &machine)
+	: m_machine(machine)
+	, m_ticks_per_second(osd_ticks_per_second())
+	, m_interval(m_ticks_per_second * machine.options().telemetry_interval())
+	, m_log(machine.options().telemetry_log())
+	, m_last_frame(0)
+	, m_next_report(osd_ticks() + m_interval)
+	, m_frames(0)
+	, m_skipped(0)
+{
+	for (std::atomic<osd_ticks_t> &accum : m_accum)
+		accum.store(0, std::memory_order_relaxed);
+
+	for (device_execute_interface &exec : execute_interface_enumerator(machine.root_device()))
+		m_devices.emplace_back(&exec);
+	m_device_histograms = std::make_unique<frame_histogram []>(m_devices.size());
+	m_device_totals = std::make_unique<osd_ticks_t []>(m_devices.size());
+	std::fill_n(&m_device_totals[0], m_devices.size(), 0);
+}
+
+
+//-------------------------------------------------
+//  ~frame_telemetry - destructor
+//-------------------------------------------------
+
+frame_telemetry::~frame_telemetry()
+{
+}
+
+
+//-------------------------------------------------
+//  device - get an executing device by index
+//-------------------------------------------------
+
+device_t &frame_telemetry::device(size_t index) const
+{
+	return m_devices[index]->device();
+}
+
+
+//-------------------------------------------------
+//  category_name - get the short name used for
+//  outputs, log lines and Lua
+//-------------------------------------------------
+
+char const *frame_telemetry::category_name(category cat)
+{
+	static char const *const s_names[CATEGORY_COUNT] = { "frame", "emulation", "sound", "audio", "render", "osd", "throttle" };
+	return s_names[cat];
+}
+
+
+//-------------------------------------------------
+//  to_usec - convert a tick count to whole
+//  microseconds, saturating
+//-------------------------------------------------
+
+inline u32 frame_telemetry::to_usec(osd_ticks_t ticks) const noexcept
+{
+	u64 const usec = u64(ticks) * 1'000'000 / u64(m_ticks_per_second);
+	return (usec > ~u32(0)) ? ~u32(0) : u32(usec);
+}
+
+
+//-------------------------------------------------
+//  frame_end - record everything accumulated
+//  during a frame
+//-------------------------------------------------
+
+void frame_telemetry::frame_end(bool skipped)
+{
+	osd_ticks_t const now = osd_ticks();
+	if (m_last_frame)
+		m_histograms[FRAME].record(to_usec(now - m_last_frame));
+	m_last_frame = now;
+	m_frames++;
+	if (skipped)
+		m_skipped++;
+
+	// emulation time comes from the devices themselves
+	osd_ticks_t emulation = 0;
+	for (size_t index = 0; m_devices.size() > index; ++index)
+	{
+		osd_ticks_t const ticks = m_devices[index]->host_ticks();
+		m_devices[index]->reset_host_ticks();
+		m_device_histograms[index].record(to_usec(ticks));
+		m_device_totals[index] += ticks;
+		emulation += ticks;
+	}
+	m_histograms[EMULATION].record(to_usec(emulation));
+
+	// the OSD update includes building render lists
+	osd_ticks_t accum[CATEGORY_COUNT];
+	for (unsigned cat = SOUND; CATEGORY_COUNT > cat; ++cat)
+		accum[cat] = m_accum[cat].exchange(0, std::memory_order_relaxed);
+	accum[OSD] -= (std::min)(accum[OSD], accum[RENDER]);
+	for (unsigned cat = SOUND; CATEGORY_COUNT > cat; ++cat)
+		m_histograms[cat].record(to_usec(accum[cat]));
+
+	// close the window if it's time
+	if (now >= m_next_report)
+	{
+		publish();
+		reset();
+		m_next_report = now + m_interval;
+	}
+}
+
+
+//-------------------------------------------------
+//  report - describe the current window in one
+//  line
+//-------------------------------------------------
+
+std::string frame_telemetry::report() const
+{
+	std::ostringstream str;
+	util::stream_format(str, "%u frames (%u skipped)", m_frames, m_skipped);
+	for (unsigned cat = FRAME; CATEGORY_COUNT > cat; ++cat)
+	{
+		summary const s = stats(category(cat));
+		util::stream_format(str, "; %s %.2f/%.2f/%.2f", category_name(category(cat)), s.p50 * 1e-3, s.p99 * 1e-3, s.max * 1e-3);
+	}
+	for (size_t index = 0; m_devices.size() > index; ++index)
+	{
+		summary const s = device_stats(index);
+		util::stream_format(str, "; %s %.2f/%.2f/%.2f", device(index).tag(), s.p50 * 1e-3, s.p99 * 1e-3, s.max * 1e-3);
+	}
+	str << " ms p50/p99/max";
+	return std::move(str).str();
+}
+
+
+//-------------------------------------------------
+//  reset - start a new window
+//-------------------------------------------------
+
+void frame_telemetry::reset()
+{
+	for (frame_histogram &histogram : m_histograms)
+		histogram.reset();
+	for (size_t index = 0; m_devices.size() > index; ++index)
+	{
+		m_device_histograms[index].reset();
+		m_device_totals[index] = 0;
+	}
+	m_frames = 0;
+	m_skipped = 0;
+}
+
+
+//-------------------------------------------------
+//  publish - send the current window to the
+//  output system and optionally the log
+//-------------------------------------------------
+
+void frame_telemetry::publish()
+{
+	output_manager &output = machine().output();
+	auto const set =
+			[&output] (std::string_view name, summary const &s)
+			{
+				output.set_value(util::string_format("telemetry_%s_p50", name), s.p50);
+				output.set_value(util::string_format("telemetry_%s_p99", name), s.p99);
+				output.set_value(util::string_format("telemetry_%s_max", name), s.max);
+			};
+
+	output.set_value("telemetry_frames", m_frames);
+	output.set_value("telemetry_skipped", m_skipped);
+	for (unsigned cat = FRAME; CATEGORY_COUNT > cat; ++cat)
+		set(category_name(category(cat)), stats(category(cat)));
+	for (size_t index = 0; m_devices.size() > index; ++index)
+	{
+		// device tags become output name friendly: ":maincpu" -> "maincpu", ":sub:cpu" -> "sub_cpu"
+		std::string name(device(index).tag());
+		if (!name.empty() && (name[0] == ':'))
+			name.erase(0, 1);
+		std::replace(name.begin(), name.end(), ':', '_');
+		set(name, device_stats(index));
+	}
+
+	if (m_log)
+		osd_printf_info("Telemetry: %s\n", report());
+}
+
+
+//-------------------------------------------------
+//  summarise - get the interesting numbers from a
+//  histogram
+//-------------------------------------------------
+
+frame_telemetry::summary frame_telemetry::summarise(frame_histogram const &histogram) noexcept
+{
+	return summary{ histogram.count(), histogram.percentile(0.50), histogram.percentile(0.99), histogram.max() };
+}
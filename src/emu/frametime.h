@@ -0,0 +1,144 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+/***************************************************************************
+
+    frametime.h
+
+    Always-on per-frame timing telemetry.
+
+****************************************************************************
+
+    Time spent in each part of a frame is accumulated while the frame
+    runs and recorded into fixed-size histograms when it ends.  Each
+    histogram has four logarithmic buckets per power of two from 1us
+    upwards, so percentiles are accurate to within 25% and recording
+    is a couple of relaxed atomic increments.  Device execution time is
+    measured by the scheduler around each timeslice; when timeslices
+    are very short only one in sixteen is timed and scaled up.
+
+    Every telemetry_interval seconds the p50/p99/max of each category
+    are published as outputs, optionally printed as a log line, and the
+    histograms start over.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_FRAMETIME_H
+#define MAME_EMU_FRAMETIME_H
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> frame_histogram
+
+class frame_histogram
+{
+public:
+	static constexpr unsigned BUCKETS = 124;
+
+	// construction/destruction
+	frame_histogram() noexcept { reset(); }
+
+	// recording
+	void record(u32 usec) noexcept;
+	void reset() noexcept;
+
+	// queries
+	u32 count() const noexcept { return m_count.load(std::memory_order_relaxed); }
+	u32 max() const noexcept { return m_max.load(std::memory_order_relaxed); }
+	u32 percentile(double fraction) const noexcept;
+
+private:
+	static unsigned bucket(u32 usec) noexcept;
+	static u32 bucket_limit(unsigned index) noexcept;
+
+	std::atomic<u32>    m_buckets[BUCKETS];
+	std::atomic<u32>    m_count;
+	std::atomic<u32>    m_max;
+};
+
+
+// ======================> frame_telemetry
+
+class frame_telemetry
+{
+public:
+	// frame time categories
+	enum category : unsigned
+	{
+		FRAME = 0,      // wall time from one frame to the next
+		EMULATION,      // executing devices
+		SOUND,          // sound update, including audio buffer fill
+		AUDIO,          // handing samples to the OSD
+		RENDER,         // building render lists
+		OSD,            // OSD update excluding render list building
+		THROTTLE,       // sleeping or spinning to hold speed
+		CATEGORY_COUNT
+	};
+
+	// summary of one histogram
+	struct summary
+	{
+		u32 count;
+		u32 p50;
+		u32 p99;
+		u32 max;
+	};
+
+	// construction/destruction
+	frame_telemetry(running_machine &machine);
+	~frame_telemetry();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	u32 frames() const { return m_frames; }
+	u32 skipped_frames() const { return m_skipped; }
+	size_t device_count() const { return m_devices.size(); }
+	device_t &device(size_t index) const;
+
+	// accumulate time for the current frame
+	void add(category cat, osd_ticks_t ticks) noexcept { m_accum[cat].fetch_add(ticks, std::memory_order_relaxed); }
+
+	// end a frame; called once per video update
+	void frame_end(bool skipped);
+
+	// queries on the current window
+	summary stats(category cat) const { return summarise(m_histograms[cat]); }
+	summary device_stats(size_t index) const { return summarise(m_device_histograms[index]); }
+	osd_ticks_t device_total(size_t index) const { return m_device_totals[index]; }
+	static char const *category_name(category cat);
+	std::string report() const;
+
+	// start a new window
+	void reset();
+
+private:
+	u32 to_usec(osd_ticks_t ticks) const noexcept;
+	void publish();
+	static summary summarise(frame_histogram const &histogram) noexcept;
+
+	// internal state
+	running_machine &                   m_machine;              // reference to our machine
+	osd_ticks_t const                   m_ticks_per_second;     // cached osd_ticks_per_second()
+	osd_ticks_t const                   m_interval;             // length of a reporting window
+	bool const                          m_log;                  // print a line every window
+	osd_ticks_t                         m_last_frame;           // time the previous frame ended
+	osd_ticks_t                         m_next_report;          // time the current window ends
+	u32                                 m_frames;               // frames in the current window
+	u32                                 m_skipped;              // skipped frames in the current window
+	std::atomic<osd_ticks_t>            m_accum[CATEGORY_COUNT]; // time accumulated in the current frame
+	frame_histogram                     m_histograms[CATEGORY_COUNT];
+	std::vector<device_execute_interface *> m_devices;          // executing devices
+	std::unique_ptr<frame_histogram []> m_device_histograms;    // per-device emulation time
+	std::unique_ptr<osd_ticks_t []>     m_device_totals;        // per-device emulation time in the current window
+};
+
+#endif // MAME_EMU_FRAMETIME_H
@@ -18,10 +18,13 @@
 #include "dirtc.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "frametime.h"
 #include "http.h"
 #include "image.h"
 #include "natkeyboard.h"
 #include "network.h"
+#include "nvramsave.h"
+#include "phasetrace.h"
 #include "render.h"
 #include "romload.h"
 #include "tilemap.h"
@@ -134,12 +137,28 @@ std::string running_machine::describe_context() const
 
 void running_machine::start()
 {
+	g_phase_tracer.machine_started();
+	phase_trace_scope scope("running_machine::start");
+
 	// initialize basic can't-fail systems here
 	m_configuration = std::make_unique<configuration_manager>(*this);
 	m_input = std::make_unique<input_manager>(*this);
 	m_output = std::make_unique<output_manager>(*this);
 	m_render = std::make_unique<render_manager>(*this);
 	m_bookkeeping = std::make_unique<bookkeeping_manager>(*this);
+	m_telemetry = std::make_unique<frame_telemetry>(*this);
+
+	// start recording timeline events if requested
+	if (*options().trace_events())
+	{
+		if (!osd_trace_enabled())
+		{
+			osd_trace_set_thread_name("emulation");
+			osd_trace_enable(true);
+		}
+		if (!osd_trace_enabled())
+			osd_printf_warning("Event tracing is not available in this build; ignoring -%s\n", OPTION_TRACE_EVENTS);
+	}
 
 	// allocate a soft_reset timer
 	m_soft_reset_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::soft_reset), this));
@@ -148,7 +167,10 @@ void running_machine::start()
 	m_ui_input = std::make_unique<ui_input_manager>(*this);
 
 	// init the osd layer
-	m_manager.osd().init(*this);
+	{
+		phase_trace_scope osdscope("OSD init");
+		m_manager.osd().init(*this);
+	}
 
 	// create the video manager
 	m_video = std::make_unique<video_manager>(*this);
@@ -179,14 +201,20 @@ void running_machine::start()
 	// needs rom bases), and finally initialize CPUs (which needs
 	// complete address spaces).  These operations must proceed in this
 	// order
-	m_rom_load = std::make_unique<rom_load_manager>(*this);
+	{
+		phase_trace_scope romscope("ROM load");
+		m_rom_load = std::make_unique<rom_load_manager>(*this);
+	}
 	m_memory.initialize();
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
 
 	// initialize image devices
-	m_image = std::make_unique<image_manager>(*this);
+	{
+		phase_trace_scope imagescope("image init");
+		m_image = std::make_unique<image_manager>(*this);
+	}
 	m_tilemap = std::make_unique<tilemap_manager>(*this);
 	m_crosshair = std::make_unique<crosshair_manager>(*this);
 	m_network = std::make_unique<network_manager>(*this);
@@ -292,6 +320,10 @@ int running_machine::run(bool quiet)
 		// load the NVRAM
 		nvram_load();
 
+		// start periodic NVRAM saving if requested
+		if (options().nvram_save() && (options().nvram_autosave() > 0))
+			m_nvram_autosave = std::make_unique<nvram_autosave_manager>(*this, options().nvram_autosave());
+
 		// set the time on RTCs (this may overwrite parts of NVRAM)
 		set_rtc_datetime(system_time(m_base_time));
 
@@ -344,6 +376,8 @@ int running_machine::run(bool quiet)
 
 		// save the NVRAM and configuration
 		sound().ui_mute(true);
+		if (m_nvram_autosave)
+			m_nvram_autosave->stop();
 		if (options().nvram_save())
 			nvram_save();
 		m_configuration->save_settings();
@@ -385,6 +419,14 @@ int running_machine::run(bool quiet)
 	// in case we got here via exception
 	m_current_phase = machine_phase::EXIT;
 
+	// write timeline events while the names they point to are still valid
+	if (*options().trace_events() && osd_trace_enabled())
+	{
+		osd_trace_enable(false);
+		if (!osd_trace_write(options().trace_events(), options().trace_window()))
+			osd_printf_error("Unable to write event trace to %s\n", options().trace_events());
+	}
+
 	// call all exit callbacks registered
 	call_notifiers(MACHINE_NOTIFY_EXIT);
 	util::archive_file::cache_clear();
@@ -992,6 +1034,8 @@ std::unique_ptr<emu_file> running_machine::steal_debuglogfile()
 
 void running_machine::start_all_devices()
 {
+	phase_trace_scope scope("start_all_devices");
+
 	// iterate through the devices
 	int last_failed_starts = -1;
 	do
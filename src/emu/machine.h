@@ -100,6 +100,8 @@ class running_machine
 {
 	DISABLE_COPYING(running_machine);
 
+	friend class nvram_autosave_manager;
+
 	class side_effects_disabler;
 
 	friend class sound_manager;
@@ -140,6 +142,7 @@ public:
 	debug_view_manager &debug_view() const { assert(m_debug_view != nullptr); return *m_debug_view; }
 	debugger_manager &debugger() const { assert(m_debugger != nullptr); return *m_debugger; }
 	natural_keyboard &natkeyboard() noexcept { assert(m_natkeyboard != nullptr); return *m_natkeyboard; }
+	frame_telemetry &telemetry() const { assert(m_telemetry != nullptr); return *m_telemetry; }
 	template <class DriverClass> DriverClass *driver_data() const { return &downcast<DriverClass &>(root_device()); }
 	machine_phase phase() const { return m_current_phase; }
 	bool paused() const { return m_paused || (m_current_phase != machine_phase::RUNNING); }
@@ -270,6 +273,7 @@ private:
 	const game_driver &     m_system;               // reference to the definition of the game machine
 	machine_manager &       m_manager;              // reference to machine manager system
 	// managers
+	std::unique_ptr<frame_telemetry> m_telemetry;      // internal data from frametime.cpp
 	std::unique_ptr<render_manager> m_render;          // internal data from render.cpp
 	std::unique_ptr<input_manager> m_input;            // internal data from input.cpp
 	std::unique_ptr<sound_manager> m_sound;            // internal data from sound.cpp
@@ -287,6 +291,7 @@ private:
 	std::unique_ptr<rom_load_manager> m_rom_load;      // internal data from romload.cpp
 	std::unique_ptr<debugger_manager> m_debugger;      // internal data from debugger.cpp
 	std::unique_ptr<natural_keyboard> m_natkeyboard;   // internal data from natkeyboard.cpp
+	std::unique_ptr<nvram_autosave_manager> m_nvram_autosave; // internal data from nvramsave.cpp
 
 	// system state
 	machine_phase           m_current_phase;        // current execution phase
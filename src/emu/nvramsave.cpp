@@ -0,0 +1,288 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+/*********************************************************************
+
+    nvramsave.cpp
+
+    Periodic background saving of device NVRAM.
+
+    Every interval the manager serialises each saveable NVRAM device
+    and the battery-backed RAM of each mounted image into memory on the
+    emulation thread and compares the result with the last snapshot it
+    queued.  Only devices whose contents changed
+    are handed to a writer thread, which writes to a temporary file,
+    syncs it to disk and renames it over the real one so a power cut
+    never leaves a truncated NVRAM file behind.  A device that keeps changing is
+    written at most once per interval.
+
+*********************************************************************/
+
+#include "emu.h"
+#include "nvramsave.h"
+
+#include "emuopts.h"
+#include "fileio.h"
+
+#include "ioprocsvec.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+
+//**************************************************************************
+//  NVRAM AUTOSAVE MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  nvram_autosave_manager - constructor
+//-------------------------------------------------
+
+nvram_autosave_manager::nvram_autosave_manager(running_machine &machine, int interval)
+	: m_machine(machine)
+	, m_directory(machine.options().nvram_directory())
+	, m_interval(osd_ticks_per_second() * interval)
+	, m_next_check(osd_ticks() + m_interval)
+	, m_stopped(false)
+	, m_exiting(false)
+	, m_written(0)
+	, m_failed(0)
+{
+	// take initial snapshots so freshly loaded NVRAM isn't rewritten
+	for (device_nvram_interface &nvram : nvram_interface_enumerator(machine.root_device()))
+	{
+		if (nvram.nvram_backup_enabled())
+			m_devices.emplace_back(device_state{ &nvram, nullptr, std::vector<u8>(), false });
+	}
+	for (device_image_interface &image : image_interface_enumerator(machine.root_device()))
+		m_devices.emplace_back(device_state{ nullptr, &image, std::vector<u8>(), false });
+	for (device_state &state : m_devices)
+		state.valid = snapshot(state, state.data);
+
+	machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&nvram_autosave_manager::frame_update, this));
+	m_thread = std::thread([this] () { worker(); });
+}
+
+
+//-------------------------------------------------
+//  ~nvram_autosave_manager - destructor
+//-------------------------------------------------
+
+nvram_autosave_manager::~nvram_autosave_manager()
+{
+	stop();
+}
+
+
+//-------------------------------------------------
+//  stop - stop taking snapshots, discard queued
+//  writes and wait for one in progress
+//-------------------------------------------------
+
+void nvram_autosave_manager::stop()
+{
+	m_stopped = true;
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		m_pending.clear();
+		m_exiting = true;
+	}
+	m_cv.notify_all();
+	if (m_thread.joinable())
+	{
+		m_thread.join();
+		osd_printf_verbose("NVRAM autosave: %u files written, %u failures\n", m_written, m_failed);
+	}
+}
+
+
+//-------------------------------------------------
+//  frame_update - check for changed NVRAM once
+//  the interval has elapsed
+//-------------------------------------------------
+
+void nvram_autosave_manager::frame_update()
+{
+	if (m_stopped)
+		return;
+
+	osd_ticks_t const now = osd_ticks();
+	if (now < m_next_check)
+		return;
+	m_next_check = now + m_interval;
+
+	for (device_state &state : m_devices)
+	{
+		// some devices can only be saved in certain states, and images come and go
+		if (!snapshot(state, m_scratch))
+		{
+			state.valid = false;
+			continue;
+		}
+
+		if (!state.valid || (state.data.size() != m_scratch.size()) || std::memcmp(state.data.data(), m_scratch.data(), m_scratch.size()))
+		{
+			bool const first = !state.valid;
+			state.data.swap(m_scratch);
+			state.valid = true;
+
+			// a newly mounted image has just loaded its battery file
+			if (!first || !state.image)
+				queue_write(filename(state), state.data);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  snapshot - serialise a device's NVRAM into
+//  memory
+//-------------------------------------------------
+
+bool nvram_autosave_manager::snapshot(device_state const &state, std::vector<u8> &data)
+{
+	data.clear();
+	if (state.nvram)
+	{
+		if (!state.nvram->nvram_can_save())
+			return false;
+		util::vector_read_write_adapter<u8> adapter(data);
+		return state.nvram->nvram_save(adapter);
+	}
+	else
+	{
+		return state.image->exists() && state.image->battery_snapshot(data) && !data.empty();
+	}
+}
+
+
+//-------------------------------------------------
+//  filename - get the file name for a device
+//  relative to the NVRAM directory
+//-------------------------------------------------
+
+std::string nvram_autosave_manager::filename(device_state const &state) const
+{
+	return state.nvram ? machine().nvram_filename(state.nvram->device()) : state.image->battery_filename();
+}
+
+
+//-------------------------------------------------
+//  queue_write - hand data to the writer,
+//  replacing any older write of the same file
+//-------------------------------------------------
+
+void nvram_autosave_manager::queue_write(std::string &&filename, std::vector<u8> const &data)
+{
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto const existing = std::find_if(
+				m_pending.begin(),
+				m_pending.end(),
+				[&filename] (pending_write const &item) { return item.filename == filename; });
+		if (m_pending.end() != existing)
+			existing->data = data;
+		else
+			m_pending.emplace_back(pending_write{ std::move(filename), data });
+	}
+	m_cv.notify_one();
+}
+
+
+//-------------------------------------------------
+//  worker - writer thread main loop
+//-------------------------------------------------
+
+void nvram_autosave_manager::worker()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_cv.wait(lock, [this] () { return m_exiting || !m_pending.empty(); });
+		if (m_exiting)
+			return;
+
+		pending_write item(std::move(m_pending.front()));
+		m_pending.erase(m_pending.begin());
+
+		// do the slow part without holding the lock
+		lock.unlock();
+		bool const success = write_file(item);
+		lock.lock();
+
+		if (success)
+			m_written++;
+		else
+			m_failed++;
+	}
+}
+
+
+//-------------------------------------------------
+//  write_file - write to a temporary file and
+//  rename it into place
+//-------------------------------------------------
+
+bool nvram_autosave_manager::write_file(pending_write const &item)
+{
+	std::string finalpath;
+	{
+		emu_file file(m_directory, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (file.open(item.filename + ".tmp"))
+		{
+			osd_printf_error("NVRAM autosave: error creating temporary file for %s\n", item.filename);
+			return false;
+		}
+		if (file.write(item.data.data(), item.data.size()) != item.data.size())
+		{
+			osd_printf_error("NVRAM autosave: error writing %s\n", file.fullpath());
+			file.remove_on_close();
+			return false;
+		}
+		file.flush();
+		finalpath = file.fullpath();
+	}
+
+	// closing only empties user-space buffers; the data has to be on disk before
+	// the rename, or a power cut can leave the real file empty or torn
+	std::string const temppath(finalpath);
+	{
+		osd_file::ptr file;
+		std::uint64_t length;
+		std::error_condition filerr(osd_file::open(temppath, OPEN_FLAG_READ | OPEN_FLAG_WRITE, file, length));
+		if (!filerr)
+			filerr = file->sync();
+		if (filerr && (filerr != std::errc::not_supported))
+		{
+			osd_printf_error("NVRAM autosave: error syncing %s (%s)\n", temppath, filerr.message());
+			file.reset();
+			osd_file::remove(temppath);
+			return false;
+		}
+	}
+
+	// replace the real file
+	finalpath.resize(finalpath.length() - 4);
+#if defined(_WIN32)
+	osd_file::remove(finalpath);
+#endif
+	if (std::rename(temppath.c_str(), finalpath.c_str()))
+	{
+		osd_printf_error("NVRAM autosave: error renaming %s\n", temppath);
+		osd_file::remove(temppath);
+		return false;
+	}
+
+#if !defined(_WIN32)
+	// the rename itself only survives a power cut once the directory is synced
+	std::string::size_type const separator(finalpath.rfind(PATH_SEPARATOR[0]));
+	if (separator != std::string::npos)
+	{
+		osd_file::ptr directory;
+		std::uint64_t length;
+		if (!osd_file::open(finalpath.substr(0, separator ? separator : 1), OPEN_FLAG_READ, directory, length))
+			directory->sync();
+	}
+#endif
+	return true;
+}
@@ -0,0 +1,89 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+/*********************************************************************
+
+    nvramsave.h
+
+    Periodic background saving of device NVRAM.
+
+*********************************************************************/
+
+#ifndef MAME_EMU_NVRAMSAVE_H
+#define MAME_EMU_NVRAMSAVE_H
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> nvram_autosave_manager
+
+// snapshots NVRAM and cartridge battery RAM at a fixed interval while
+// the machine runs and writes anything that changed from a worker
+// thread, so saves survive an unclean shutdown without stalling
+// emulation
+class nvram_autosave_manager
+{
+public:
+	// construction/destruction
+	nvram_autosave_manager(running_machine &machine, int interval);
+	~nvram_autosave_manager();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+	// stop taking snapshots and wait for any write in progress
+	void stop();
+
+private:
+	// per-device snapshot of the last contents handed to the writer
+	struct device_state
+	{
+		device_nvram_interface *    nvram;                  // NVRAM device, or
+		device_image_interface *    image;                  // image with battery-backed RAM
+		std::vector<u8>             data;
+		bool                        valid;
+	};
+
+	// a queued file write
+	struct pending_write
+	{
+		std::string                 filename;
+		std::vector<u8>             data;
+	};
+
+	// internal helpers
+	void frame_update();
+	bool snapshot(device_state const &state, std::vector<u8> &data);
+	std::string filename(device_state const &state) const;
+	void queue_write(std::string &&filename, std::vector<u8> const &data);
+	void worker();
+	bool write_file(pending_write const &item);
+
+	// internal state
+	running_machine &           m_machine;              // reference to our machine
+	std::string const           m_directory;            // NVRAM directory (copied for the worker)
+	osd_ticks_t const           m_interval;             // minimum time between snapshots
+	osd_ticks_t                 m_next_check;           // time of next snapshot
+	std::vector<device_state>   m_devices;              // devices with NVRAM worth saving
+	std::vector<u8>             m_scratch;              // reusable serialisation buffer
+	bool                        m_stopped;              // true once stop() has been called
+
+	std::thread                 m_thread;               // writer thread
+	std::mutex                  m_mutex;                // protects members below
+	std::condition_variable     m_cv;                   // wakes the writer
+	std::vector<pending_write>  m_pending;              // writes not yet started
+	bool                        m_exiting;              // tells the writer to exit
+	u32                         m_written;              // count of files written
+	u32                         m_failed;               // count of failed writes
+};
+
+#endif // MAME_EMU_NVRAMSAVE_H
@@ -0,0 +1,227 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+/***************************************************************************
+
+    phasetrace.cpp
+
+    Records named, nested phases of emulator startup.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "phasetrace.h"
+
+#include "path.h"
+
+#include <fstream>
+#include <sstream>
+
+
+
+//**************************************************************************
+//  GLOBAL VARIABLES
+//**************************************************************************
+
+phase_tracer g_phase_tracer;
+
+
+
+//**************************************************************************
+//  PHASE TRACER
+//**************************************************************************
+
+//-------------------------------------------------
+//  phase_tracer - constructor
+//-------------------------------------------------
+
+phase_tracer::phase_tracer()
+	: m_recording(true)
+	, m_origin(osd_ticks())
+	, m_machine_start(0)
+	, m_first_frame(0)
+{
+}
+
+
+//-------------------------------------------------
+//  machine_started - re-arm recording for a new
+//  machine
+//-------------------------------------------------
+
+void phase_tracer::machine_started()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_recording.store(true, std::memory_order_relaxed);
+	m_machine_start = osd_ticks();
+	m_first_frame = 0;
+}
+
+
+//-------------------------------------------------
+//  frame_presented - note the first frame and
+//  stop recording
+//-------------------------------------------------
+
+void phase_tracer::frame_presented()
+{
+	if (!recording())
+		return;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_first_frame = osd_ticks();
+	m_recording.store(false, std::memory_order_relaxed);
+}
+
+
+//-------------------------------------------------
+//  real_begin - open a phase
+//-------------------------------------------------
+
+void phase_tracer::real_begin(std::string_view name, std::string_view detail)
+{
+	std::string fullname;
+	fullname.reserve(name.length() + detail.length());
+	fullname.append(name).append(detail);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_open.push_back(m_phases.size());
+	m_phases.emplace_back(phase{ std::move(fullname), osd_ticks(), 0, unsigned(m_open.size() - 1) });
+}
+
+
+//-------------------------------------------------
+//  real_end - close the innermost open phase
+//-------------------------------------------------
+
+void phase_tracer::real_end()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_open.empty())
+		return;
+	m_phases[m_open.back()].end = osd_ticks();
+	m_open.pop_back();
+}
+
+
+//-------------------------------------------------
+//  to_usec - convert ticks since the origin to
+//  microseconds
+//-------------------------------------------------
+
+double phase_tracer::to_usec(osd_ticks_t ticks) const
+{
+	return double(ticks - m_origin) * 1.0e6 / double(osd_ticks_per_second());
+}
+
+
+//-------------------------------------------------
+//  write - write the trace to a file; Chrome
+//  trace JSON for .json files, text otherwise
+//-------------------------------------------------
+
+bool phase_tracer::write(std::string_view filename) const
+{
+	std::ofstream file(std::string(filename), std::ios::out | std::ios::trunc);
+	if (!file)
+		return false;
+
+	if (core_filename_ends_with(filename, ".json"))
+		write_json(file);
+	else
+		write_text(file);
+	return bool(file);
+}
+
+
+//-------------------------------------------------
+//  write_text - write an indented, human-readable
+//  summary of the trace
+//-------------------------------------------------
+
+void phase_tracer::write_text(std::ostream &str) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (phase const &p : m_phases)
+	{
+		osd_ticks_t const end = p.end ? p.end : m_first_frame;
+		util::stream_format(str, "%10.3f ms %*s%s", to_usec(p.start) / 1000.0, p.depth * 2, "", p.name);
+		if (end)
+			util::stream_format(str, " (%.3f ms)", (to_usec(end) - to_usec(p.start)) / 1000.0);
+		str << '\n';
+	}
+	if (m_first_frame)
+	{
+		util::stream_format(str, "%10.3f ms first frame presented", to_usec(m_first_frame) / 1000.0);
+		if (m_machine_start)
+			util::stream_format(str, " (%.3f ms after machine start)", (to_usec(m_first_frame) - to_usec(m_machine_start)) / 1000.0);
+		str << '\n';
+	}
+}
+
+
+//-------------------------------------------------
+//  write_json - write the trace in Chrome
+//  trace event format
+//-------------------------------------------------
+
+void phase_tracer::write_json(std::ostream &str) const
+{
+	auto const escape =
+			[] (std::string_view s)
+			{
+				std::string result;
+				for (char c : s)
+				{
+					if (('"' == c) || ('\\' == c))
+						result.push_back('\\');
+					if (u8(c) >= 0x20)
+						result.push_back(c);
+				}
+				return result;
+			};
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	str << "{\"traceEvents\":[\n";
+	bool first = true;
+	for (phase const &p : m_phases)
+	{
+		osd_ticks_t const end = p.end ? p.end : (m_first_frame ? m_first_frame : p.start);
+		util::stream_format(
+				str,
+				"%s{\"name\":\"%s\",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+				first ? "" : ",\n",
+				escape(p.name),
+				to_usec(p.start),
+				to_usec(end) - to_usec(p.start));
+		first = false;
+	}
+	if (m_first_frame)
+	{
+		util::stream_format(
+				str,
+				"%s{\"name\":\"first frame\",\"cat\":\"startup\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":1,\"ts\":%.3f}",
+				first ? "" : ",\n",
+				to_usec(m_first_frame));
+	}
+	str << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+
+
+//**************************************************************************
+//  PHASE TRACE SCOPE
+//**************************************************************************
+
+phase_trace_scope::phase_trace_scope(std::string_view name, std::string_view detail)
+	: m_active(g_phase_tracer.recording())
+{
+	if (m_active)
+		g_phase_tracer.begin(name, detail);
+}
+
+phase_trace_scope::~phase_trace_scope()
+{
+	// close even if recording stopped inside the scope so nesting stays balanced
+	if (m_active)
+		g_phase_tracer.end();
+}
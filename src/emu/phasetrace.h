@@ -0,0 +1,120 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+/***************************************************************************
+
+    phasetrace.h
+
+    Records named, nested phases of emulator startup.
+
+****************************************************************************
+
+    Tracing is scope-based.  Put a phase_trace_scope on the stack to
+    record a phase; phases may be nested:
+
+    {
+        phase_trace_scope scope("load ROMs");
+
+        your_work_here();
+    }
+
+    Recording starts when the process starts and is re-armed each time
+    a machine starts.  It stops by itself once the first frame has been
+    presented, so the cost during emulation is a single test per scope.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_PHASETRACE_H
+#define MAME_EMU_PHASETRACE_H
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> phase_tracer
+
+class phase_tracer
+{
+public:
+	// a completed or open phase
+	struct phase
+	{
+		std::string     name;                       // phase name
+		osd_ticks_t     start;                      // start time
+		osd_ticks_t     end;                        // end time, or zero if still open
+		unsigned        depth;                      // nesting depth
+	};
+
+	// construction/destruction
+	phase_tracer();
+
+	// getters
+	bool recording() const { return m_recording.load(std::memory_order_relaxed); }
+	std::vector<phase> const &phases() const { return m_phases; }
+	osd_ticks_t origin() const { return m_origin; }
+	osd_ticks_t first_frame() const { return m_first_frame; }
+	osd_ticks_t machine_start() const { return m_machine_start; }
+
+	// start a new machine; keeps earlier phases but records again
+	void machine_started();
+
+	// record the first presented frame and stop recording
+	void frame_presented();
+
+	// begin/end a phase
+	void begin(std::string_view name, std::string_view detail = std::string_view()) { if (recording()) real_begin(name, detail); }
+	void end() { real_end(); }
+
+	// output
+	bool write(std::string_view filename) const;
+	void write_text(std::ostream &str) const;
+	void write_json(std::ostream &str) const;
+
+private:
+	void real_begin(std::string_view name, std::string_view detail);
+	void real_end();
+
+	double to_usec(osd_ticks_t ticks) const;
+
+	// internal state
+	std::atomic<bool>       m_recording;        // whether phases are being recorded; read without the lock
+	osd_ticks_t             m_origin;           // time the tracer was constructed
+	osd_ticks_t             m_machine_start;    // time the latest machine started
+	osd_ticks_t             m_first_frame;      // time the latest machine presented its first frame
+	std::vector<phase>      m_phases;           // recorded phases
+	std::vector<size_t>     m_open;             // indices of phases that are still open
+	mutable std::mutex      m_mutex;            // protects the above when enabled
+};
+
+
+// ======================> phase_trace_scope
+
+class phase_trace_scope
+{
+public:
+	// the name is the two parts joined, built only while recording
+	phase_trace_scope(std::string_view name, std::string_view detail = std::string_view());
+	~phase_trace_scope();
+
+private:
+	bool m_active;
+};
+
+
+
+//**************************************************************************
+//  GLOBAL VARIABLES
+//**************************************************************************
+
+extern phase_tracer g_phase_tracer;
+
+
+#endif  /* MAME_EMU_PHASETRACE_H */
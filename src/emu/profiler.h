@@ -73,6 +73,14 @@ DECLARE_ENUM_INCDEC_OPERATORS(profile_type)
 
 
 
+//**************************************************************************
+//  FUNCTION PROTOTYPES
+//**************************************************************************
+
+const char *profile_type_name(profile_type type);
+
+
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -103,8 +111,8 @@ public:
 	}
 
 	// start/stop
-	void start(profile_type type) { if (enabled()) real_start(type); }
-	void stop() { if (enabled()) real_stop(); }
+	void start(profile_type type) { if (osd_trace_enabled()) osd_trace_begin(profile_type_name(type)); if (enabled()) real_start(type); }
+	void stop() { if (osd_trace_enabled()) osd_trace_end(); if (enabled()) real_stop(); }
 
 private:
 	void reset(bool enabled);
@@ -187,9 +195,9 @@ public:
 	// enable/disable
 	void enable(bool state = true) { }
 
-	// start/stop
-	void start(profile_type type) { }
-	void stop() { }
+	// start/stop; only feeds the event trace
+	void start(profile_type type) { if (osd_trace_enabled()) osd_trace_begin(profile_type_name(type)); }
+	void stop() { if (osd_trace_enabled()) osd_trace_end(); }
 };
 
 
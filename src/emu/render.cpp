@@ -42,6 +42,8 @@
 #include "corestr.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "frametime.h"
+#include "phasetrace.h"
 #include "rendfont.h"
 #include "rendlay.h"
 #include "rendutil.h"
@@ -193,6 +195,7 @@ void render_primitive::reset()
 //-------------------------------------------------
 
 render_primitive_list::render_primitive_list()
+	: m_generation(0)
 {
 }
 
@@ -296,11 +299,19 @@ render_texture::render_texture()
 		m_format(TEXFORMAT_ARGB32),
 		m_id(~0ULL),
 		m_old_id(~0ULL),
+		m_generation(0),
+		m_tracked(false),
+		m_changed(true),
+		m_dirty_top(0),
+		m_dirty_bottom(0),
+		m_lookup_serial(0),
+		m_lookup_changed(false),
 		m_scaler(nullptr),
 		m_param(nullptr),
 		m_curseq(0)
 {
 	m_sbounds.set(0, -1, 0, -1);
+	m_dirty.set(0, -1, 0, -1);
 	memset(m_scaled, 0, sizeof(m_scaled));
 }
 
@@ -353,7 +364,11 @@ void render_texture::release()
 	m_bitmap = nullptr;
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
+	m_tracked = false;
+	m_changed = true;
+	m_dirty.set(0, -1, 0, -1);
 	m_curseq = 0;
+	++m_generation;
 }
 
 
@@ -378,6 +393,12 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_sbounds = sbounds;
 	m_format = format;
 
+	// assume the whole thing changed, at any time
+	m_tracked = false;
+	m_changed = true;
+	m_dirty = sbounds;
+	++m_generation;
+
 	// invalidate all scaled versions
 	for (auto & elem : m_scaled)
 	{
@@ -389,6 +410,45 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 }
 
 
+//-------------------------------------------------
+//  set_bitmap - set a source bitmap whose
+//  contents only change between calls, along
+//  with the area changed since the last call
+//-------------------------------------------------
+
+void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format, const rectangle &dirty)
+{
+	// anything other than new contents means starting over
+	bool const same = m_tracked && (&bitmap == m_bitmap) && (sbounds == m_sbounds) && (format == m_format);
+	bool const changed = m_changed;
+	rectangle const pending = m_dirty;
+	u32 const generation = m_generation;
+
+	set_bitmap(bitmap, sbounds, format);
+	m_tracked = true;
+
+	// accumulate with whatever hasn't been handed out yet
+	if (same)
+	{
+		m_changed = changed;
+		m_dirty = pending;
+		m_generation = generation;
+
+		rectangle area(dirty);
+		area &= sbounds;
+		if (!area.empty())
+		{
+			if (m_changed)
+				m_dirty |= area;
+			else
+				m_dirty = area;
+			m_changed = true;
+			++m_generation;
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  hq_scale - generic high quality resampling
 //  scaler
@@ -432,8 +492,30 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.rowpixels = m_bitmap->rowpixels();
 		texinfo.width = swidth;
 		texinfo.height = sheight;
-		// palette will be set later
-		texinfo.seqid = ++m_curseq;
+
+		// untracked bitmaps may have been drawn into at any time, so those always
+		// get a new sequence number; tracked ones only when set_bitmap reported a
+		// change, or when a palette change altered every row
+		if (!m_tracked || m_changed || m_lookup_changed)
+		{
+			if (m_tracked && !m_lookup_changed)
+			{
+				m_dirty_top = m_dirty.top() - m_sbounds.top();
+				m_dirty_bottom = m_dirty.bottom() - m_sbounds.top();
+			}
+			else
+			{
+				m_dirty_top = 0;
+				m_dirty_bottom = sheight - 1;
+			}
+			m_changed = false;
+			m_lookup_changed = false;
+			m_dirty.set(0, -1, 0, -1);
+			++m_curseq;
+		}
+		texinfo.seqid = m_curseq;
+		texinfo.dirty_top = m_dirty_top;
+		texinfo.dirty_bottom = m_dirty_bottom;
 	}
 	else
 	{
@@ -489,6 +571,8 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.height = dheight;
 		// palette will be set later
 		texinfo.seqid = scaled->seqid;
+		texinfo.dirty_top = 0;
+		texinfo.dirty_bottom = dheight - 1;
 	}
 }
 
@@ -500,6 +584,13 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 
 const rgb_t *render_texture::get_adjusted_palette(render_container &container, u32 &out_length)
 {
+	// note palette and brightness/contrast/gamma changes for get_scaled
+	if (container.lookup_serial() != m_lookup_serial)
+	{
+		m_lookup_serial = container.lookup_serial();
+		m_lookup_changed = true;
+	}
+
 	// override the palette with our adjusted palette
 	switch (m_format)
 	{
@@ -538,9 +629,13 @@ const rgb_t *render_texture::get_adjusted_palette(render_container &container, u
 
 render_container::render_container(render_manager &manager, screen_device *screen)
 	: m_manager(manager)
+	, m_compare(nullptr)
+	, m_matching(false)
+	, m_generation(0)
 	, m_screen(screen)
 	, m_overlaybitmap(nullptr)
 	, m_overlaytexture(nullptr)
+	, m_lookup_serial(0)
 {
 	// make sure it is empty
 	empty();
@@ -568,6 +663,7 @@ render_container::~render_container()
 {
 	// free all the container items
 	empty();
+	m_item_allocator.reclaim_all(m_previtems);
 
 	// free the overlay texture
 	m_manager.texture_free(m_overlaytexture);
@@ -591,6 +687,7 @@ void render_container::set_overlay(bitmap_argb32 *bitmap)
 		m_overlaytexture = m_manager.texture_alloc(render_container::overlay_scale);
 		m_overlaytexture->set_bitmap(*bitmap, bitmap->cliprect(), TEXFORMAT_ARGB32);
 	}
+	++m_generation;
 }
 
 
@@ -603,6 +700,26 @@ void render_container::set_user_settings(const user_settings &settings)
 {
 	m_user = settings;
 	recompute_lookups();
+	++m_generation;
+}
+
+
+//-------------------------------------------------
+//  empty - empty the item list, keeping the old
+//  items so that an identical refill doesn't
+//  count as a change
+//-------------------------------------------------
+
+void render_container::empty()
+{
+	// stopping short of the previous contents is a change
+	if (m_matching && m_compare)
+		++m_generation;
+
+	m_item_allocator.reclaim_all(m_previtems);
+	m_previtems.prepend_list(m_itemlist);
+	m_compare = m_previtems.first();
+	m_matching = true;
 }
 
 
@@ -615,6 +732,7 @@ void render_container::add_line(float x0, float y0, float x1, float y1, float wi
 	item &newitem = add_generic(CONTAINER_ITEM_LINE, x0, y0, x1, y1, argb);
 	newitem.m_width = width;
 	newitem.m_flags = flags;
+	item_added(newitem);
 }
 
 
@@ -627,6 +745,7 @@ void render_container::add_quad(float x0, float y0, float x1, float y1, rgb_t ar
 	item &newitem = add_generic(CONTAINER_ITEM_QUAD, x0, y0, x1, y1, argb);
 	newitem.m_texture = texture;
 	newitem.m_flags = flags;
+	item_added(newitem);
 }
 
 
@@ -647,6 +766,7 @@ void render_container::add_char(float x0, float y0, float height, float aspect,
 	newitem.m_texture = texture;
 	newitem.m_flags = PRIMFLAG_TEXORIENT(ROT0) | PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_PACKABLE;
 	newitem.m_internal = INTERNAL_FLAG_CHAR;
+	item_added(newitem);
 }
 
 
@@ -766,6 +886,59 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 }
 
 
+//-------------------------------------------------
+//  item_added - compare a newly added item with
+//  the one it replaces
+//-------------------------------------------------
+
+void render_container::item_added(const item &newitem)
+{
+	if (m_matching)
+	{
+		item const *const previtem = m_compare;
+		if (previtem &&
+				(previtem->m_type == newitem.m_type) &&
+				(previtem->m_bounds.x0 == newitem.m_bounds.x0) &&
+				(previtem->m_bounds.y0 == newitem.m_bounds.y0) &&
+				(previtem->m_bounds.x1 == newitem.m_bounds.x1) &&
+				(previtem->m_bounds.y1 == newitem.m_bounds.y1) &&
+				(previtem->m_color.a == newitem.m_color.a) &&
+				(previtem->m_color.r == newitem.m_color.r) &&
+				(previtem->m_color.g == newitem.m_color.g) &&
+				(previtem->m_color.b == newitem.m_color.b) &&
+				(previtem->m_flags == newitem.m_flags) &&
+				(previtem->m_internal == newitem.m_internal) &&
+				(previtem->m_width == newitem.m_width) &&
+				(previtem->m_texture == newitem.m_texture))
+		{
+			m_compare = previtem->next();
+			return;
+		}
+		m_matching = false;
+		m_compare = nullptr;
+	}
+	++m_generation;
+}
+
+
+//-------------------------------------------------
+//  generation - return a value that changes
+//  whenever the contents of the container do
+//-------------------------------------------------
+
+u32 render_container::generation()
+{
+	// a partial refill differs from what was there before
+	if (m_matching && m_compare)
+	{
+		m_matching = false;
+		m_compare = nullptr;
+		++m_generation;
+	}
+	return m_generation;
+}
+
+
 //-------------------------------------------------
 //  recompute_lookups - recompute the lookup table
 //  for the render container
@@ -773,6 +946,8 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 
 void render_container::recompute_lookups()
 {
+	++m_lookup_serial;
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -825,6 +1000,8 @@ void render_container::update_palette()
 	// iterate over dirty items and update them
 	if (dirty != nullptr)
 	{
+		++m_generation;
+		++m_lookup_serial;
 		palette_t &palette = m_palclient->palette();
 		const rgb_t *adjusted_palette = palette.entry_list_adjusted();
 
@@ -897,6 +1074,8 @@ template <typename T> render_target::render_target(render_manager &manager, T &&
 	, m_curview(0U)
 	, m_flags(flags)
 	, m_listindex(0)
+	, m_cachedlist(nullptr)
+	, m_generation(0)
 	, m_width(640)
 	, m_height(480)
 	, m_keepaspect(false)
@@ -1379,6 +1558,23 @@ void render_target::compute_minimum_size(s32 &minwidth, s32 &minheight)
 
 render_primitive_list &render_target::get_primitives()
 {
+	osd_ticks_t const start_ticks = osd_ticks();
+
+	// compute the visible width/height
+	s32 viswidth, visheight;
+	compute_visible_area(m_width, m_height, m_pixel_aspect, m_orientation, viswidth, visheight);
+
+	// if nothing the list is built from has changed, hand back the last one
+	bool const running = m_manager.machine().phase() >= machine_phase::RESET;
+	if (running)
+		current_view().prepare_items();
+	bool const cacheable = compute_primitive_key(m_nextkey, viswidth, visheight, running);
+	if (cacheable && m_cachedlist && (m_nextkey == m_cachekey))
+	{
+		m_manager.machine().telemetry().add(frame_telemetry::RENDER, osd_ticks() - start_ticks);
+		return *m_cachedlist;
+	}
+
 	// switch to the next primitive list
 	render_primitive_list &list = m_primlist[m_listindex];
 	m_listindex = (m_listindex + 1) % std::size(m_primlist);
@@ -1387,10 +1583,6 @@ render_primitive_list &render_target::get_primitives()
 	// free any previous primitives
 	list.release_all();
 
-	// compute the visible width/height
-	s32 viswidth, visheight;
-	compute_visible_area(m_width, m_height, m_pixel_aspect, m_orientation, viswidth, visheight);
-
 	// create a root transform for the target
 	object_transform root_xform;
 	root_xform.xoffs = (float)(m_width - viswidth) / 2;
@@ -1401,10 +1593,9 @@ render_primitive_list &render_target::get_primitives()
 	root_xform.orientation = m_orientation;
 	root_xform.no_center = false;
 
-	if (m_manager.machine().phase() >= machine_phase::RESET)
+	if (running)
 	{
 		// we're running - iterate over items in the view
-		current_view().prepare_items();
 		for (layout_view_item &curitem : current_view().visible_items())
 		{
 			// first apply orientation to the bounds
@@ -1471,11 +1662,106 @@ render_primitive_list &render_target::get_primitives()
 
 	// optimize the list before handing it off
 	add_clear_and_optimize_primitive_list(list);
+	list.m_generation = ++m_generation;
 	list.release_lock();
+
+	// remember what it was built from so it can be reused
+	if (cacheable)
+	{
+		m_cachekey.swap(m_nextkey);
+		m_cachedlist = &list;
+	}
+	else
+	{
+		m_cachedlist = nullptr;
+	}
+
+	m_manager.machine().telemetry().add(frame_telemetry::RENDER, osd_ticks() - start_ticks);
 	return list;
 }
 
 
+//-------------------------------------------------
+//  compute_primitive_key - gather everything the
+//  primitive list depends on; returns false if
+//  the list can't be reused at all
+//-------------------------------------------------
+
+bool render_target::compute_primitive_key(std::vector<u64> &key, s32 viswidth, s32 visheight, bool running)
+{
+	key.clear();
+
+	// target configuration
+	key.push_back(u64(u32(m_width)) | (u64(u32(m_height)) << 32));
+	key.push_back(u64(u32(viswidth)) | (u64(u32(visheight)) << 32));
+	key.push_back(u64(u32(m_maxtexwidth)) | (u64(u32(m_maxtexheight)) << 32));
+	key.push_back(u64(u32(m_orientation)) | (u64(m_transform_container ? 1 : 0) << 32) | (u64(m_layerconfig.screen_overlay_enabled() ? 1 : 0) << 33));
+	key.push_back(u64(running ? 1 : 0) | (u64(is_ui_target() ? 1 : 0) << 1));
+
+	if (running)
+	{
+		// the state of every visible item in the view
+		for (layout_view_item &curitem : current_view().visible_items())
+		{
+			render_bounds const bounds = curitem.bounds();
+			render_color const color = curitem.color();
+			key.push_back(reinterpret_cast<uintptr_t>(&curitem));
+			key.push_back(u64(f2u(bounds.x0)) | (u64(f2u(bounds.y0)) << 32));
+			key.push_back(u64(f2u(bounds.x1)) | (u64(f2u(bounds.y1)) << 32));
+			key.push_back(u64(f2u(color.a)) | (u64(f2u(color.r)) << 32));
+			key.push_back(u64(f2u(color.g)) | (u64(f2u(color.b)) << 32));
+			if (curitem.screen())
+			{
+				if (!add_container_key(key, curitem.screen()->container()))
+					return false;
+			}
+			else
+			{
+				key.push_back(u32(curitem.element_state()));
+				key.push_back(u64(f2u(curitem.scroll_pos_x())) | (u64(f2u(curitem.scroll_pos_y())) << 32));
+				key.push_back(u64(f2u(curitem.scroll_size_x())) | (u64(f2u(curitem.scroll_size_y())) << 32));
+			}
+		}
+	}
+
+	// the UI is drawn on top
+	if (is_ui_target() && !add_container_key(key, m_manager.ui_container()))
+		return false;
+
+	return true;
+}
+
+
+//-------------------------------------------------
+//  add_container_key - add the contents of a
+//  container and its textures to a key
+//-------------------------------------------------
+
+bool render_target::add_container_key(std::vector<u64> &key, render_container &container)
+{
+	// pick up palette changes before checking the generation
+	container.update_palette();
+	key.push_back(reinterpret_cast<uintptr_t>(&container));
+	key.push_back(container.generation());
+
+	// textures can change without the container changing
+	for (render_container::item &curitem : container.items())
+	{
+		render_texture const *const texture = curitem.texture();
+		if (texture)
+		{
+			if (texture->volatile_contents())
+				return false;
+			key.push_back(texture->generation());
+		}
+	}
+	if (container.overlay())
+		key.push_back(container.overlay()->generation());
+
+	return true;
+}
+
+
 //-------------------------------------------------
 //  map_point_container - attempts to map a point
 //  on the specified render_target to the
@@ -1615,7 +1901,11 @@ void render_target::invalidate_all(void *refptr)
 		// if we have a reference to this object, release our list
 		list.acquire_lock();
 		if (list.has_reference(refptr))
+		{
 			list.release_all();
+			if (&list == m_cachedlist)
+				m_cachedlist = nullptr;
+		}
 		list.release_lock();
 	}
 }
@@ -1653,6 +1943,8 @@ void render_target::update_layer_config()
 
 void render_target::load_layout_files(const internal_layout *layoutfile, bool singlefile)
 {
+	phase_trace_scope scope("render_target::load_layout_files");
+
 	bool have_artwork = false;
 
 	// if there's an explicit file, load that first
@@ -1667,6 +1959,8 @@ void render_target::load_layout_files(const internal_layout *layoutfile, bool si
 
 void render_target::load_layout_files(util::xml::data_node const &rootnode, bool singlefile)
 {
+	phase_trace_scope scope("render_target::load_layout_files");
+
 	bool have_artwork = false;
 
 	// if there's an explicit file, load that first
@@ -2378,10 +2672,9 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					width = std::min(width, m_maxtexwidth);
 					height = std::min(height, m_maxtexheight);
 
-					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
-
-					// set the palette
+					// set the palette first, since a palette change means unchanged textures need a new sequence number
 					prim->texture.palette = curitem.texture()->get_adjusted_palette(container, prim->texture.palette_length);
+					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
 
 					// determine UV coordinates
 					prim->texcoords = oriented_texcoords[finalorient];
@@ -159,6 +159,8 @@ struct render_texinfo
 	u32                 width;              // width of the image
 	u32                 height;             // height of the image
 	u32                 seqid;              // sequence ID
+	u32                 dirty_top;          // first row changed since sequence ID seqid - 1
+	u32                 dirty_bottom;       // last row changed since sequence ID seqid - 1
 	u64                 unique_id;          // unique identifier to pass to osd
 	u64                 old_id;             // previously allocated id, if applicable
 	const rgb_t *       palette;            // palette for PALETTE16 textures, bcg lookup table for RGB32/YUY16
@@ -259,6 +261,7 @@ class render_primitive_list
 public:
 	// getters
 	render_primitive *first() const { return m_primlist.first(); }
+	u64 generation() const { return m_generation; }
 
 	// range iterators
 	using auto_iterator = simple_list<render_primitive>::auto_iterator;
@@ -295,6 +298,7 @@ private:
 
 	fixed_allocator<render_primitive> m_primitive_allocator;// allocator for primitives
 	fixed_allocator<reference> m_reference_allocator;       // allocator for references
+	u64                      m_generation;                  // changes whenever the contents are rebuilt
 
 	std::recursive_mutex     m_lock;                             // lock to protect list accesses
 };
@@ -327,6 +331,7 @@ public:
 
 	// configure the texture bitmap
 	void set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format);
+	void set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format, const rectangle &dirty);
 
 	// set a unique identifier
 	void set_id(u64 id) { m_old_id = m_id; m_id = id; }
@@ -338,6 +343,8 @@ private:
 	// internal helpers
 	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
 	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
+	bool volatile_contents() const { return !m_tracked && (m_scaler == nullptr); }
+	u32 generation() const { return m_generation; }
 
 	static constexpr int MAX_TEXTURE_SCALES = 100;
 
@@ -356,6 +363,16 @@ private:
 	texture_format      m_format;                   // format of the texture data
 	u64                 m_id;                       // unique id to pass to osd
 	u64                 m_old_id;                   // previous id, if applicable
+	u32                 m_generation;               // bumped whenever the source bitmap changes
+
+	// change tracking (unscaled only)
+	bool                m_tracked;                  // contents only change through set_bitmap with a dirty area
+	bool                m_changed;                  // contents changed since the last sequence number was handed out
+	rectangle           m_dirty;                    // area changed since the last sequence number was handed out
+	u32                 m_dirty_top;                // first row changed for the current sequence number
+	u32                 m_dirty_bottom;             // last row changed for the current sequence number
+	u32                 m_lookup_serial;            // container lookup tables the current sequence number was built with
+	bool                m_lookup_changed;           // container lookup tables changed since the last sequence number
 
 	// scaling state (ARGB32 only)
 	texture_scaler_func m_scaler;                   // scaling callback
@@ -412,7 +429,7 @@ public:
 	void set_user_settings(const user_settings &settings);
 
 	// empty the item list
-	void empty() { m_item_allocator.reclaim_all(m_itemlist); }
+	void empty();
 
 	// add items to the list
 	void add_line(float x0, float y0, float x1, float y1, float width, rgb_t argb, u32 flags);
@@ -426,6 +443,7 @@ public:
 	u8 apply_brightness_contrast_gamma(u8 value);
 	float apply_brightness_contrast_gamma_fp(float value);
 	const rgb_t *bcg_lookup_table(int texformat, u32 &out_length, palette_t *palette = nullptr);
+	u32 lookup_serial() const { return m_lookup_serial; }
 
 private:
 	// an item describes a high level primitive that is added to a container
@@ -465,13 +483,19 @@ private:
 	// internal helpers
 	const simple_list<item> &items() const { return m_itemlist; }
 	item &add_generic(u8 type, float x0, float y0, float x1, float y1, rgb_t argb);
+	void item_added(const item &newitem);
+	u32 generation();
 	void recompute_lookups();
 	void update_palette();
 
 	// internal state
 	render_manager &        m_manager;              // reference back to the owning manager
 	simple_list<item>       m_itemlist;             // head of the item list
+	simple_list<item>       m_previtems;            // items from before the last empty()
 	fixed_allocator<item>   m_item_allocator;       // free container items
+	item *                  m_compare;              // next previous item a refill is expected to repeat
+	bool                    m_matching;             // items added since empty() repeat the previous ones
+	u32                     m_generation;           // bumped whenever the contents change
 	screen_device *         m_screen;               // the screen device
 	user_settings           m_user;                 // user settings
 	bitmap_argb32 *         m_overlaybitmap;        // overlay bitmap
@@ -479,6 +503,7 @@ private:
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	u32                     m_lookup_serial;        // bumped whenever either lookup table changes
 };
 
 
@@ -592,6 +617,10 @@ private:
 	void add_clear_extents(render_primitive_list &list);
 	void add_clear_and_optimize_primitive_list(render_primitive_list &list);
 
+	// primitive list reuse
+	bool compute_primitive_key(std::vector<u64> &key, s32 viswidth, s32 visheight, bool running);
+	static bool add_container_key(std::vector<u64> &key, render_container &container);
+
 	// constants
 	static constexpr int NUM_PRIMLISTS = 3;
 	static constexpr int MAX_CLEAR_EXTENTS = 1000;
@@ -605,6 +634,10 @@ private:
 	u32                     m_flags;                    // creation flags
 	render_primitive_list   m_primlist[NUM_PRIMLISTS];  // list of primitives
 	int                     m_listindex;                // index of next primlist to use
+	render_primitive_list * m_cachedlist;               // most recently built list, if it can be reused
+	std::vector<u64>        m_cachekey;                 // everything the cached list was built from
+	std::vector<u64>        m_nextkey;                  // scratch key for the current request
+	u64                     m_generation;               // number of primitive lists built
 	s32                     m_width;                    // width in pixels
 	s32                     m_height;                   // height in pixels
 	render_bounds           m_bounds;                   // bounds of the target
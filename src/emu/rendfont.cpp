@@ -13,6 +13,7 @@
 
 #include "emuopts.h"
 #include "fileio.h"
+#include "phasetrace.h"
 
 #include "corestr.h"
 #include "coreutil.h"
@@ -914,6 +915,8 @@ float render_font::utf8string_width(float height, float aspect, std::string_view
 
 bool render_font::load_cached_bdf(std::string_view filename)
 {
+	phase_trace_scope scope("render_font::load_cached_bdf");
+
 	std::error_condition filerr;
 	u32 chunk;
 	std::size_t bytes;
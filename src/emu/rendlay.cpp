@@ -37,14 +37,16 @@
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 
 #define LOG_GROUP_BOUNDS_RESOLUTION (1U << 1)
 #define LOG_INTERACTIVE_ITEMS       (1U << 2)
 #define LOG_DISK_DRAW               (1U << 3)
 #define LOG_IMAGE_LOAD              (1U << 4)
+#define LOG_TEXTURE_CACHE           (1U << 5)
 
-//#define VERBOSE (LOG_GROUP_BOUNDS_RESOLUTION | LOG_INTERACTIVE_ITEMS | LOG_DISK_DRAW | LOG_IMAGE_LOAD)
+//#define VERBOSE (LOG_GROUP_BOUNDS_RESOLUTION | LOG_INTERACTIVE_ITEMS | LOG_DISK_DRAW | LOG_IMAGE_LOAD | LOG_TEXTURE_CACHE)
 #define LOG_OUTPUT_FUNC osd_printf_verbose
 #include "logmacro.h"
 
@@ -82,6 +84,10 @@ namespace {
 
 constexpr int LAYOUT_VERSION = 2;
 
+// bump this whenever element drawing changes in a way that would make cached textures stale
+constexpr u32 TEXTURE_CACHE_VERSION = 1;
+constexpr char TEXTURE_CACHE_MAGIC[8] = { 'M', 'A', 'M', 'E', 'E', 'L', 'T', '\0' };
+
 enum
 {
 	LINE_CAP_NONE = 0,
@@ -1276,6 +1282,7 @@ layout_element::layout_element(environment &env, util::xml::data_node const &ele
 	, m_defstate(env.get_attribute_int(elemnode, "defstate", -1))
 	, m_statemask(0)
 	, m_foldhigh(false)
+	, m_cachekey_valid(false)
 {
 	// parse components in order
 	bool first = true;
@@ -1666,12 +1673,173 @@ void layout_element::preload()
 void layout_element::element_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param)
 {
 	texture const &elemtex(*reinterpret_cast<texture const *>(param));
+	layout_element &element(*elemtex.m_element);
+
+	// use what an earlier run drew at this size if we can
+	std::string const cachename(element.cache_file_name(elemtex.m_state, dest.width(), dest.height()));
+	if (!cachename.empty() && element.load_cached(cachename, dest))
+		return;
 
 	// draw components that are visible in the current state
-	for (auto const &curcomp : elemtex.m_element->m_complist)
+	for (auto const &curcomp : element.m_complist)
 	{
 		if ((elemtex.m_state & curcomp->statemask()) == curcomp->stateval())
-			curcomp->draw(elemtex.m_element->machine(), dest, elemtex.m_state);
+			curcomp->draw(element.machine(), dest, elemtex.m_state);
+	}
+
+	if (!cachename.empty())
+		element.save_cached(cachename, dest);
+}
+
+
+//-------------------------------------------------
+//  cache_key - get a digest of everything that
+//  affects what the components draw, or nullptr
+//  if some of it can't be captured
+//-------------------------------------------------
+
+util::sha1_t const *layout_element::cache_key()
+{
+	if (!m_cachekey_valid)
+	{
+		m_cachekey_valid = true;
+
+		// the version is hashed in native byte order, so cached pixels never cross platforms
+		util::sha1_creator hash;
+		u32 const version(TEXTURE_CACHE_VERSION);
+		hash.append(&version, sizeof(version));
+		std::string_view const build(emulator_info::get_build_version());
+		hash.append(build.data(), build.length());
+
+		bool cacheable(true);
+		for (component::ptr const &curcomp : m_complist)
+		{
+			component &comp(*curcomp);
+			char const *const type(typeid(comp).name());
+			hash.append(type, std::strlen(type));
+			if (!comp.add_cache_key(machine(), hash))
+			{
+				cacheable = false;
+				break;
+			}
+		}
+		if (cacheable)
+			m_cachekey = hash.finish();
+	}
+	return m_cachekey ? &*m_cachekey : nullptr;
+}
+
+
+//-------------------------------------------------
+//  cache_file_name - get the texture cache file
+//  name for a state drawn at a given size, or an
+//  empty string if it can't be cached
+//-------------------------------------------------
+
+std::string layout_element::cache_file_name(int state, s32 width, s32 height)
+{
+	char const *const directory(machine().options().artcache_directory());
+	if (!directory || !*directory)
+		return std::string();
+
+	util::sha1_t const *const key(cache_key());
+	if (!key)
+		return std::string();
+
+	util::sha1_creator hash;
+	hash.append(key->m_raw, sizeof(key->m_raw));
+	s32 const params[3] = { state, width, height };
+	hash.append(params, sizeof(params));
+	return hash.finish().as_string() + ".elt";
+}
+
+
+//-------------------------------------------------
+//  load_cached - read a texture drawn by an
+//  earlier run
+//-------------------------------------------------
+
+bool layout_element::load_cached(std::string const &name, bitmap_argb32 &dest) const
+{
+	emu_file file(machine().options().artcache_directory(), OPEN_FLAG_READ);
+	if (file.open(name))
+		return false;
+
+	// the name covers the contents; just make sure it's a complete file of the right size
+	constexpr u32 headerbytes(sizeof(TEXTURE_CACHE_MAGIC) + (2 * sizeof(u32)));
+	u32 const rowbytes(u32(dest.width()) * sizeof(u32));
+	if (file.size() != (headerbytes + (u64(rowbytes) * dest.height())))
+	{
+		LOGMASKED(LOG_TEXTURE_CACHE, "Ignoring damaged cached element texture '%s'\n", name);
+		return false;
+	}
+
+	// pages come straight from the host's file cache, with no intermediate buffer
+	std::shared_ptr<u8> data;
+	std::error_condition const filerr(file.map(data));
+	if (filerr)
+	{
+		LOGMASKED(LOG_TEXTURE_CACHE, "Unable to map cached element texture '%s' (%s:%d %s)\n",
+				name, filerr.category().name(), filerr.value(), filerr.message());
+		return false;
+	}
+
+	u8 const *const header(data.get());
+	u32 dims[2];
+	std::memcpy(dims, &header[sizeof(TEXTURE_CACHE_MAGIC)], sizeof(dims));
+	if (std::memcmp(header, TEXTURE_CACHE_MAGIC, sizeof(TEXTURE_CACHE_MAGIC)) || (dims[0] != u32(dest.width())) || (dims[1] != u32(dest.height())))
+	{
+		LOGMASKED(LOG_TEXTURE_CACHE, "Ignoring damaged cached element texture '%s'\n", name);
+		return false;
+	}
+
+	// copy into the texture, all at once if there's no padding
+	u8 const *const pixels(header + headerbytes);
+	if (dest.rowpixels() == dest.width())
+	{
+		std::memcpy(&dest.pix(0), pixels, size_t(rowbytes) * dest.height());
+	}
+	else
+	{
+		for (s32 y = 0; dest.height() > y; ++y)
+			std::memcpy(&dest.pix(y), pixels + (size_t(rowbytes) * y), rowbytes);
+	}
+	LOGMASKED(LOG_TEXTURE_CACHE, "Loaded %dx%d element texture from cache '%s'\n", dest.width(), dest.height(), name);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  save_cached - write a texture to the cache for
+//  future runs
+//-------------------------------------------------
+
+void layout_element::save_cached(std::string const &name, bitmap_argb32 const &dest) const
+{
+	emu_file file(machine().options().artcache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	std::error_condition const filerr(file.open(name));
+	if (filerr)
+	{
+		LOGMASKED(LOG_TEXTURE_CACHE, "Unable to create cached element texture '%s' (%s:%d %s)\n",
+				name, filerr.category().name(), filerr.value(), filerr.message());
+		return;
+	}
+
+	u8 header[sizeof(TEXTURE_CACHE_MAGIC) + (2 * sizeof(u32))];
+	u32 const dims[2] = { u32(dest.width()), u32(dest.height()) };
+	std::memcpy(header, TEXTURE_CACHE_MAGIC, sizeof(TEXTURE_CACHE_MAGIC));
+	std::memcpy(&header[sizeof(TEXTURE_CACHE_MAGIC)], dims, sizeof(dims));
+	bool ok(file.write(header, sizeof(header)) == sizeof(header));
+
+	u32 const rowbytes(u32(dest.width()) * sizeof(u32));
+	for (s32 y = 0; ok && (dest.height() > y); ++y)
+		ok = file.write(&dest.pix(y), rowbytes) == rowbytes;
+
+	// a short file is ignored when loading, but don't leave it around
+	if (!ok)
+	{
+		LOGMASKED(LOG_TEXTURE_CACHE, "Error writing cached element texture '%s'\n", name);
+		file.remove_on_close();
 	}
 }
 
@@ -1699,6 +1867,14 @@ public:
 			load_image(machine);
 	}
 
+	virtual bool add_cache_key(running_machine &machine, util::sha1_creator &hash) override
+	{
+		if (!m_sourcehashed)
+			hash_source();
+		hash.append(m_sourcehash.m_raw, sizeof(m_sourcehash.m_raw));
+		return component::add_cache_key(machine, hash);
+	}
+
 protected:
 	virtual void draw_aligned(running_machine &machine, bitmap_argb32 &dest, rectangle const &bounds, int state) override
 	{
@@ -1826,8 +2002,41 @@ private:
 		}
 	}
 
+	void hash_source()
+	{
+		// identify the image by content so edited artwork isn't drawn from the texture cache
+		util::sha1_creator hash;
+		emu_file file(m_searchpath.empty() ? m_dirname : m_searchpath, OPEN_FLAG_READ);
+		auto const add_file =
+				[this, &hash, &file] (std::string const &name)
+				{
+					hash.append(name.c_str(), name.length() + 1);
+					if (!name.empty())
+					{
+						std::string filename;
+						if (!m_searchpath.empty())
+							filename = m_dirname;
+						util::path_append(filename, name);
+						util::sha1_t sha1;
+						if (!file.open(filename) && file.hashes(util::hash_collection::HASH_TYPES_CRC_SHA1).sha1(sha1))
+							hash.append(sha1.m_raw, sizeof(sha1.m_raw));
+						file.close();
+					}
+				};
+		add_file(m_imagefile);
+		add_file(m_alphafile);
+		hash.append(m_data.c_str(), m_data.length());
+		m_sourcehash = hash.finish();
+		m_sourcehashed = true;
+	}
+
 	void load_image(running_machine &machine)
 	{
+		// the file names are discarded once loaded, so hash the source first if it may be needed
+		char const *const cachedir(machine.options().artcache_directory());
+		if (!m_sourcehashed && cachedir && *cachedir)
+			hash_source();
+
 		// if we have a filename, go with that
 		emu_file file(m_searchpath.empty() ? m_dirname : m_searchpath, OPEN_FLAG_READ);
 		if (!m_imagefile.empty())
@@ -2083,6 +2292,8 @@ private:
 	std::shared_ptr<NSVGrasterizer> m_rasterizer;       // SVG rasteriser
 	bitmap_argb32                   m_bitmap;           // source bitmap for images
 	bool                            m_hasalpha = false; // is there any alpha component present?
+	util::sha1_t                    m_sourcehash;       // digest of the image source for the texture cache
+	bool                            m_sourcehashed = false; // whether m_sourcehash is valid
 
 	// cold state
 	std::string                     m_searchpath;       // asset search path (for lazy loading)
@@ -2451,6 +2662,16 @@ public:
 		m_textalign = env.get_attribute_int(compnode, "align", 0);
 	}
 
+	// overrides
+	virtual bool add_cache_key(running_machine &machine, util::sha1_creator &hash) override
+	{
+		std::string_view const font(machine.options().ui_font());
+		hash.append(font.data(), font.length());
+		hash.append(m_string.c_str(), m_string.length() + 1);
+		hash.append(&m_textalign, sizeof(m_textalign));
+		return component::add_cache_key(machine, hash);
+	}
+
 protected:
 	// overrides
 	virtual void draw_aligned(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
@@ -3033,6 +3254,16 @@ public:
 	{
 	}
 
+	// overrides
+	virtual bool add_cache_key(running_machine &machine, util::sha1_creator &hash) override
+	{
+		std::string_view const font(machine.options().ui_font());
+		hash.append(font.data(), font.length());
+		int const params[3] = { m_digits, m_textalign, m_maxstate };
+		hash.append(params, sizeof(params));
+		return component::add_cache_key(machine, hash);
+	}
+
 protected:
 	// overrides
 	virtual int maxstate() const override { return m_maxstate; }
@@ -3104,6 +3335,12 @@ public:
 
 	}
 
+	virtual bool add_cache_key(running_machine &machine, util::sha1_creator &hash) override
+	{
+		// scrolls through thousands of states and mixes fonts with images, so not worth caching
+		return false;
+	}
+
 protected:
 	virtual int maxstate() const override { return 65535; }
 
@@ -3641,6 +3878,32 @@ void layout_element::component::preload(running_machine &machine)
 }
 
 
+//-------------------------------------------------
+//  add_cache_key - add everything that affects
+//  drawing to a texture cache key, returning
+//  false if the component can't be cached
+//-------------------------------------------------
+
+bool layout_element::component::add_cache_key(running_machine &machine, util::sha1_creator &hash)
+{
+	int const state[2] = { m_statemask, m_stateval };
+	hash.append(state, sizeof(state));
+	for (auto const &step : m_bounds)
+	{
+		hash.append(&step.state, sizeof(step.state));
+		hash.append(&step.bounds, sizeof(step.bounds));
+		hash.append(&step.delta, sizeof(step.delta));
+	}
+	for (auto const &step : m_color)
+	{
+		hash.append(&step.state, sizeof(step.state));
+		hash.append(&step.color, sizeof(step.color));
+		hash.append(&step.delta, sizeof(step.delta));
+	}
+	return true;
+}
+
+
 //-------------------------------------------------
 //  draw - draw element to texture for a given
 //  state
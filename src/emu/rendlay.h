@@ -20,6 +20,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -116,6 +117,7 @@ private:
 		// operations
 		virtual void preload(running_machine &machine);
 		virtual void draw(running_machine &machine, bitmap_argb32 &dest, int state);
+		virtual bool add_cache_key(running_machine &machine, util::sha1_creator &hash);
 
 	protected:
 		// helpers
@@ -181,6 +183,10 @@ private:
 
 	// internal helpers
 	static void element_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
+	util::sha1_t const *cache_key();
+	std::string cache_file_name(int state, s32 width, s32 height);
+	bool load_cached(std::string const &name, bitmap_argb32 &dest) const;
+	void save_cached(std::string const &name, bitmap_argb32 const &dest) const;
 	template <typename T> static component::ptr make_component(environment &env, util::xml::data_node const &compnode);
 
 	static make_component_map const s_make_component; // maps component XML names to creator functions
@@ -192,6 +198,8 @@ private:
 	int                         m_statemask;    // mask to apply to state values
 	bool                        m_foldhigh;     // whether we need to fold state values above the mask range
 	std::vector<texture>        m_elemtex;      // array of element textures used for managing the scaled bitmaps
+	bool                        m_cachekey_valid; // whether m_cachekey has been worked out
+	std::optional<util::sha1_t> m_cachekey;     // identifies what the components draw in the texture cache, if they can be cached
 };
 
 
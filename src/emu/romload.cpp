@@ -14,6 +14,7 @@
 #include "drivenum.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "phasetrace.h"
 #include "softlist_dev.h"
 #include "ui/uimain.h"
 
@@ -680,7 +681,8 @@ std::unique_ptr<emu_file> rom_load_manager::open_rom_file(const std::vector<std:
 	tried.insert(tried.end(), paths.begin(), paths.end());
 
 	// attempt to open the file
-	std::unique_ptr<emu_file> result(new emu_file(machine().options().media_path(), paths, OPEN_FLAG_READ));
+	// don't preload archive members - stored ones may be mapped rather than read
+	std::unique_ptr<emu_file> result(new emu_file(machine().options().media_path(), paths, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD));
 	result->set_restrict_to_mediapath(1);
 	if (has_crc)
 		filerr = result->open(name, crc);
@@ -828,6 +830,37 @@ int rom_load_manager::read_rom_data(emu_file *file, const rom_entry *parent_regi
 }
 
 
+/*-------------------------------------------------
+    map_rom_data - back the current region with
+    a copy-on-write mapping of the file if it is
+    loaded whole with no transformation
+-------------------------------------------------*/
+
+bool rom_load_manager::map_rom_data(emu_file &file, const rom_entry *parent_region, const rom_entry *romp)
+{
+	// must be a straight load of the entire region from a single file
+	if ((ROM_GETOFFSET(romp) != 0) || (ROM_GETLENGTH(romp) != m_region->bytes()) || (file.size() != m_region->bytes()))
+		return false;
+	if (ROM_INHERITSFLAGS(romp) || (ROM_GETGROUPSIZE(romp) != 1) || ROM_GETSKIPCOUNT(romp) || ROM_ISREVERSED(romp) || (ROM_GETBITWIDTH(romp) != 8) || ROM_GETBITSHIFT(romp))
+		return false;
+	if (!ROMENTRY_ISREGIONEND(romp + 1))
+		return false;
+
+	// post-processing would dirty every page anyway
+	if (ROMREGION_ISINVERTED(parent_region) || ((m_region->bytewidth() > 1) && (m_region->endianness() != ENDIANNESS_NATIVE)))
+		return false;
+
+	// not all files and archive members can be mapped
+	std::shared_ptr<u8> data;
+	if (file.map(data))
+		return false;
+
+	LOG("Mapped ROM data: len=%X\n", m_region->bytes());
+	m_region->attach_mapping(std::move(data));
+	return true;
+}
+
+
 /*-------------------------------------------------
     fill_rom_data - fill a region of ROM space
 -------------------------------------------------*/
@@ -945,6 +978,17 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 					handle_missing_file(romp, tried_file_names, std::error_condition());
 			}
 
+			// whole-region loads can use the file data in place
+			if (file && map_rom_data(*file, parent_region, romp))
+			{
+				LOG("Verifying length (%X) and checksums\n", ROM_GETLENGTH(romp));
+				verify_length_and_hash(file.get(), romp->name(), ROM_GETLENGTH(romp), util::hash_collection(romp->hashdata()));
+				LOG("Closing ROM file\n");
+				file.reset();
+				romp++;
+				continue;
+			}
+
 			// loop until we run out of reloads
 			do
 			{
@@ -1355,6 +1399,7 @@ void rom_load_manager::process_region_list()
 
 			std::string regiontag = device.subtag(region->name());
 			LOG("Processing region \"%s\" (length=%X)\n", regiontag.c_str(), regionlength);
+			phase_trace_scope scope(regiontag);
 
 			// the first entry must be a region
 			assert(ROMENTRY_ISREGION(region));
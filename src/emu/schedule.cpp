@@ -289,7 +289,8 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
-	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
+	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000),
+	m_short_timeslice(osd_ticks_per_second() / 50'000)
 {
 	// append a single never-expiring timer so there is always one in the list
 	// need to subvert it because it would naturally be inserted in the inactive list
@@ -452,6 +453,11 @@ void device_scheduler::timeslice()
 						exec->m_cycles_stolen = 0;
 						m_executing_device = exec;
 						*exec->m_icountptr = exec->m_cycles_running;
+						// reading the clock around every timeslice costs too much when they're short,
+						// as under a perfect quantum, so only a sample of those is timed and scaled up
+						bool const timed = !exec->m_timing_countdown;
+						osd_ticks_t const start_ticks = timed ? osd_ticks() : 0;
+						osd_trace_begin(exec->device().tag());
 						if (!call_debugger)
 							exec->run();
 						else
@@ -460,6 +466,18 @@ void device_scheduler::timeslice()
 							exec->run();
 							exec->debugger_stop_cpu_hook();
 						}
+						osd_trace_end();
+						if (timed)
+						{
+							osd_ticks_t const ticks = osd_ticks() - start_ticks;
+							exec->m_host_ticks += ticks * exec->m_timing_weight;
+							exec->m_timing_weight = (ticks < m_short_timeslice) ? HOST_TIMING_SAMPLE : 1;
+							exec->m_timing_countdown = exec->m_timing_weight - 1;
+						}
+						else
+						{
+							exec->m_timing_countdown--;
+						}
 
 						// adjust for any cycles we took back
 						assert(ran >= *exec->m_icountptr);
@@ -948,6 +966,7 @@ inline void device_scheduler::execute_timers()
 			if (!timer.m_callback.isnull())
 			{
 				LOG("execute_timers: timer callback %s\n", timer.m_callback.name());
+				osd_trace_scope trace(timer.m_callback.name());
 				timer.m_callback(timer.m_param);
 			}
 
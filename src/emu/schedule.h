@@ -180,6 +180,10 @@ private:
 	simple_list<quantum_slot>   m_quantum_list;             // list of active quanta
 	fixed_allocator<quantum_slot> m_quantum_allocator;      // allocator for quanta
 	attoseconds_t               m_quantum_minimum;          // duration of minimum quantum
+
+	// host timing for frame telemetry
+	static constexpr u32        HOST_TIMING_SAMPLE = 16;    // time one in this many short timeslices
+	osd_ticks_t const           m_short_timeslice;          // timeslices shorter than this are sampled
 };
 
 
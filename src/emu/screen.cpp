@@ -554,6 +554,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_curbitmap(0)
 	, m_curtexture(0)
 	, m_changed(true)
+	, m_changed_area(0, -1, 0, -1)
 	, m_last_partial_scan(0)
 	, m_partial_scan_hpos(0)
 	, m_color(rgb_t(0xff, 0xff, 0xff, 0xff))
@@ -1226,7 +1227,7 @@ bool screen_device::update_partial(int scanline)
 	g_profiler.stop();
 
 	// if we modified the bitmap, we have to commit
-	m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+	note_changed(clip, flags);
 
 	// remember where we left off
 	m_last_partial_scan = scanline + 1;
@@ -1235,6 +1236,21 @@ bool screen_device::update_partial(int scanline)
 }
 
 
+//-------------------------------------------------
+//  note_changed - record the result of a screen
+//  update callback covering the given area
+//-------------------------------------------------
+
+void screen_device::note_changed(const rectangle &clip, u32 flags)
+{
+	if (flags & UPDATE_HAS_NOT_CHANGED)
+		return;
+
+	m_changed = true;
+	m_changed_area = m_changed_area.empty() ? clip : (m_changed_area | clip);
+}
+
+
 //-------------------------------------------------
 //  update_now - perform an update from the last
 //  beam position up to the current beam position
@@ -1323,7 +1339,7 @@ void screen_device::update_now()
 				m_partial_updates_this_frame++;
 
 				// if we modified the bitmap, we have to commit
-				m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+				note_changed(clip, flags);
 			}
 
 			m_partial_scan_hpos = 0;
@@ -1378,7 +1394,7 @@ void screen_device::update_now()
 			g_profiler.stop();
 
 			// if we modified the bitmap, we have to commit
-			m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+			note_changed(clip, flags);
 		}
 	}
 
@@ -1753,8 +1769,12 @@ bool screen_device::update_quads()
 				if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 				{
 					create_composited_bitmap();
+					m_changed_area = m_visarea;
 				}
-				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
+
+				// only the area drawn since this bitmap was last shown can differ from the texture
+				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat(), m_changed_area);
+				m_changed_area.set(0, -1, 0, -1);
 				m_curtexture = m_curbitmap;
 				m_curbitmap = 1 - m_curbitmap;
 			}
@@ -445,6 +445,7 @@ private:
 	void update_scan_bitmap_size(int y);
 	void pre_update_scanline(int y);
 	void create_composited_bitmap();
+	void note_changed(const rectangle &clip, u32 flags);
 	void destroy_scan_bitmaps();
 	void allocate_scan_bitmaps();
 
@@ -485,6 +486,7 @@ private:
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
 	bool                m_changed;                  // has this bitmap changed?
+	rectangle           m_changed_area;             // area drawn into the current bitmap since it was last shown
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
 	bitmap_argb32       m_screen_overlay_bitmap;    // screen overlay bitmap
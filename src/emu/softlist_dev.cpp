@@ -14,6 +14,7 @@
 #include "diimage.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "phasetrace.h"
 #include "romload.h"
 #include "validity.h"
 
@@ -284,6 +285,8 @@ void software_list_device::parse()
 	if (m_parsed)
 		return;
 
+	phase_trace_scope scope("software list ", m_list_name);
+
 	// reset the errors
 	m_errors.clear();
 
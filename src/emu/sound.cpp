@@ -12,6 +12,7 @@
 
 #include "config.h"
 #include "emuopts.h"
+#include "frametime.h"
 #include "speaker.h"
 
 #include "wavwrite.h"
@@ -1482,6 +1483,7 @@ void sound_manager::update(int param)
 	LOG("sound_update\n");
 
 	g_profiler.start(PROFILER_SOUND);
+	osd_ticks_t const start_ticks = osd_ticks();
 
 	// determine the duration of this update
 	attotime update_period = machine().time() - m_last_update;
@@ -1597,11 +1599,16 @@ void sound_manager::update(int param)
 	if (finalmix_offset > 0)
 	{
 		if (!m_nosound_mode)
+		{
+			osd_ticks_t const audio_ticks = osd_ticks();
 			machine().osd().update_audio_stream(finalmix, finalmix_offset / 2);
+			machine().telemetry().add(frame_telemetry::AUDIO, osd_ticks() - audio_ticks);
+		}
 		machine().osd().add_audio_to_recording(finalmix, finalmix_offset / 2);
 		machine().video().add_sound_to_recording(finalmix, finalmix_offset / 2);
 		if (m_wavfile)
 			util::wav_add_data_16(*m_wavfile, finalmix, finalmix_offset);
+		m_output_crc.append(finalmix, finalmix_offset * sizeof(finalmix[0]));
 	}
 
 	// update any orphaned streams so they don't get too far behind
@@ -1618,5 +1625,6 @@ void sound_manager::update(int param)
 	// notify that new samples have been generated
 	emulator_info::sound_hook();
 
+	machine().telemetry().add(frame_telemetry::SOUND, osd_ticks() - start_ticks);
 	g_profiler.stop();
 }
@@ -779,6 +779,9 @@ public:
 	bool start_recording(std::string_view filename);
 	void stop_recording();
 
+	// CRC of every sample mixed so far, for determinism checks
+	util::crc32_t output_crc() { return m_output_crc.finish(); }
+
 	// set the global OSD attenuation level
 	void set_attenuation(float attenuation);
 
@@ -846,6 +849,7 @@ private:
 	int m_attenuation;                    // current attentuation level (at the OSD)
 	int m_unique_id;                      // unique ID used for stream identification
 	util::wav_file_ptr m_wavfile;         // WAV file for streaming
+	util::crc32_creator m_output_crc;     // running CRC of the final mix
 
 	// streams data
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list; // list of streams
@@ -13,6 +13,24 @@
 
 #include "screen.h"
 
+// use SSE2 or NEON for the scanline rasterizers where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define TILEMAP_SSE2    1
+#include <emmintrin.h>
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__ARM_NEON) && defined(__aarch64__)
+#define TILEMAP_NEON    1
+#include <arm_neon.h>
+#endif
+
+// set to 1 to check the SIMD span kernels against scalar code at startup
+#define TILEMAP_VERIFY_SIMD     0
+
+// render dirty tiles on worker threads once there are at least this many
+#define TILEMAP_PARALLEL_MIN_TILES  512
+
+// number of dirty tiles handled by one work item
+#define TILEMAP_TILES_PER_BATCH     128
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -98,6 +116,207 @@ inline bool tilemap_t::gfx_elements_changed()
 }
 
 
+//**************************************************************************
+//  SPAN KERNELS
+//**************************************************************************
+
+namespace {
+
+//-------------------------------------------------
+//  span_priority - apply a priority code across
+//  a span of the priority bitmap
+//-------------------------------------------------
+
+inline void span_priority(u8 *pri, int count, u8 andmask, u8 ormask)
+{
+	int i = 0;
+#if defined(TILEMAP_SSE2)
+	const __m128i vand = _mm_set1_epi8(andmask);
+	const __m128i vor = _mm_set1_epi8(ormask);
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pri[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&pri[i]), _mm_or_si128(_mm_and_si128(p, vand), vor));
+	}
+#elif defined(TILEMAP_NEON)
+	const uint8x16_t vand = vdupq_n_u8(andmask);
+	const uint8x16_t vor = vdupq_n_u8(ormask);
+	for ( ; i + 16 <= count; i += 16)
+		vst1q_u8(&pri[i], vorrq_u8(vandq_u8(vld1q_u8(&pri[i]), vand), vor));
+#endif
+	for ( ; i < count; i++)
+		pri[i] = (pri[i] & andmask) | ormask;
+}
+
+
+//-------------------------------------------------
+//  span_priority_masked - apply a priority code
+//  where the flags match the mask/value pair
+//-------------------------------------------------
+
+inline void span_priority_masked(u8 *pri, const u8 *maskptr, u8 mask, u8 value, int count, u8 andmask, u8 ormask)
+{
+	int i = 0;
+#if defined(TILEMAP_SSE2)
+	const __m128i vmask = _mm_set1_epi8(mask);
+	const __m128i vvalue = _mm_set1_epi8(value);
+	const __m128i vand = _mm_set1_epi8(andmask);
+	const __m128i vor = _mm_set1_epi8(ormask);
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&maskptr[i]));
+		__m128i sel = _mm_cmpeq_epi8(_mm_and_si128(m, vmask), vvalue);
+		__m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pri[i]));
+		__m128i np = _mm_or_si128(_mm_and_si128(p, vand), vor);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&pri[i]), _mm_or_si128(_mm_and_si128(sel, np), _mm_andnot_si128(sel, p)));
+	}
+#elif defined(TILEMAP_NEON)
+	const uint8x16_t vmask = vdupq_n_u8(mask);
+	const uint8x16_t vvalue = vdupq_n_u8(value);
+	const uint8x16_t vand = vdupq_n_u8(andmask);
+	const uint8x16_t vor = vdupq_n_u8(ormask);
+	for ( ; i + 16 <= count; i += 16)
+	{
+		uint8x16_t sel = vceqq_u8(vandq_u8(vld1q_u8(&maskptr[i]), vmask), vvalue);
+		uint8x16_t p = vld1q_u8(&pri[i]);
+		vst1q_u8(&pri[i], vbslq_u8(sel, vorrq_u8(vandq_u8(p, vand), vor), p));
+	}
+#endif
+	for ( ; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			pri[i] = (pri[i] & andmask) | ormask;
+}
+
+
+//-------------------------------------------------
+//  span_copy_ind16 - copy a span of 16bpp pixels,
+//  adding a palette offset
+//-------------------------------------------------
+
+inline void span_copy_ind16(u16 *dest, const u16 *source, int count, u16 pal)
+{
+	int i = 0;
+#if defined(TILEMAP_SSE2)
+	const __m128i vpal = _mm_set1_epi16(pal);
+	for ( ; i + 8 <= count; i += 8)
+	{
+		__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_add_epi16(s, vpal));
+	}
+#elif defined(TILEMAP_NEON)
+	const uint16x8_t vpal = vdupq_n_u16(pal);
+	for ( ; i + 8 <= count; i += 8)
+		vst1q_u16(&dest[i], vaddq_u16(vld1q_u16(&source[i]), vpal));
+#endif
+	for ( ; i < count; i++)
+		dest[i] = source[i] + pal;
+}
+
+
+//-------------------------------------------------
+//  span_copy_masked_ind16 - copy 16bpp pixels,
+//  adding a palette offset, where the flags match
+//  the mask/value pair
+//-------------------------------------------------
+
+inline void span_copy_masked_ind16(u16 *dest, const u16 *source, const u8 *maskptr, u8 mask, u8 value, int count, u16 pal)
+{
+	int i = 0;
+#if defined(TILEMAP_SSE2)
+	const __m128i vmask = _mm_set1_epi8(mask);
+	const __m128i vvalue = _mm_set1_epi8(value);
+	const __m128i vpal = _mm_set1_epi16(pal);
+	for ( ; i + 8 <= count; i += 8)
+	{
+		__m128i m = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&maskptr[i]));
+		__m128i sel = _mm_cmpeq_epi8(_mm_and_si128(m, vmask), vvalue);
+		sel = _mm_unpacklo_epi8(sel, sel);
+		__m128i s = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])), vpal);
+		__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_or_si128(_mm_and_si128(sel, s), _mm_andnot_si128(sel, d)));
+	}
+#elif defined(TILEMAP_NEON)
+	const uint8x8_t vmask = vdup_n_u8(mask);
+	const uint8x8_t vvalue = vdup_n_u8(value);
+	const uint16x8_t vpal = vdupq_n_u16(pal);
+	for ( ; i + 8 <= count; i += 8)
+	{
+		uint8x8_t sel8 = vceq_u8(vand_u8(vld1_u8(&maskptr[i]), vmask), vvalue);
+		uint16x8_t sel = vreinterpretq_u16_u8(vcombine_u8(vzip1_u8(sel8, sel8), vzip2_u8(sel8, sel8)));
+		vst1q_u16(&dest[i], vbslq_u16(sel, vaddq_u16(vld1q_u16(&source[i]), vpal), vld1q_u16(&dest[i])));
+	}
+#endif
+	for ( ; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			dest[i] = source[i] + pal;
+}
+
+
+//-------------------------------------------------
+//  verify_span_kernels - compare the span kernels
+//  against straightforward scalar code on random
+//  spans of random length and alignment
+//-------------------------------------------------
+
+[[maybe_unused]] void verify_span_kernels()
+{
+	constexpr int MAXLEN = 80;
+	u32 seed = 0x12345678;
+	auto rand = [&seed] () { seed = seed * 1103515245 + 12345; return u8(seed >> 16); };
+
+	for (int iter = 0; iter < 20000; iter++)
+	{
+		const int offs = rand() & 15;
+		const int count = rand() % (MAXLEN - 16);
+		const u8 mask = rand(), value = rand() & mask, andmask = rand(), ormask = rand();
+		const u16 pal = (rand() << 8) | rand();
+
+		u8 flags[MAXLEN], pri[MAXLEN], pri_ref[MAXLEN];
+		u16 source[MAXLEN], dest[MAXLEN], dest_ref[MAXLEN];
+		for (int i = 0; i < MAXLEN; i++)
+		{
+			// bias towards matching flags so both outcomes are exercised
+			flags[i] = (rand() & 1) ? (value | (rand() & ~mask)) : rand();
+			pri[i] = pri_ref[i] = rand();
+			source[i] = (rand() << 8) | rand();
+			dest[i] = dest_ref[i] = (rand() << 8) | rand();
+		}
+
+		switch (iter & 3)
+		{
+		case 0:
+			span_priority(&pri[offs], count, andmask, ormask);
+			for (int i = offs; i < offs + count; i++)
+				pri_ref[i] = (pri_ref[i] & andmask) | ormask;
+			break;
+		case 1:
+			span_priority_masked(&pri[offs], &flags[offs], mask, value, count, andmask, ormask);
+			for (int i = offs; i < offs + count; i++)
+				if ((flags[i] & mask) == value)
+					pri_ref[i] = (pri_ref[i] & andmask) | ormask;
+			break;
+		case 2:
+			span_copy_ind16(&dest[offs], &source[offs], count, pal);
+			for (int i = offs; i < offs + count; i++)
+				dest_ref[i] = source[i] + pal;
+			break;
+		case 3:
+			span_copy_masked_ind16(&dest[offs], &source[offs], &flags[offs], mask, value, count, pal);
+			for (int i = offs; i < offs + count; i++)
+				if ((flags[i] & mask) == value)
+					dest_ref[i] = source[i] + pal;
+			break;
+		}
+
+		if (memcmp(pri, pri_ref, sizeof(pri)) != 0 || memcmp(dest, dest_ref, sizeof(dest)) != 0)
+			fatalerror("tilemap: span kernel %d does not match the scalar implementation (count %d)\n", iter & 3, count);
+	}
+}
+
+} // anonymous namespace
+
+
+
 //**************************************************************************
 //  SCANLINE RASTERIZERS
 //**************************************************************************
@@ -114,8 +333,7 @@ inline void tilemap_t::scanline_draw_opaque_null(int count, u8 *pri, u32 pcode)
 		return;
 
 	// update priority across the scanline
-	for (int i = 0; i < count; i++)
-		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	span_priority(pri, count, pcode >> 8, pcode);
 }
 
 
@@ -131,9 +349,7 @@ inline void tilemap_t::scanline_draw_masked_null(const u8 *maskptr, int mask, in
 		return;
 
 	// update priority across the scanline, checking the mask
-	for (int i = 0; i < count; i++)
-		if ((maskptr[i] & mask) == value)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	span_priority_masked(pri, maskptr, mask, value, count, pcode >> 8, pcode);
 }
 
 
@@ -157,26 +373,19 @@ inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source,
 			return;
 
 		// update priority across the scanline
-		for (int i = 0; i < count; i++)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+		span_priority(pri, count, pcode >> 8, pcode);
 	}
 
 	// priority case
 	else if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = source[i] + pal;
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		span_copy_ind16(dest, source, count, pal);
+		span_priority(pri, count, pcode >> 8, pcode);
 	}
 
 	// no priority case
 	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = source[i] + pal;
-	}
+		span_copy_ind16(dest, source, count, pal);
 }
 
 
@@ -189,24 +398,11 @@ inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source,
 {
 	int pal = pcode >> 16;
 
+	span_copy_masked_ind16(dest, source, maskptr, mask, value, count, pal);
+
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = source[i] + pal;
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = source[i] + pal;
-	}
+		span_priority_masked(pri, maskptr, mask, value, count, pcode >> 8, pcode);
 }
 
 
@@ -220,22 +416,12 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(u32 *dest, const u16 *source,
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
+	for (int i = 0; i < count; i++)
+		dest[i] = clut[source[i]];
+
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = clut[source[i]];
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = clut[source[i]];
-	}
+		span_priority(pri, count, pcode >> 8, pcode);
 }
 
 
@@ -248,24 +434,13 @@ inline void tilemap_t::scanline_draw_masked_rgb32(u32 *dest, const u16 *source,
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
+	for (int i = 0; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			dest[i] = clut[source[i]];
+
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = clut[source[i]];
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = clut[source[i]];
-	}
+		span_priority_masked(pri, maskptr, mask, value, count, pcode >> 8, pcode);
 }
 
 
@@ -278,22 +453,12 @@ inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(u32 *dest, const u16 *so
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
+	for (int i = 0; i < count; i++)
+		dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
+
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-	}
+		span_priority(pri, count, pcode >> 8, pcode);
 }
 
 
@@ -307,24 +472,13 @@ inline void tilemap_t::scanline_draw_masked_rgb32_alpha(u32 *dest, const u16 *so
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
+	for (int i = 0; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
+
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-	}
+		span_priority_masked(pri, maskptr, mask, value, count, pcode >> 8, pcode);
 }
 
 
@@ -777,12 +931,41 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
-	// iterate over rows and columns
+	// iterate over rows and columns, fetching the info for each dirty tile;
+	// the get info callbacks always run here on the emulation thread
+	m_pending.clear();
 	logical_index logindex = 0;
 	for (u32 row = 0; row < m_rows; row++)
 		for (u32 col = 0; col < m_cols; col++, logindex++)
 			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
-				tile_update(logindex, col, row);
+			{
+				m_pending.emplace_back();
+				tile_gather(logindex, col, row, m_pending.back());
+			}
+
+	// each tile covers its own part of the pixmap, so large refreshes can be
+	// split up between worker threads
+	osd_work_queue *queue = (m_pending.size() >= TILEMAP_PARALLEL_MIN_TILES) ? m_manager->work_queue() : nullptr;
+	if (queue != nullptr)
+	{
+		m_batches.clear();
+		for (u32 start = 0; start < m_pending.size(); start += TILEMAP_TILES_PER_BATCH)
+			m_batches.push_back(tile_batch{ this, start, std::min<u32>(start + TILEMAP_TILES_PER_BATCH, m_pending.size()) });
+		for (tile_batch &batch : m_batches)
+			osd_work_item_queue(queue, tile_batch_callback, &batch, WORK_ITEM_FLAG_AUTO_RELEASE);
+
+		// the batches point into m_pending, so every one of them has to finish
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second() * 10)) { }
+
+#ifdef MAME_DEBUG
+		pixmap_verify();
+#endif
+	}
+	else
+	{
+		for (const pending_tile &tile : m_pending)
+			tile_render(tile);
+	}
 
 	// mark it all clean
 	m_all_tiles_clean = true;
@@ -796,6 +979,19 @@ g_profiler.stop();
 //-------------------------------------------------
 
 void tilemap_t::tile_update(logical_index logindex, u32 col, u32 row)
+{
+	pending_tile tile;
+	tile_gather(logindex, col, row, tile);
+	tile_render(tile);
+}
+
+
+//-------------------------------------------------
+//  tile_gather - fetch the information needed to
+//  render a dirty tile
+//-------------------------------------------------
+
+void tilemap_t::tile_gather(logical_index logindex, u32 col, u32 row, pending_tile &tile)
 {
 g_profiler.start(PROFILER_TILEMAP_UPDATE);
 
@@ -804,17 +1000,16 @@ g_profiler.start(PROFILER_TILEMAP_UPDATE);
 	m_tile_get_info(*this, m_tileinfo, memindex);
 
 	// apply the global tilemap flip to the returned flip flags
-	u32 flags = m_tileinfo.flags ^ (m_attributes & 0x03);
-
-	// draw the tile, using either direct or transparent
-	u32 x0 = m_tilewidth * col;
-	u32 y0 = m_tileheight * row;
-	m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, x0, y0,
-		m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
-
-	// if mask data is specified, apply it
-	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
-		m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
+	tile.logindex = logindex;
+	tile.x0 = m_tilewidth * col;
+	tile.y0 = m_tileheight * row;
+	tile.pen_data = m_tileinfo.pen_data;
+	tile.mask_data = m_tileinfo.mask_data;
+	tile.palette_base = m_tileinfo.palette_base;
+	tile.category = m_tileinfo.category;
+	tile.group = m_tileinfo.group;
+	tile.flags = m_tileinfo.flags ^ (m_attributes & 0x03);
+	tile.pen_mask = m_tileinfo.pen_mask;
 
 	// track which gfx have been used for this tilemap
 	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
@@ -827,6 +1022,76 @@ g_profiler.stop();
 }
 
 
+//-------------------------------------------------
+//  tile_render - draw a gathered tile into the
+//  pixmap and flagsmap; this touches nothing
+//  outside the tile, so it may run on any thread
+//-------------------------------------------------
+
+void tilemap_t::tile_render(const pending_tile &tile)
+{
+	// draw the tile, using either direct or transparent
+	u8 tileflags = tile_draw(tile.pen_data, tile.x0, tile.y0, tile.palette_base, tile.category, tile.group, tile.flags, tile.pen_mask);
+
+	// if mask data is specified, apply it
+	if ((tile.flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && tile.mask_data != nullptr)
+		tileflags = tile_apply_bitmask(tile.mask_data, tile.x0, tile.y0, tile.category, tile.flags);
+
+	m_tileflags[tile.logindex] = tileflags;
+}
+
+
+//-------------------------------------------------
+//  tile_batch_callback - render a range of
+//  gathered tiles on a worker thread
+//-------------------------------------------------
+
+void *tilemap_t::tile_batch_callback(void *param, int threadid)
+{
+	tile_batch &batch = *reinterpret_cast<tile_batch *>(param);
+	tilemap_t &tmap = *batch.tilemap;
+	for (u32 index = batch.start; index < batch.end; index++)
+		tmap.tile_render(tmap.m_pending[index]);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  pixmap_verify - check that rendering the
+//  pending tiles on worker threads gave the same
+//  pixmap and flagsmap as rendering them in order
+//  on this thread
+//-------------------------------------------------
+
+void tilemap_t::pixmap_verify()
+{
+	// keep what the workers produced
+	std::vector<u16> pixels;
+	std::vector<u8> flags;
+	pixels.reserve(size_t(m_width) * m_height);
+	flags.reserve(size_t(m_width) * m_height);
+	for (u32 y = 0; y < m_height; y++)
+	{
+		pixels.insert(pixels.end(), &m_pixmap.pix(y), &m_pixmap.pix(y) + m_width);
+		flags.insert(flags.end(), &m_flagsmap.pix(y), &m_flagsmap.pix(y) + m_width);
+	}
+	std::vector<u8> const tileflags(m_tileflags);
+
+	// render everything again serially and compare
+	for (const pending_tile &tile : m_pending)
+		tile_render(tile);
+	for (u32 y = 0; y < m_height; y++)
+	{
+		if (memcmp(&pixels[size_t(y) * m_width], &m_pixmap.pix(y), m_width * sizeof(u16)) != 0)
+			fatalerror("tilemap in %s: parallel rendering produced a different pixmap at row %u\n", m_device->tag(), y);
+		if (memcmp(&flags[size_t(y) * m_width], &m_flagsmap.pix(y), m_width) != 0)
+			fatalerror("tilemap in %s: parallel rendering produced a different flagsmap at row %u\n", m_device->tag(), y);
+	}
+	if (tileflags != m_tileflags)
+		fatalerror("tilemap in %s: parallel rendering produced different tile flags\n", m_device->tag());
+}
+
+
 //-------------------------------------------------
 //  tile_draw - draw a single tile to the
 //  tilemap's internal pixmap, using the pen as
@@ -1589,8 +1854,11 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_work_queue(nullptr)
 {
+	if (TILEMAP_VERIFY_SIMD)
+		verify_span_kernels();
 }
 
 
@@ -1613,6 +1881,23 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+//-------------------------------------------------
+//  work_queue - return the queue used to render
+//  dirty tiles in parallel, allocating it on
+//  first use
+//-------------------------------------------------
+
+osd_work_queue *tilemap_manager::work_queue()
+{
+	if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	return m_work_queue;
 }
 
 
@@ -547,9 +547,34 @@ private:
 	void mappings_update();
 	void realize_all_dirty_tiles();
 
+	// a dirty tile, as described by the get info callback
+	struct pending_tile
+	{
+		logical_index   logindex;
+		u32             x0, y0;
+		const u8 *      pen_data;
+		const u8 *      mask_data;
+		pen_t           palette_base;
+		u8              category;
+		u8              group;
+		u8              flags;
+		u8              pen_mask;
+	};
+
+	// a range of pending tiles rendered by one work item
+	struct tile_batch
+	{
+		tilemap_t *     tilemap;
+		u32             start, end;
+	};
+
 	// internal drawing
 	void pixmap_update();
 	void tile_update(logical_index logindex, u32 col, u32 row);
+	void tile_gather(logical_index logindex, u32 col, u32 row, pending_tile &tile);
+	void tile_render(const pending_tile &tile);
+	static void *tile_batch_callback(void *param, int threadid);
+	void pixmap_verify();
 	u8 tile_draw(const u8 *pendata, u32 x0, u32 y0, u32 palette_base, u8 category, u8 group, u8 flags, u8 pen_mask);
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
@@ -608,6 +633,10 @@ private:
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
+
+	// dirty tile refresh
+	std::vector<pending_tile>   m_pending;              // dirty tiles gathered by pixmap_update
+	std::vector<tile_batch>     m_batches;              // work items for rendering m_pending
 };
 
 
@@ -642,6 +671,9 @@ public:
 	void mark_all_dirty();
 	void set_flip_all(u32 attributes);
 
+	// queue for rendering dirty tiles in parallel
+	osd_work_queue *work_queue();
+
 private:
 	// tilemap creation
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
@@ -654,6 +686,7 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_work_queue;
 };
 
 
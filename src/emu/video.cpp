@@ -12,6 +12,8 @@
 #include "emuopts.h"
 #include "debugger.h"
 #include "fileio.h"
+#include "frametime.h"
+#include "phasetrace.h"
 #include "ui/uimain.h"
 #include "crsshair.h"
 #include "rendersw.hxx"
@@ -235,9 +237,19 @@ void video_manager::frame_update(bool from_debugger)
 
 	// ask the OSD to update
 	g_profiler.start(PROFILER_BLIT);
+	osd_ticks_t const osd_start = osd_ticks();
 	machine().osd().update(!from_debugger && skipped_it);
+	machine().telemetry().add(frame_telemetry::OSD, osd_ticks() - osd_start);
 	g_profiler.stop();
 
+	// note the first frame that actually reached the screen
+	if (!skipped_it && (phase == machine_phase::RUNNING) && g_phase_tracer.recording())
+	{
+		g_phase_tracer.frame_presented();
+		if (machine().options().bench_startup() > 0)
+			machine().schedule_exit();
+	}
+
 	// we synchronize after rendering instead of before, if low latency mode is enabled
 	if (!from_debugger && !skipped_it && phase > machine_phase::INIT && m_low_latency && effective_throttle())
 		update_throttle(current_time);
@@ -259,6 +271,10 @@ void video_manager::frame_update(bool from_debugger)
 		// update speed computations
 		if (!skipped_it && phase > machine_phase::INIT)
 			recompute_speed(current_time);
+
+		// record frame timing
+		if (phase == machine_phase::RUNNING)
+			machine().telemetry().frame_end(skipped_it);
 	}
 
 	// call the end-of-frame callback
@@ -804,7 +820,8 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 
 	// loop until we reach our target
 	g_profiler.start(PROFILER_IDLE);
-	osd_ticks_t current_ticks = osd_ticks();
+	osd_ticks_t const start_ticks = osd_ticks();
+	osd_ticks_t current_ticks = start_ticks;
 	while (current_ticks < target_ticks)
 	{
 		// compute how much time to sleep for, taking into account the average oversleep
@@ -839,6 +856,7 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 		}
 		current_ticks = new_ticks;
 	}
+	machine().telemetry().add(frame_telemetry::THROTTLE, current_ticks - start_ticks);
 	g_profiler.stop();
 
 	return current_ticks;
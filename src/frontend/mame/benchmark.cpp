@@ -0,0 +1,275 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+/***************************************************************************
+
+    benchmark.cpp
+
+    Headless regression and performance benchmark suite.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "benchmark.h"
+
+#include "frametime.h"
+#include "phasetrace.h"
+#include "screen.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+
+namespace {
+
+//-------------------------------------------------
+//  json_escape - make a string safe to put
+//  between double quotes
+//-------------------------------------------------
+
+std::string json_escape(std::string_view s)
+{
+	std::string result;
+	for (char c : s)
+	{
+		if (('"' == c) || ('\\' == c))
+			result.push_back('\\');
+		if (u8(c) >= 0x20)
+			result.push_back(c);
+	}
+	return result;
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  BENCHMARK SUITE
+//**************************************************************************
+
+//-------------------------------------------------
+//  benchmark_suite - constructor; reads the
+//  manifest
+//-------------------------------------------------
+
+benchmark_suite::benchmark_suite(std::string_view manifest)
+	: m_manifest(manifest)
+{
+	std::ifstream file(m_manifest);
+	if (!file)
+		throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "Unable to open benchmark manifest %s\n", m_manifest);
+
+	std::string linebuf;
+	unsigned line = 0;
+	while (std::getline(file, linebuf))
+	{
+		line++;
+
+		// strip comments, then split into words
+		std::string_view text(linebuf);
+		auto const comment = text.find('#');
+		if (comment != std::string_view::npos)
+			text = text.substr(0, comment);
+		std::istringstream words{ std::string(text) };
+		std::string word;
+		if (!(words >> word))
+			continue;
+
+		entry &e = m_entries.emplace_back(entry{ word, std::string(), std::string(), 60, line });
+		while (words >> word)
+		{
+			auto const equals = word.find('=');
+			if (equals == std::string::npos)
+				throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "%s:%u: expected key=value but found '%s'\n", m_manifest, line, word);
+
+			std::string_view const key = std::string_view(word).substr(0, equals);
+			std::string value = word.substr(equals + 1);
+			if (key == "software")
+			{
+				e.software = std::move(value);
+			}
+			else if (key == "playback")
+			{
+				e.playback = std::move(value);
+			}
+			else if (key == "seconds")
+			{
+				char *end;
+				long const seconds = std::strtol(value.c_str(), &end, 10);
+				if (*end || (seconds <= 0) || (seconds > 86400))
+					throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "%s:%u: invalid number of seconds '%s'\n", m_manifest, line, value);
+				e.seconds = int(seconds);
+			}
+			else
+			{
+				throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "%s:%u: unknown setting '%s'\n", m_manifest, line, key);
+			}
+		}
+	}
+
+	if (m_entries.empty())
+		throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "Benchmark manifest %s lists no systems\n", m_manifest);
+}
+
+
+//-------------------------------------------------
+//  add_result - gather measurements from a
+//  machine that has finished running
+//-------------------------------------------------
+
+void benchmark_suite::add_result(entry const &source, int error, running_machine &machine)
+{
+	osd_ticks_t const now = osd_ticks();
+	osd_ticks_t const tps = osd_ticks_per_second();
+	osd_ticks_t const first_frame = g_phase_tracer.first_frame() ? g_phase_tracer.first_frame() : g_phase_tracer.machine_start();
+
+	result &r = m_results.emplace_back();
+	r.source = &source;
+	r.error = error;
+	r.host_seconds = double(now - first_frame) / double(tps);
+	r.emulated_seconds = machine.time().as_double();
+
+	// the telemetry window is stretched to cover the whole run
+	frame_telemetry const &telemetry = machine.telemetry();
+	frame_telemetry::summary const frame = telemetry.stats(frame_telemetry::FRAME);
+	r.frames = frame.count;
+	r.frame_ns_p50 = u64(frame.p50) * 1000;
+	r.frame_ns_p99 = u64(frame.p99) * 1000;
+	r.peak_memory = osd_peak_memory_usage();
+
+	osd_ticks_t total = 0;
+	for (size_t index = 0; telemetry.device_count() > index; ++index)
+		total += telemetry.device_total(index);
+	for (size_t index = 0; telemetry.device_count() > index; ++index)
+	{
+		osd_ticks_t const ticks = telemetry.device_total(index);
+		r.devices.emplace_back(device_share{
+				telemetry.device(index).tag(),
+				double(ticks) / double(tps),
+				total ? (double(ticks) / double(total)) : 0.0 });
+	}
+
+	// hash what ended up on the screens, resolved through palettes
+	util::crc32_creator pixels;
+	std::vector<u32> buffer;
+	for (screen_device &screen : screen_device_enumerator(machine.root_device()))
+	{
+		rectangle const &visarea = screen.visible_area();
+		buffer.assign(size_t(visarea.width()) * size_t(visarea.height()), 0);
+		screen.pixels(buffer.data());
+		pixels.append(buffer.data(), buffer.size() * sizeof(buffer[0]));
+	}
+	r.frame_crc = pixels.finish();
+	r.audio_crc = machine.sound().output_crc();
+}
+
+
+//-------------------------------------------------
+//  add_failure - record an entry that could not
+//  be run at all
+//-------------------------------------------------
+
+void benchmark_suite::add_failure(entry const &source, int error)
+{
+	result &r = m_results.emplace_back();
+	r.source = &source;
+	r.error = error;
+	r.host_seconds = 0.0;
+	r.emulated_seconds = 0.0;
+	r.frames = 0;
+	r.frame_ns_p50 = 0;
+	r.frame_ns_p99 = 0;
+	r.peak_memory = osd_peak_memory_usage();
+	r.frame_crc = 0;
+	r.audio_crc = 0;
+}
+
+
+//-------------------------------------------------
+//  print_summary - print one line per run
+//-------------------------------------------------
+
+void benchmark_suite::print_summary() const
+{
+	osd_printf_info("%-24s %9s %9s %9s %9s %8s %8s %7s\n", "system", "emu sec", "frames/s", "p50 us", "p99 us", "video", "audio", "RSS MiB");
+	for (result const &r : m_results)
+	{
+		std::string name = r.source->system;
+		if (!r.source->software.empty())
+			name += ":" + r.source->software;
+
+		if (r.error != EMU_ERR_NONE)
+		{
+			osd_printf_info("%-24s failed with error %d\n", name, r.error);
+			continue;
+		}
+
+		osd_printf_info(
+				"%-24s %9.2f %9.2f %9.1f %9.1f %08x %08x %7.1f\n",
+				name,
+				r.emulated_seconds,
+				r.host_seconds ? (double(r.frames) / r.host_seconds) : 0.0,
+				r.frame_ns_p50 * 1e-3,
+				r.frame_ns_p99 * 1e-3,
+				r.frame_crc,
+				r.audio_crc,
+				double(r.peak_memory) / double(1 << 20));
+		for (device_share const &d : r.devices)
+			osd_printf_verbose("    %-20s %6.2f%% %9.3f s\n", d.tag, d.share * 100.0, d.host_seconds);
+	}
+}
+
+
+//-------------------------------------------------
+//  write - write results as JSON for comparing
+//  builds
+//-------------------------------------------------
+
+bool benchmark_suite::write(std::string_view filename) const
+{
+	std::ofstream file(std::string(filename), std::ios::out | std::ios::trunc);
+	if (!file)
+		return false;
+
+	util::stream_format(file, "{\"build\":\"%s\",\"manifest\":\"%s\",\"results\":[", json_escape(emulator_info::get_build_version()), json_escape(m_manifest));
+	bool first = true;
+	for (result const &r : m_results)
+	{
+		util::stream_format(
+				file,
+				"%s\n{\"line\":%u,\"system\":\"%s\",\"software\":\"%s\",\"playback\":\"%s\",\"seconds\":%d,\"error\":%d,",
+				first ? "" : ",",
+				r.source->line,
+				json_escape(r.source->system),
+				json_escape(r.source->software),
+				json_escape(r.source->playback),
+				r.source->seconds,
+				r.error);
+		util::stream_format(
+				file,
+				"\"emulated_seconds\":%.6f,\"host_seconds\":%.6f,\"frames\":%u,\"frames_per_second\":%.3f,\"frame_ns_p50\":%u,\"frame_ns_p99\":%u,",
+				r.emulated_seconds,
+				r.host_seconds,
+				r.frames,
+				r.host_seconds ? (double(r.frames) / r.host_seconds) : 0.0,
+				r.frame_ns_p50,
+				r.frame_ns_p99);
+		util::stream_format(
+				file,
+				"\"peak_memory\":%u,\"frame_crc\":\"%08x\",\"audio_crc\":\"%08x\",\"devices\":[",
+				r.peak_memory,
+				r.frame_crc,
+				r.audio_crc);
+		bool firstdev = true;
+		for (device_share const &d : r.devices)
+		{
+			util::stream_format(file, "%s{\"tag\":\"%s\",\"host_seconds\":%.6f,\"share\":%.6f}", firstdev ? "" : ",", json_escape(d.tag), d.host_seconds, d.share);
+			firstdev = false;
+		}
+		file << "]}";
+		first = false;
+	}
+	file << "\n]}\n";
+	return bool(file);
+}
@@ -0,0 +1,106 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+/***************************************************************************
+
+    benchmark.h
+
+    Headless regression and performance benchmark suite.
+
+****************************************************************************
+
+    A manifest lists one run per line: the system short name followed
+    by optional key=value settings.  Blank lines and anything after a
+    # are ignored:
+
+    # system    settings
+    nes         software=smb seconds=60 playback=smb.inp
+    vsnes       seconds=30
+
+    Recognised settings are software (a software list item), playback
+    (an input recording in the input directory) and seconds (emulated
+    seconds to run, 60 if not given).
+
+    benchmark_reference.txt alongside this file is a starter manifest
+    of reference NES, Famicom, Vs. System and PlayChoice-10 systems.
+    benchmark_netlist.txt lists netlist sound systems for comparing
+    audio with and without -netlist_run_ahead.
+
+***************************************************************************/
+
+#ifndef MAME_FRONTEND_MAME_BENCHMARK_H
+#define MAME_FRONTEND_MAME_BENCHMARK_H
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> benchmark_suite
+
+class benchmark_suite
+{
+public:
+	// one line of the manifest
+	struct entry
+	{
+		std::string     system;                     // system short name
+		std::string     software;                   // software list item, or empty
+		std::string     playback;                   // input recording, or empty
+		int             seconds;                    // emulated seconds to run
+		unsigned        line;                       // manifest line number
+	};
+
+	// execution time attributed to one device
+	struct device_share
+	{
+		std::string     tag;                        // device tag
+		double          host_seconds;               // host time spent executing
+		double          share;                      // fraction of all device execution time
+	};
+
+	// outcome of running one entry
+	struct result
+	{
+		entry const *   source;                     // manifest entry
+		int             error;                      // machine exit code
+		double          host_seconds;               // host time from first frame to exit
+		double          emulated_seconds;           // emulated time at exit
+		u32             frames;                     // emulated frames after the first
+		u64             frame_ns_p50;               // host time per emulated frame
+		u64             frame_ns_p99;
+		u64             peak_memory;                // process peak resident set size so far
+		u32             frame_crc;                  // CRC of the visible area of all screens at exit
+		u32             audio_crc;                  // CRC of the whole final mix
+		std::vector<device_share> devices;
+	};
+
+	// construction/destruction
+	benchmark_suite(std::string_view manifest);
+
+	// getters
+	std::string const &manifest() const { return m_manifest; }
+	std::vector<entry> const &entries() const { return m_entries; }
+	std::vector<result> const &results() const { return m_results; }
+
+	// record results
+	void add_result(entry const &source, int error, running_machine &machine);
+	void add_failure(entry const &source, int error);
+
+	// output
+	void print_summary() const;
+	bool write(std::string_view filename) const;
+
+private:
+	// internal state
+	std::string             m_manifest;             // manifest filename
+	std::vector<entry>      m_entries;              // runs to perform
+	std::vector<result>     m_results;              // completed runs
+};
+
+#endif // MAME_FRONTEND_MAME_BENCHMARK_H
@@ -24,6 +24,7 @@
 
 #include "emuopts.h"
 #include "fileio.h"
+#include "phasetrace.h"
 #include "romload.h"
 #include "softlist_dev.h"
 #include "validity.h"
@@ -222,6 +223,7 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 	// parse the command line, adding any system-specific options
 	try
 	{
+		phase_trace_scope scope("parse command line");
 		m_options.parse_command_line(args, OPTION_PRIORITY_CMDLINE);
 	}
 	catch (options_warning_exception &ex)
@@ -252,6 +254,7 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 	// read INI's, if appropriate
 	if (m_options.read_config())
 	{
+		phase_trace_scope scope("parse INI files");
 		mame_options::parse_standard_inis(m_options, option_errors);
 		m_osd.set_verbose(m_options.verbose());
 	}
@@ -348,6 +351,11 @@ int cli_frontend::execute(std::vector<std::string> &args)
 		m_result = EMU_ERR_FATALERROR;
 	}
 
+	// write out the startup trace if requested
+	const char *const tracefile = m_options.trace_startup();
+	if (tracefile && *tracefile && !g_phase_tracer.write(tracefile))
+		osd_printf_error("Unable to write startup trace to %s\n", tracefile);
+
 	util::archive_file::cache_clear();
 	delete manager;
 
@@ -1672,6 +1680,8 @@ const cli_frontend::info_command_struct *cli_frontend::find_command(const std::s
 
 void cli_frontend::execute_commands(std::string_view exename)
 {
+	phase_trace_scope scope("cli_frontend::execute_commands");
+
 	// help?
 	if (m_options.command() == CLICOMMAND_HELP)
 	{
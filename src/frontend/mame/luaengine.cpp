@@ -22,6 +22,7 @@
 #include "drivenum.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "frametime.h"
 #include "inputdev.h"
 #include "natkeyboard.h"
 #include "screen.h"
@@ -323,6 +324,7 @@ static std::string process_snapshot_filename(running_machine &machine, const cha
 lua_engine::lua_engine()
 {
 	m_machine = nullptr;
+	m_frame_watches = std::make_unique<util::notifier<> >();
 	m_lua_state = luaL_newstate();  /* create state */
 	m_sol_state = std::make_unique<sol::state_view>(m_lua_state); // create sol view
 
@@ -426,6 +428,9 @@ std::pair<bool, std::optional<long> > lua_engine::menu_callback(const std::strin
 void lua_engine::set_machine(running_machine *machine)
 {
 	m_machine = machine;
+
+	// memory watches refer to the old machine's address spaces
+	m_frame_watches = std::make_unique<util::notifier<> >();
 }
 
 template <typename T>
@@ -507,6 +512,7 @@ void lua_engine::on_machine_resume()
 
 void lua_engine::on_machine_frame()
 {
+	(*m_frame_watches)();
 	execute_function("LUA_ON_FRAME");
 }
 
@@ -607,6 +613,8 @@ void lua_engine::initialize()
  * emu.register_resume(callback) - register callback at resume
  * emu.register_frame(callback) - register callback at end of frame
  * emu.register_frame_done(callback) - register callback after frame is drawn to screen (for overlays)
+ * emu.memory_watch(callback) - create a set of memory ranges and conditions checked at the end of each frame,
+ *                              calling callback(changes, triggered) only when something changed
  * emu.register_sound_update(callback) - register callback after sound update has generated new samples
  * emu.register_periodic(callback) - register periodic callback while program is running
  * emu.register_callback(callback, name) - register callback to be used by MAME via lua_engine::call_plugin()
@@ -692,6 +700,9 @@ void lua_engine::initialize()
 	emu["print_debug"] = [] (const char *str) { osd_printf_debug("%s\n", str); };
 	emu["osd_ticks"] = &osd_ticks;
 	emu["osd_ticks_per_second"] = &osd_ticks_per_second;
+	emu["trace_enabled"] = [] () { return osd_trace_enabled(); };
+	emu["trace_enable"] = [] (bool enable) { osd_trace_enable(enable); };
+	emu["trace_dump"] = [] (std::string const &filename, std::optional<double> seconds) { return osd_trace_write(filename, seconds ? *seconds : 0.0); };
 	emu["driver_find"] =
 		[] (sol::this_state s, const char *driver) -> sol::object
 		{
@@ -1253,6 +1264,7 @@ void lua_engine::initialize()
 	machine_type["parameters"] = sol::property(&running_machine::parameters);
 	machine_type["video"] = sol::property(&running_machine::video);
 	machine_type["sound"] = sol::property(&running_machine::sound);
+	machine_type["telemetry"] = sol::property(&running_machine::telemetry);
 	machine_type["output"] = sol::property(&running_machine::output);
 	machine_type["memory"] = sol::property(&running_machine::memory);
 	machine_type["ioport"] = sol::property(&running_machine::ioport);
@@ -1841,6 +1853,35 @@ void lua_engine::initialize()
 	sound_type["recording"] = sol::property(&sound_manager::is_recording);
 
 
+	auto telemetry_type = sol().registry().new_usertype<frame_telemetry>("telemetry", sol::no_constructor);
+	telemetry_type["stats"] =
+		[this] (frame_telemetry &t)
+		{
+			auto const make =
+					[this] (frame_telemetry::summary const &s)
+					{
+						sol::table entry = sol().create_table();
+						entry["count"] = s.count;
+						entry["p50"] = s.p50;
+						entry["p99"] = s.p99;
+						entry["max"] = s.max;
+						return entry;
+					};
+			sol::table result = sol().create_table();
+			for (unsigned cat = frame_telemetry::FRAME; frame_telemetry::CATEGORY_COUNT > cat; ++cat)
+				result[frame_telemetry::category_name(frame_telemetry::category(cat))] = make(t.stats(frame_telemetry::category(cat)));
+			sol::table devices = sol().create_table();
+			for (size_t index = 0; t.device_count() > index; ++index)
+				devices[t.device(index).tag()] = make(t.device_stats(index));
+			result["devices"] = devices;
+			return result;
+		};
+	telemetry_type["report"] = &frame_telemetry::report;
+	telemetry_type["reset"] = &frame_telemetry::reset;
+	telemetry_type["frames"] = sol::property(&frame_telemetry::frames);
+	telemetry_type["skipped_frames"] = sol::property(&frame_telemetry::skipped_frames);
+
+
 	auto ui_type = sol().registry().new_usertype<mame_ui_manager>("ui", sol::no_constructor);
 	// sol converts char32_t to a string
 	ui_type["get_char_width"] = [] (mame_ui_manager &m, uint32_t utf8char) { return m.get_char_width(utf8char); };
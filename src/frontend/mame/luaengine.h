@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include "notifier.h"
+
 #include <condition_variable>
 #include <functional>
 #include <map>
@@ -147,6 +149,7 @@ private:
 	class palette_wrapper;
 	template <typename T> class bitmap_helper;
 	class tap_helper;
+	class memory_watch;
 	class addr_space_change_notif;
 	class symbol_table_wrapper;
 	class expression_wrapper;
@@ -175,6 +178,7 @@ private:
 	running_machine *m_machine;
 
 	std::vector<std::string> m_menu;
+	std::unique_ptr<util::notifier<> > m_frame_watches;     // replaced for each machine
 
 	template <typename R, typename T, typename D>
 	auto make_simple_callback_setter(void (T::*setter)(delegate<R ()> &&), D &&dflt, const char *name, const char *desc);
@@ -520,6 +520,220 @@ void lua_engine::addr_space::direct_mem_write(offs_t address, T val)
 	}
 }
 
+//-------------------------------------------------
+//  memory_watch - class for checking memory for
+//  changes at the end of each frame without
+//  calling into Lua unless something happened
+//-------------------------------------------------
+
+class lua_engine::memory_watch
+{
+public:
+	memory_watch(memory_watch const &) = delete;
+	memory_watch(memory_watch &&) = delete;
+
+	memory_watch(lua_engine &engine, sol::protected_function &&callback)
+		: m_engine(engine)
+		, m_callback(std::move(callback))
+		, m_subscription(engine.m_frame_watches->subscribe(delegate<void ()>(&memory_watch::check, this)))
+	{
+	}
+
+	bool is_active() const noexcept { return bool(m_subscription); }
+	void remove() { m_subscription.reset(); }
+
+	size_t add_range(addr_space &sp, offs_t start, offs_t end, std::optional<int> width)
+	{
+		int const bits = width ? *width : 8;
+		if ((bits != 8) && (bits != 16) && (bits != 32) && (bits != 64))
+			luaL_error(m_engine.sol().lua_state(), "Invalid width. Must be 8/16/32/64");
+		if ((end < start) || (end > sp.space.addrmask()))
+			luaL_error(m_engine.sol().lua_state(), "Invalid offset");
+
+		range &r = m_ranges.emplace_back(range{ sp, start, end, offs_t(std::max(sp.space.byte_to_address(bits / 8), offs_t(1))), bits, std::vector<u64>() });
+		r.values.resize((end - start) / r.step + 1);
+		for (size_t i = 0; r.values.size() > i; ++i)
+			r.values[i] = read(r.space, start + offs_t(i) * r.step, bits);
+		return m_ranges.size();
+	}
+
+	size_t add_condition(addr_space &sp, offs_t address, int width, std::string const &op, u64 value)
+	{
+		static std::pair<char const *, compare_op> const s_ops[] = {
+				{ "==", compare_op::EQ }, { "~=", compare_op::NE }, { "<", compare_op::LT }, { "<=", compare_op::LE },
+				{ ">", compare_op::GT }, { ">=", compare_op::GE }, { "&", compare_op::ANY } };
+		if ((width != 8) && (width != 16) && (width != 32) && (width != 64))
+			luaL_error(m_engine.sol().lua_state(), "Invalid width. Must be 8/16/32/64");
+		auto const found = std::find_if(std::begin(s_ops), std::end(s_ops), [&op] (auto const &o) { return op == o.first; });
+		if (std::end(s_ops) == found)
+			luaL_error(m_engine.sol().lua_state(), "Invalid comparison. Must be ==, ~=, <, <=, >, >= or &");
+
+		// only a transition to true triggers, so a condition that already holds doesn't
+		condition &c = m_conditions.emplace_back(condition{ sp, address, width, found->second, value, false });
+		c.state = c.evaluate(read(c.space, address, width));
+		return m_conditions.size();
+	}
+
+	void reset()
+	{
+		for (range &r : m_ranges)
+		{
+			for (size_t i = 0; r.values.size() > i; ++i)
+				r.values[i] = read(r.space, r.start + offs_t(i) * r.step, r.width);
+		}
+		for (condition &c : m_conditions)
+			c.state = c.evaluate(read(c.space, c.address, c.width));
+	}
+
+private:
+	enum class compare_op { EQ, NE, LT, LE, GT, GE, ANY };
+
+	struct range
+	{
+		addr_space space;
+		offs_t start;
+		offs_t end;
+		offs_t step;
+		int width;
+		std::vector<u64> values;
+	};
+
+	struct condition
+	{
+		bool evaluate(u64 current) const
+		{
+			switch (op)
+			{
+			case compare_op::EQ:  return current == value;
+			case compare_op::NE:  return current != value;
+			case compare_op::LT:  return current < value;
+			case compare_op::LE:  return current <= value;
+			case compare_op::GT:  return current > value;
+			case compare_op::GE:  return current >= value;
+			case compare_op::ANY: return (current & value) != 0;
+			}
+			return false;
+		}
+
+		addr_space space;
+		offs_t address;
+		int width;
+		compare_op op;
+		u64 value;
+		bool state;
+	};
+
+	static u64 read(addr_space &sp, offs_t address, int width)
+	{
+		switch (width)
+		{
+		case 8:  return sp.mem_read<u8>(address);
+		case 16: return sp.mem_read<u16>(address);
+		case 32: return sp.mem_read<u32>(address);
+		default: return sp.mem_read<u64>(address);
+		}
+	}
+
+	template <typename T>
+	static std::string pack(std::vector<u64> const &values, size_t first, size_t last)
+	{
+		std::string result((last - first + 1) * sizeof(T), '\0');
+		for (size_t i = first; last >= i; ++i)
+		{
+			T const value = T(values[i]);
+			std::memcpy(&result[(i - first) * sizeof(T)], &value, sizeof(T));
+		}
+		return result;
+	}
+
+	void check()
+	{
+		// gather everything with side effects disabled, then make a single call into Lua
+		sol::table changes, triggered;
+		{
+			auto dis = m_engine.machine().disable_side_effects();
+			for (size_t index = 0; m_ranges.size() > index; ++index)
+			{
+				range &r = m_ranges[index];
+				size_t runstart = 0;
+				bool inrun = false;
+				for (size_t i = 0; r.values.size() >= i; ++i)
+				{
+					bool changed = false;
+					if (r.values.size() > i)
+					{
+						u64 const current = read(r.space, r.start + offs_t(i) * r.step, r.width);
+						changed = current != r.values[i];
+						r.values[i] = current;
+					}
+					if (changed && !inrun)
+					{
+						runstart = i;
+						inrun = true;
+					}
+					else if (!changed && inrun)
+					{
+						inrun = false;
+						if (!changes.valid())
+							changes = m_engine.sol().create_table();
+						sol::table change = m_engine.sol().create_table();
+						change["range"] = index + 1;
+						change["first"] = r.start + offs_t(runstart) * r.step;
+						change["last"] = r.start + offs_t(i - 1) * r.step;
+						switch (r.width)
+						{
+						case 8:  change["data"] = pack<u8>(r.values, runstart, i - 1);  break;
+						case 16: change["data"] = pack<u16>(r.values, runstart, i - 1); break;
+						case 32: change["data"] = pack<u32>(r.values, runstart, i - 1); break;
+						default: change["data"] = pack<u64>(r.values, runstart, i - 1); break;
+						}
+						changes.add(change);
+					}
+				}
+			}
+
+			for (size_t index = 0; m_conditions.size() > index; ++index)
+			{
+				condition &c = m_conditions[index];
+				u64 const current = read(c.space, c.address, c.width);
+				bool const state = c.evaluate(current);
+				if (state && !c.state)
+				{
+					if (!triggered.valid())
+						triggered = m_engine.sol().create_table();
+					sol::table trigger = m_engine.sol().create_table();
+					trigger["condition"] = index + 1;
+					trigger["address"] = c.address;
+					trigger["value"] = current;
+					triggered.add(trigger);
+				}
+				c.state = state;
+			}
+		}
+
+		if (!changes.valid() && !triggered.valid())
+			return;
+		if (!changes.valid())
+			changes = m_engine.sol().create_table();
+		if (!triggered.valid())
+			triggered = m_engine.sol().create_table();
+
+		auto result = invoke(m_callback, changes, triggered);
+		if (!result.valid())
+		{
+			sol::error err = result;
+			osd_printf_error("[LUA ERROR] in memory watch: %s\n", err.what());
+		}
+	}
+
+	lua_engine &m_engine;
+	sol::protected_function m_callback;
+	util::notifier_subscription m_subscription;
+	std::vector<range> m_ranges;
+	std::vector<condition> m_conditions;
+};
+
+
 //-------------------------------------------------
 //  initialize_memory - register memory user types
 //-------------------------------------------------
@@ -677,6 +891,20 @@ void lua_engine::initialize_memory(sol::table &emu)
 	addr_space_type["map"] = sol::property([] (addr_space &sp) { return sp.space.map(); });
 
 
+	emu["memory_watch"] =
+			[this] (sol::protected_function &&cb)
+			{
+				return std::make_unique<memory_watch>(*this, std::move(cb));
+			};
+
+	auto watch_type = sol().registry().new_usertype<memory_watch>("memory_watch", sol::no_constructor);
+	watch_type.set_function("add_range", &memory_watch::add_range);
+	watch_type.set_function("add_condition", &memory_watch::add_condition);
+	watch_type.set_function("reset", &memory_watch::reset);
+	watch_type.set_function("remove", &memory_watch::remove);
+	watch_type["is_active"] = sol::property(&memory_watch::is_active);
+
+
 	auto tap_type = sol().registry().new_usertype<tap_helper>("mempassthrough", sol::no_constructor);
 	tap_type.set_function("reinstall", &tap_helper::reinstall);
 	tap_type.set_function("remove", &tap_helper::remove);
@@ -16,12 +16,14 @@
 #include "ui/simpleselgame.h"
 #include "ui/ui.h"
 
+#include "benchmark.h"
 #include "cheat.h"
 #include "clifront.h"
 #include "emuopts.h"
 #include "fileio.h"
 #include "luaengine.h"
 #include "mameopts.h"
+#include "phasetrace.h"
 #include "pluginopts.h"
 #include "rendlay.h"
 #include "validity.h"
@@ -31,7 +33,12 @@
 
 #include "osdepend.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <ctime>
+#include <thread>
+#include <vector>
 
 
 //**************************************************************************
@@ -135,6 +142,8 @@ static std::vector<std::string> split(const std::string &text, char sep)
 
 void mame_machine_manager::start_luaengine()
 {
+	phase_trace_scope scope("Lua plugin init");
+
 	if (options().plugins())
 	{
 		// scan all plugin directories
@@ -236,6 +245,24 @@ void mame_machine_manager::start_luaengine()
 
 int mame_machine_manager::execute()
 {
+	// startup benchmarking runs the selected system repeatedly instead
+	int const bench_runs = m_options.bench_startup();
+	if (bench_runs > 0)
+	{
+		const game_driver *const system = mame_options::system(m_options);
+		if (!system)
+			throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "-%s requires a system to be specified\n", OPTION_BENCH_STARTUP);
+		return bench_startup(*system, bench_runs);
+	}
+
+	// likewise for running a benchmark suite
+	if (*m_options.bench_manifest())
+		return bench_manifest(m_options.bench_manifest());
+
+	// and for exercising the work queues on their own
+	if (m_options.bench_workqueue() > 0)
+		return bench_workqueue(m_options.bench_workqueue());
+
 	bool started_empty = false;
 
 	bool firstgame = true;
@@ -265,6 +292,7 @@ int mame_machine_manager::execute()
 			// but first, revert out any potential game-specific INI settings from previous runs via the internal UI
 			m_options.revert(OPTION_PRIORITY_INI);
 
+			phase_trace_scope scope("parse INI files");
 			std::ostringstream errors;
 			mame_options::parse_standard_inis(m_options, errors);
 		}
@@ -313,6 +341,264 @@ int mame_machine_manager::execute()
 	return error;
 }
 
+
+//-------------------------------------------------
+//  bench_startup - start a system repeatedly,
+//  running each until its first frame, and
+//  report the distribution of startup times
+//-------------------------------------------------
+
+int mame_machine_manager::bench_startup(const game_driver &system, int runs)
+{
+	std::vector<double> samples;
+	samples.reserve(runs);
+
+	int error = EMU_ERR_NONE;
+	for (int run = 0; (run < runs) && (error == EMU_ERR_NONE); run++)
+	{
+		if (m_options.read_config())
+		{
+			m_options.revert(OPTION_PRIORITY_INI);
+			std::ostringstream errors;
+			mame_options::parse_standard_inis(m_options, errors);
+		}
+
+		osd_ticks_t const start = osd_ticks();
+		{
+			machine_config config(system, m_options);
+			running_machine machine(config, *this);
+			set_machine(&machine);
+			error = machine.run(true);
+			m_firstrun = false;
+			set_machine(nullptr);
+		}
+
+		if (g_phase_tracer.first_frame())
+		{
+			osd_ticks_t const first_frame = g_phase_tracer.first_frame() - start;
+			osd_ticks_t const machine_start = g_phase_tracer.machine_start() - start;
+			samples.push_back(double(first_frame) * 1000.0 / double(osd_ticks_per_second()));
+			osd_printf_verbose("Run %d: machine started after %.3f ms, first frame after %.3f ms\n",
+					run + 1,
+					double(machine_start) * 1000.0 / double(osd_ticks_per_second()),
+					samples.back());
+		}
+		else if (error == EMU_ERR_NONE)
+		{
+			osd_printf_warning("Run %d exited before presenting a frame\n", run + 1);
+		}
+	}
+
+	if (samples.empty())
+	{
+		osd_printf_error("No startup times recorded\n");
+		return (error != EMU_ERR_NONE) ? error : EMU_ERR_FATALERROR;
+	}
+
+	// nearest-rank percentiles
+	std::sort(samples.begin(), samples.end());
+	auto const percentile =
+			[&samples] (double p)
+			{
+				size_t const rank = size_t(std::ceil(p / 100.0 * double(samples.size())));
+				return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+			};
+	double total = 0.0;
+	for (double sample : samples)
+		total += sample;
+
+	osd_printf_info("Time to first frame for %s over %d runs:\n", system.name, int(samples.size()));
+	osd_printf_info("  min  %9.3f ms\n", samples.front());
+	osd_printf_info("  mean %9.3f ms\n", total / double(samples.size()));
+	osd_printf_info("  p50  %9.3f ms\n", percentile(50.0));
+	osd_printf_info("  p90  %9.3f ms\n", percentile(90.0));
+	osd_printf_info("  p99  %9.3f ms\n", percentile(99.0));
+	osd_printf_info("  max  %9.3f ms\n", samples.back());
+	return error;
+}
+
+
+//-------------------------------------------------
+//  bench_manifest - run every entry in a
+//  benchmark manifest headless and report speed,
+//  memory use and output hashes
+//-------------------------------------------------
+
+int mame_machine_manager::bench_manifest(const char *manifest)
+{
+	benchmark_suite suite(manifest);
+
+	// keep the whole run in one telemetry window
+	m_options.set_value(OPTION_TELEMETRY_INTERVAL, 3600, OPTION_PRIORITY_MAXIMUM);
+
+	int failures = 0;
+	for (benchmark_suite::entry const &entry : suite.entries())
+	{
+		osd_printf_verbose("%s:%u: running %s for %d seconds\n", manifest, entry.line, entry.system, entry.seconds);
+
+		// start each entry from a clean set of slot and image options
+		const game_driver *system = nullptr;
+		try
+		{
+			m_options.set_system_name("");
+			m_options.set_system_name(entry.system);
+			system = mame_options::system(m_options);
+			if (!entry.software.empty())
+				m_options.set_software(std::string(entry.software));
+		}
+		catch (options_exception &ex)
+		{
+			osd_printf_error("%s:%u: %s\n", manifest, entry.line, ex.message());
+			suite.add_failure(entry, system ? EMU_ERR_INVALID_CONFIG : EMU_ERR_NO_SUCH_SYSTEM);
+			failures++;
+			continue;
+		}
+
+		if (m_options.read_config())
+		{
+			m_options.revert(OPTION_PRIORITY_INI);
+			std::ostringstream errors;
+			mame_options::parse_standard_inis(m_options, errors);
+		}
+		m_options.set_value(OPTION_PLAYBACK, entry.playback, OPTION_PRIORITY_MAXIMUM);
+		m_options.set_value(OPTION_SECONDS_TO_RUN, entry.seconds, OPTION_PRIORITY_MAXIMUM);
+
+		machine_config config(*system, m_options);
+		running_machine machine(config, *this);
+		set_machine(&machine);
+		int const error = machine.run(true);
+		m_firstrun = false;
+		suite.add_result(entry, error, machine);
+		set_machine(nullptr);
+		if (error != EMU_ERR_NONE)
+			failures++;
+	}
+
+	suite.print_summary();
+	if (*m_options.bench_results() && !suite.write(m_options.bench_results()))
+		osd_printf_error("Unable to write benchmark results to %s\n", m_options.bench_results());
+	return failures ? EMU_ERR_FATALERROR : EMU_ERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  bench_workqueue - load the work queues the way
+//  a busy system does and report throughput and
+//  how long high frequency items wait to start
+//-------------------------------------------------
+
+namespace {
+
+struct bench_work_item
+{
+	osd_ticks_t queued;         // when the item was queued
+	osd_ticks_t started;        // when a worker picked it up
+	u32 spins;                  // work to do
+	u32 result;
+};
+
+void *bench_work_callback(void *param, int threadid)
+{
+	auto &item = *reinterpret_cast<bench_work_item *>(param);
+	item.started = osd_ticks();
+	u32 x = item.spins;
+	for (u32 i = 0; i < item.spins; i++)
+		x = (x * 1103515245U) + 12345U;
+	item.result = x;
+	return nullptr;
+}
+
+void *bench_io_callback(void *param, int threadid)
+{
+	// stand in for a blocking read followed by decompression
+	osd_sleep(osd_ticks_per_second() / 2000);
+	return bench_work_callback(param, threadid);
+}
+
+} // anonymous namespace
+
+int mame_machine_manager::bench_workqueue(int seconds)
+{
+	constexpr int REALTIME_ITEMS = 16;      // items per emulated frame, like scanline bands
+	constexpr int NORMAL_ITEMS = 64;        // items per batch of ordinary work
+	constexpr int BACKGROUND_ITEMS = 8;     // reads in flight
+
+	osd_work_queue *const realtime = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	osd_work_queue *const normal = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	osd_work_queue *const background = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
+	// other threads keep the normal and background queues full
+	std::atomic<bool> stop(false);
+	std::atomic<u64> normal_done(0), background_done(0);
+	auto const feed =
+			[&stop] (osd_work_queue *queue, osd_work_callback callback, int count, u32 spins, std::atomic<u64> &done)
+			{
+				std::vector<bench_work_item> items(count);
+				while (!stop)
+				{
+					for (bench_work_item &item : items)
+						item.spins = spins;
+					osd_work_item_queue_multiple(queue, callback, count, &items[0], sizeof(items[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+					while (!osd_work_queue_wait(queue, 10 * osd_ticks_per_second())) { }
+					done += count;
+				}
+			};
+	std::thread normal_feeder(feed, normal, &bench_work_callback, NORMAL_ITEMS, 20000, std::ref(normal_done));
+	std::thread background_feeder(feed, background, &bench_io_callback, BACKGROUND_ITEMS, 5000, std::ref(background_done));
+
+	// this thread plays the emulation, queueing a frame's worth at a time
+	std::vector<bench_work_item> frame(REALTIME_ITEMS);
+	std::vector<double> latency;
+	u64 frames = 0;
+	osd_ticks_t const start = osd_ticks();
+	osd_ticks_t const end = start + (osd_ticks_per_second() * seconds);
+	osd_ticks_t now = start;
+	while (now < end)
+	{
+		for (bench_work_item &item : frame)
+		{
+			item.queued = osd_ticks();
+			item.spins = 2000;
+		}
+		osd_work_item_queue_multiple(realtime, &bench_work_callback, REALTIME_ITEMS, &frame[0], sizeof(frame[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(realtime, osd_ticks_per_second())) { }
+		for (bench_work_item const &item : frame)
+			latency.push_back(double(item.started - item.queued) * 1000000.0 / double(osd_ticks_per_second()));
+		frames++;
+
+		// leave the workers to the other queues for the rest of the "frame"
+		now = osd_ticks();
+		osd_sleep(osd_ticks_per_second() / 1000);
+	}
+	double const elapsed = double(osd_ticks() - start) / double(osd_ticks_per_second());
+
+	stop = true;
+	normal_feeder.join();
+	background_feeder.join();
+	osd_work_queue_free(background);
+	osd_work_queue_free(normal);
+	osd_work_queue_free(realtime);
+
+	// nearest-rank percentiles
+	std::sort(latency.begin(), latency.end());
+	auto const percentile =
+			[&latency] (double p)
+			{
+				size_t const rank = size_t(std::ceil(p / 100.0 * double(latency.size())));
+				return latency[std::clamp<size_t>(rank, 1, latency.size()) - 1];
+			};
+
+	osd_printf_info("Work queue contention over %.1f seconds:\n", elapsed);
+	osd_printf_info("  realtime   %10.0f frames/s\n", double(frames) / elapsed);
+	osd_printf_info("  normal     %10.0f items/s\n", double(normal_done) / elapsed);
+	osd_printf_info("  background %10.0f items/s\n", double(background_done) / elapsed);
+	osd_printf_info("Realtime item start latency:\n");
+	osd_printf_info("  p50  %9.1f us\n", percentile(50.0));
+	osd_printf_info("  p99  %9.1f us\n", percentile(99.0));
+	osd_printf_info("  max  %9.1f us\n", latency.back());
+	return EMU_ERR_NONE;
+}
+
 TIMER_CALLBACK_MEMBER(mame_machine_manager::autoboot_callback)
 {
 	if (*options().autoboot_script())
@@ -62,6 +62,9 @@ public:
 
 	/* execute as configured by the OPTION_SYSTEMNAME option on the specified options */
 	int execute();
+	int bench_startup(const game_driver &system, int runs);
+	int bench_manifest(const char *manifest);
+	int bench_workqueue(int seconds);
 	void start_luaengine();
 	void schedule_new_driver(const game_driver &driver);
 	mame_ui_manager& ui() const { assert(m_ui != nullptr); return *m_ui; }
@@ -1040,17 +1040,17 @@ float menu_select_game::draw_left_panel(float x1, float y1, float x2, float y2)
 //  get selected software and/or driver
 //-------------------------------------------------
 
-void menu_select_game::get_selection(ui_software_info const *&software, ui_system_info const *&system) const
+void menu_select_game::get_item_info(void *itemref, ui_software_info const *&software, ui_system_info const *&system) const
 {
 	if (m_populated_favorites)
 	{
-		software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+		software = reinterpret_cast<ui_software_info const *>(itemref);
 		system = software ? &m_persistent_data.systems()[driver_list::find(software->driver->name)] : nullptr;
 	}
 	else
 	{
 		software = nullptr;
-		system = reinterpret_cast<ui_system_info const *>(get_selection_ptr());
+		system = reinterpret_cast<ui_system_info const *>(itemref);
 	}
 }
 
@@ -123,37 +123,105 @@ void load_image(bitmap_argb32 &bitmap, emu_file &file, std::string const &base)
 }
 
 
-void load_driver_image(bitmap_argb32 &bitmap, emu_file &file, game_driver const &driver)
+void add_driver_image_names(std::vector<std::string> &names, game_driver const &driver)
 {
 	// try to load snapshot first from saved "0000.png" file
 	std::string fullname = driver.name;
-	load_image(bitmap, file, util::path_concat(fullname, "0000"));
+	names.emplace_back(util::path_concat(fullname, "0000"));
 
 	// if fail, attempt to load from standard file
-	if (!bitmap.valid())
-		load_image(bitmap, file, fullname);
+	names.emplace_back(fullname);
 
 	// if fail again, attempt to load from parent file
-	if (!bitmap.valid())
+	// ignore BIOS sets
+	bool isclone = strcmp(driver.parent, "0") != 0;
+	if (isclone)
 	{
-		// ignore BIOS sets
-		bool isclone = strcmp(driver.parent, "0") != 0;
-		if (isclone)
+		int const cx = driver_list::find(driver.parent);
+		if ((0 <= cx) && (driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT))
+			isclone = false;
+	}
+
+	if (isclone)
+	{
+		fullname = driver.parent;
+		names.emplace_back(util::path_concat(fullname, "0000"));
+		names.emplace_back(fullname);
+	}
+}
+
+
+bitmap_argb32 scale_art(bitmap_argb32 &&tmp_bitmap, bitmap_argb32 const &no_avail, int panel_width_pixel, int panel_height_pixel, bool force_4x3, bool enlarge)
+{
+	// a panel with no room still gets a (blank) result, or its request would never complete
+	bitmap_argb32 snapx_bitmap;
+	if ((0 >= panel_width_pixel) || (0 >= panel_height_pixel))
+	{
+		snapx_bitmap.allocate(1, 1);
+		snapx_bitmap.fill(0);
+		return snapx_bitmap;
+	}
+
+	// if it fails, use the default image
+	bool no_available = false;
+	if (!tmp_bitmap.valid())
+	{
+		tmp_bitmap.allocate(256, 256);
+		for (int x = 0; x < 256; x++)
 		{
-			int const cx = driver_list::find(driver.parent);
-			if ((0 <= cx) && (driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT))
-				isclone = false;
+			for (int y = 0; y < 256; y++)
+				tmp_bitmap.pix(y, x) = no_avail.pix(y, x);
 		}
+		no_available = true;
+	}
 
-		if (isclone)
-		{
-			fullname = driver.parent;
-			load_image(bitmap, file, util::path_concat(fullname, "0000"));
+	// Calculate resize ratios for resizing
+	auto ratioW = (float)panel_width_pixel / tmp_bitmap.width();
+	auto ratioH = (float)panel_height_pixel / tmp_bitmap.height();
+	auto ratioI = (float)tmp_bitmap.height() / tmp_bitmap.width();
+	auto dest_xPixel = tmp_bitmap.width();
+	auto dest_yPixel = tmp_bitmap.height();
 
-			if (!bitmap.valid())
-				load_image(bitmap, file, fullname);
-		}
+	// force 4:3 ratio min
+	if (force_4x3 && ratioI < 0.75f)
+	{
+		// smaller ratio will ensure that the image fits in the view
+		dest_yPixel = tmp_bitmap.width() * 0.75f;
+		ratioH = (float)panel_height_pixel / dest_yPixel;
+		float ratio = std::min(ratioW, ratioH);
+		dest_xPixel = tmp_bitmap.width() * ratio;
+		dest_yPixel *= ratio;
+	}
+	// resize the bitmap if necessary
+	else if (ratioW < 1 || ratioH < 1 || (enlarge && !no_available))
+	{
+		// smaller ratio will ensure that the image fits in the view
+		float ratio = std::min(ratioW, ratioH);
+		dest_xPixel = tmp_bitmap.width() * ratio;
+		dest_yPixel = tmp_bitmap.height() * ratio;
+	}
+
+	bitmap_argb32 dest_bitmap;
+
+	// resample if necessary
+	if (dest_xPixel != tmp_bitmap.width() || dest_yPixel != tmp_bitmap.height())
+	{
+		dest_bitmap.allocate(dest_xPixel, dest_yPixel);
+		render_color color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		render_resample_argb_bitmap_hq(dest_bitmap, tmp_bitmap, color, true);
 	}
+	else
+		dest_bitmap = std::move(tmp_bitmap);
+
+	snapx_bitmap.allocate(panel_width_pixel, panel_height_pixel);
+	int x1 = (0.5f * panel_width_pixel) - (0.5f * dest_xPixel);
+	int y1 = (0.5f * panel_height_pixel) - (0.5f * dest_yPixel);
+
+	for (int x = 0; x < dest_xPixel; x++)
+		for (int y = 0; y < dest_yPixel; y++)
+			snapx_bitmap.pix(y + y1, x + x1) = dest_bitmap.pix(y, x);
+
+	return snapx_bitmap;
 }
 
 } // anonymous namespace
@@ -398,28 +466,184 @@ void menu_select_launch::bios_selection::handle(event const *ev)
 
 
 menu_select_launch::cache::cache(running_machine &machine)
-	: m_snapx_bitmap(std::make_unique<bitmap_argb32>(0, 0))
-	, m_snapx_texture(nullptr, machine.render())
-	, m_snapx_driver(nullptr)
-	, m_snapx_software(nullptr)
+	: m_render(machine.render())
 	, m_no_avail_bitmap(256, 256)
 	, m_toolbar_bitmaps()
 	, m_toolbar_textures()
+	, m_art(MAX_ART_ENTRIES)
+	, m_art_bytes(0)
+	, m_art_exit(false)
 {
-	render_manager &render(machine.render());
-
-	// create a texture for snapshot
-	m_snapx_texture.reset(render.texture_alloc(render_texture::hq_scale));
-
 	std::memcpy(&m_no_avail_bitmap.pix(0), no_avail_bmp, 256 * 256 * sizeof(uint32_t));
 
 	m_toolbar_bitmaps.resize(UI_TOOLBAR_BUTTONS);
 	m_toolbar_textures.reserve(UI_TOOLBAR_BUTTONS);
+
+	// artwork is loaded and scaled in the background so scrolling doesn't stall
+	m_art_thread = std::thread([this] () { art_worker(); });
 }
 
 
 menu_select_launch::cache::~cache()
 {
+	{
+		std::lock_guard<std::mutex> guard(m_art_mutex);
+		m_art_queue.clear();
+		m_art_exit = true;
+	}
+	m_art_cv.notify_all();
+	m_art_thread.join();
+}
+
+
+//-------------------------------------------------
+//  find_art - get texture for artwork if it's
+//  been loaded
+//-------------------------------------------------
+
+render_texture *menu_select_launch::cache::find_art(art_key const &key)
+{
+	art_lru::iterator const found(m_art.find(key));
+	return (m_art.end() != found) ? found->second.texture.get() : nullptr;
+}
+
+
+//-------------------------------------------------
+//  drop_art - discard artwork so it will be
+//  loaded again
+//-------------------------------------------------
+
+void menu_select_launch::cache::drop_art(art_key const &key)
+{
+	art_lru::iterator const found(m_art.find(key));
+	if (m_art.end() != found)
+	{
+		m_art_bytes -= found->second.bitmap.rowbytes() * found->second.bitmap.height();
+		m_art.erase(found);
+	}
+}
+
+
+//-------------------------------------------------
+//  request_art - replace pending requests; the
+//  first request is the one being displayed and
+//  the rest are prefetched
+//-------------------------------------------------
+
+void menu_select_launch::cache::request_art(std::vector<art_request> &&requests)
+{
+	{
+		std::lock_guard<std::mutex> guard(m_art_mutex);
+		m_art_queue.clear();
+		m_art_wanted.clear();
+		for (art_request &request : requests)
+		{
+			m_art_wanted.emplace_back(request.key);
+			bool const done(std::find_if(
+					m_art_done.begin(),
+					m_art_done.end(),
+					[&request] (art_result const &result) { return result.key == request.key; }) != m_art_done.end());
+			if (!done && (m_art_busy != request.key) && (m_art.end() == m_art.find(request.key)))
+				m_art_queue.emplace_back(std::move(request));
+		}
+	}
+	m_art_cv.notify_one();
+}
+
+
+//-------------------------------------------------
+//  collect_art - create textures for artwork the
+//  loader has finished with, evicting the least
+//  recently used to stay within budget
+//-------------------------------------------------
+
+void menu_select_launch::cache::collect_art()
+{
+	std::vector<art_result> done;
+	{
+		std::lock_guard<std::mutex> guard(m_art_mutex);
+		if (m_art_done.empty())
+			return;
+		done.swap(m_art_done);
+	}
+
+	for (art_result &result : done)
+	{
+		if (m_art.end() != m_art.find(result.key))
+			continue;
+
+		std::size_t const bytes(result.bitmap.rowbytes() * result.bitmap.height());
+		while (!m_art.empty() && (((m_art_bytes + bytes) > ART_BUDGET) || (m_art.size() >= MAX_ART_ENTRIES)))
+		{
+			m_art_bytes -= m_art.begin()->second.bitmap.rowbytes() * m_art.begin()->second.bitmap.height();
+			m_art.erase(m_art.begin());
+		}
+
+		texture_and_bitmap &entry(m_art.emplace(std::move(result.key), texture_ptr(m_render.texture_alloc(render_texture::hq_scale), m_render)).first->second);
+		entry.bitmap = std::move(result.bitmap);
+		entry.texture->set_bitmap(entry.bitmap, entry.bitmap.cliprect(), TEXFORMAT_ARGB32);
+		m_art_bytes += bytes;
+	}
+}
+
+
+//-------------------------------------------------
+//  art_wanted - check whether artwork is still
+//  worth loading (call with lock held)
+//-------------------------------------------------
+
+bool menu_select_launch::cache::art_wanted(art_key const &key) const
+{
+	return std::find(m_art_wanted.begin(), m_art_wanted.end(), key) != m_art_wanted.end();
+}
+
+
+//-------------------------------------------------
+//  art_worker - background loader main loop
+//-------------------------------------------------
+
+void menu_select_launch::cache::art_worker()
+{
+	std::unique_lock<std::mutex> lock(m_art_mutex);
+	while (true)
+	{
+		m_art_cv.wait(lock, [this] () { return m_art_exit || !m_art_queue.empty(); });
+		if (m_art_exit)
+			return;
+
+		art_request request(std::move(m_art_queue.front()));
+		m_art_queue.pop_front();
+		m_art_busy = request.key;
+		lock.unlock();
+
+		// decode the first image that can be found
+		bitmap_argb32 bitmap;
+		{
+			emu_file snapfile(std::get<3>(request.key), OPEN_FLAG_READ);
+			for (std::string const &name : request.names)
+			{
+				load_image(bitmap, snapfile, name);
+				if (bitmap.valid())
+					break;
+			}
+		}
+
+		// don't bother scaling if the selection has already moved on
+		lock.lock();
+		bool const wanted(art_wanted(request.key));
+		lock.unlock();
+		if (wanted)
+			bitmap = scale_art(std::move(bitmap), m_no_avail_bitmap, std::get<4>(request.key), std::get<5>(request.key), request.force_4x3, request.enlarge);
+
+		// request_art skips the request in progress, so if the selection came back
+		// while it wasn't wanted, nothing else will ask for it again
+		lock.lock();
+		m_art_busy.reset();
+		if (wanted)
+			m_art_done.emplace_back(art_result{ std::move(request.key), std::move(bitmap) });
+		else if (art_wanted(request.key))
+			m_art_queue.emplace_front(std::move(request));
+	}
 }
 
 
@@ -503,6 +727,7 @@ menu_select_launch::menu_select_launch(mame_ui_manager &mui, render_container &c
 	, m_switch_image(false)
 	, m_default_image(true)
 	, m_image_view(FIRST_VIEW)
+	, m_art_current()
 	, m_flags(256)
 {
 	set_needs_prev_menu_item(false);
@@ -1339,18 +1564,28 @@ void menu_select_launch::get_title_search(std::string &snaptext, std::string &se
 	snaptext.assign(_("selmenu-artwork", arts_info[m_image_view].first));
 
 	// get search path
-	std::string addpath;
-	if (m_image_view == SNAPSHOT_VIEW)
+	searchstr = make_art_search_path(m_image_view);
+}
+
+
+//-------------------------------------------------
+//  get search path for an artwork view
+//-------------------------------------------------
+
+std::string menu_select_launch::make_art_search_path(uint8_t view) const
+{
+	std::string searchstr, addpath;
+	if (view == SNAPSHOT_VIEW)
 	{
 		emu_options moptions;
-		searchstr = machine().options().value(arts_info[m_image_view].second);
-		addpath = moptions.value(arts_info[m_image_view].second);
+		searchstr = machine().options().value(arts_info[view].second);
+		addpath = moptions.value(arts_info[view].second);
 	}
 	else
 	{
 		ui_options moptions;
-		searchstr = ui().options().value(arts_info[m_image_view].second);
-		addpath = moptions.value(arts_info[m_image_view].second);
+		searchstr = ui().options().value(arts_info[view].second);
+		addpath = moptions.value(arts_info[view].second);
 	}
 
 	std::string tmp(searchstr);
@@ -1365,6 +1600,8 @@ void menu_select_launch::get_title_search(std::string &snaptext, std::string &se
 		while (path_iter.next(c_path))
 			searchstr.append(";").append(curpath).append(PATH_SEPARATOR).append(c_path);
 	}
+
+	return searchstr;
 }
 
 
@@ -2294,67 +2531,121 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 
 	if (software && (!software->startempty || !system))
 	{
-		m_cache.set_snapx_driver(nullptr);
-
 		if (m_default_image)
 			m_image_view = (software->startempty == 0) ? SNAPSHOT_VIEW : CABINETS_VIEW;
+	}
+	else if (system)
+	{
+		if (m_default_image)
+			m_image_view = ((system->driver->flags & machine_flags::MASK_TYPE) != machine_flags::TYPE_ARCADE) ? CABINETS_VIEW : SNAPSHOT_VIEW;
+	}
+	else
+	{
+		return;
+	}
 
-		// arts title and searchpath
-		std::string const searchstr = arts_render_common(origx1, origy1, origx2, origy2);
-
-		// loads the image if necessary
-		if (!m_cache.snapx_software_is(software) || !snapx_valid() || m_switch_image)
-		{
-			emu_file snapfile(searchstr.c_str(), OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
+	// arts title and searchpath
+	std::string const searchstr = arts_render_common(origx1, origy1, origx2, origy2);
 
-			if (software->startempty == 1)
-			{
-				// Load driver snapshot
-				load_driver_image(tmp_bitmap, snapfile, *software->driver);
-			}
-			else
+	// work out the size of the image area in pixels
+	float const line_height = ui().get_line_height();
+	float const panel_width = origx2 - origx1 - 0.02f;
+	float const panel_height = origy2 - origy1 - 0.02f - (3.0f * ui().box_tb_border()) - (2.0f * line_height);
+	int screen_width = machine().render().ui_target().width();
+	int screen_height = machine().render().ui_target().height();
+	if (machine().render().ui_target().orientation() & ORIENTATION_SWAP_XY)
+		std::swap(screen_height, screen_width);
+	int const panel_width_pixel = panel_width * screen_width;
+	int const panel_height_pixel = panel_height * screen_height;
+
+	// pick up anything the background loader has finished
+	m_cache.collect_art();
+
+	// if the selection changed, ask for its image and prefetch its neighbours
+	cache::art_request request;
+	make_art_request(software, system, &searchstr, panel_width_pixel, panel_height_pixel, request);
+	if (m_switch_image)
+		m_cache.drop_art(request.key);
+	if (m_switch_image || !m_art_current || (*m_art_current != request.key))
+	{
+		m_switch_image = false;
+		m_art_current = request.key;
+
+		std::vector<cache::art_request> requests;
+		requests.emplace_back(std::move(request));
+		for (int const offset : { 1, -1 })
+		{
+			int const index = selected_index() + offset;
+			if ((0 <= selected_index()) && (0 <= index) && (item_count() > index) && (uintptr_t(item(index).ref()) > skip_main_items))
 			{
-				// First attempt from name list
-				load_image(tmp_bitmap, snapfile, util::path_concat(software->listname, software->shortname));
+				ui_software_info const *neighbour_software;
+				ui_system_info const *neighbour_system;
+				get_item_info(item(index).ref(), neighbour_software, neighbour_system);
 
-				// Second attempt from driver name + part name
-				if (!tmp_bitmap.valid())
-					load_image(tmp_bitmap, snapfile, util::path_concat(software->driver->name + software->part, software->shortname));
+				cache::art_request neighbour;
+				if (make_art_request(neighbour_software, neighbour_system, nullptr, panel_width_pixel, panel_height_pixel, neighbour))
+					requests.emplace_back(std::move(neighbour));
 			}
-
-			m_cache.set_snapx_software(software);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
 		}
-
-		// if the image is available, loaded and valid, display it
-		draw_snapx(origx1, origy1, origx2, origy2);
+		m_cache.request_art(std::move(requests));
 	}
-	else if (system)
-	{
-		m_cache.set_snapx_software(nullptr);
 
-		if (m_default_image)
-			m_image_view = ((system->driver->flags & machine_flags::MASK_TYPE) != machine_flags::TYPE_ARCADE) ? CABINETS_VIEW : SNAPSHOT_VIEW;
+	// display the image if it's ready
+	draw_snapx(m_cache.find_art(*m_art_current), origx1, origy1, origx2, origy2);
+}
 
-		std::string const searchstr = arts_render_common(origx1, origy1, origx2, origy2);
 
-		// loads the image if necessary
-		if (!m_cache.snapx_driver_is(system->driver) || !snapx_valid() || m_switch_image)
-		{
-			emu_file snapfile(searchstr, OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
-			load_driver_image(tmp_bitmap, snapfile, *system->driver);
+//-------------------------------------------------
+//  describe the artwork for an item so it can be
+//  loaded in the background
+//-------------------------------------------------
 
-			m_cache.set_snapx_driver(system->driver);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
+bool menu_select_launch::make_art_request(
+		ui_software_info const *software,
+		ui_system_info const *system,
+		std::string const *searchpath,
+		int width,
+		int height,
+		cache::art_request &request) const
+{
+	uint8_t view = m_image_view;
+	game_driver const *driver = nullptr;
+	request.names.clear();
+	if (software && (!software->startempty || !system))
+	{
+		if (m_default_image)
+			view = (software->startempty == 0) ? SNAPSHOT_VIEW : CABINETS_VIEW;
+
+		if (software->startempty == 1)
+		{
+			// Load driver snapshot
+			add_driver_image_names(request.names, *software->driver);
 		}
+		else
+		{
+			// First attempt from name list, then from driver name + part name
+			request.names.emplace_back(util::path_concat(software->listname, software->shortname));
+			request.names.emplace_back(util::path_concat(software->driver->name + software->part, software->shortname));
+		}
+	}
+	else if (system)
+	{
+		if (m_default_image)
+			view = ((system->driver->flags & machine_flags::MASK_TYPE) != machine_flags::TYPE_ARCADE) ? CABINETS_VIEW : SNAPSHOT_VIEW;
 
-		// if the image is available, loaded and valid, display it
-		draw_snapx(origx1, origy1, origx2, origy2);
+		software = nullptr;
+		driver = system->driver;
+		add_driver_image_names(request.names, *system->driver);
 	}
+	else
+	{
+		return false;
+	}
+
+	request.key = cache::art_key(view, driver, software, searchpath ? *searchpath : make_art_search_path(view), width, height);
+	request.force_4x3 = ui().options().forced_4x3_snapshot() && (view == SNAPSHOT_VIEW);
+	request.enlarge = ui().options().enlarge_snaps();
+	return true;
 }
 
 
@@ -2413,114 +2704,29 @@ std::string menu_select_launch::arts_render_common(float origx1, float origy1, f
 
 
 //-------------------------------------------------
-//  perform rendering of image
+//  draw snapshot
 //-------------------------------------------------
 
-void menu_select_launch::arts_render_images(bitmap_argb32 &&tmp_bitmap, float origx1, float origy1, float origx2, float origy2)
+void menu_select_launch::draw_snapx(render_texture *texture, float origx1, float origy1, float origx2, float origy2)
 {
-	bool no_available = false;
-	float line_height = ui().get_line_height();
-
-	// if it fails, use the default image
-	if (!tmp_bitmap.valid())
-	{
-		tmp_bitmap.allocate(256, 256);
-		const bitmap_argb32 &src(m_cache.no_avail_bitmap());
-		for (int x = 0; x < 256; x++)
-		{
-			for (int y = 0; y < 256; y++)
-				tmp_bitmap.pix(y, x) = src.pix(y, x);
-		}
-		no_available = true;
-	}
+	float const line_height = ui().get_line_height();
+	float const x1 = origx1 + 0.01f;
+	float const x2 = origx2 - 0.01f;
+	float const y1 = origy1 + (2.0f * ui().box_tb_border()) + line_height;
+	float const y2 = origy2 - ui().box_tb_border() - line_height;
 
-	bitmap_argb32 &snapx_bitmap(m_cache.snapx_bitmap());
-	if (tmp_bitmap.valid())
+	if (texture)
 	{
-		float panel_width = origx2 - origx1 - 0.02f;
-		float panel_height = origy2 - origy1 - 0.02f - (3.0f * ui().box_tb_border()) - (2.0f * line_height);
-		int screen_width = machine().render().ui_target().width();
-		int screen_height = machine().render().ui_target().height();
-
-		if (machine().render().ui_target().orientation() & ORIENTATION_SWAP_XY)
-			std::swap(screen_height, screen_width);
-
-		int panel_width_pixel = panel_width * screen_width;
-		int panel_height_pixel = panel_height * screen_height;
-
-		// Calculate resize ratios for resizing
-		auto ratioW = (float)panel_width_pixel / tmp_bitmap.width();
-		auto ratioH = (float)panel_height_pixel / tmp_bitmap.height();
-		auto ratioI = (float)tmp_bitmap.height() / tmp_bitmap.width();
-		auto dest_xPixel = tmp_bitmap.width();
-		auto dest_yPixel = tmp_bitmap.height();
-
-		// force 4:3 ratio min
-		if (ui().options().forced_4x3_snapshot() && ratioI < 0.75f && m_image_view == SNAPSHOT_VIEW)
-		{
-			// smaller ratio will ensure that the image fits in the view
-			dest_yPixel = tmp_bitmap.width() * 0.75f;
-			ratioH = (float)panel_height_pixel / dest_yPixel;
-			float ratio = std::min(ratioW, ratioH);
-			dest_xPixel = tmp_bitmap.width() * ratio;
-			dest_yPixel *= ratio;
-		}
-		// resize the bitmap if necessary
-		else if (ratioW < 1 || ratioH < 1 || (ui().options().enlarge_snaps() && !no_available))
-		{
-			// smaller ratio will ensure that the image fits in the view
-			float ratio = std::min(ratioW, ratioH);
-			dest_xPixel = tmp_bitmap.width() * ratio;
-			dest_yPixel = tmp_bitmap.height() * ratio;
-		}
-
-		bitmap_argb32 dest_bitmap;
-
-		// resample if necessary
-		if (dest_xPixel != tmp_bitmap.width() || dest_yPixel != tmp_bitmap.height())
-		{
-			dest_bitmap.allocate(dest_xPixel, dest_yPixel);
-			render_color color = { 1.0f, 1.0f, 1.0f, 1.0f };
-			render_resample_argb_bitmap_hq(dest_bitmap, tmp_bitmap, color, true);
-		}
-		else
-			dest_bitmap = std::move(tmp_bitmap);
-
-		snapx_bitmap.allocate(panel_width_pixel, panel_height_pixel);
-		int x1 = (0.5f * panel_width_pixel) - (0.5f * dest_xPixel);
-		int y1 = (0.5f * panel_height_pixel) - (0.5f * dest_yPixel);
-
-		for (int x = 0; x < dest_xPixel; x++)
-			for (int y = 0; y < dest_yPixel; y++)
-				snapx_bitmap.pix(y + y1, x + x1) = dest_bitmap.pix(y, x);
-
-		// apply bitmap
-		m_cache.snapx_texture()->set_bitmap(snapx_bitmap, snapx_bitmap.cliprect(), TEXFORMAT_ARGB32);
+		// if the image is available, loaded and valid, display it
+		container().add_quad(x1, y1, x2, y2, rgb_t::white(), texture, PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA));
 	}
 	else
 	{
-		snapx_bitmap.reset();
-	}
-}
-
-
-//-------------------------------------------------
-//  draw snapshot
-//-------------------------------------------------
-
-void menu_select_launch::draw_snapx(float origx1, float origy1, float origx2, float origy2)
-{
-	// if the image is available, loaded and valid, display it
-	if (snapx_valid())
-	{
-		float const line_height = ui().get_line_height();
-		float const x1 = origx1 + 0.01f;
-		float const x2 = origx2 - 0.01f;
-		float const y1 = origy1 + (2.0f * ui().box_tb_border()) + line_height;
-		float const y2 = origy2 - ui().box_tb_border() - line_height;
-
-		// apply texture
-		container().add_quad(x1, y1, x2, y2, rgb_t::white(), m_cache.snapx_texture(), PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA));
+		// otherwise show a placeholder until the loader catches up
+		ui().draw_text_full(container(),
+				_("selmenu-artwork", "Loading..."), x1, (y1 + y2 - line_height) * 0.5f, x2 - x1,
+				text_layout::text_justify::CENTER, text_layout::word_wrapping::TRUNCATE, mame_ui_manager::NORMAL, ui().colors().text_color(), ui().colors().text_bg_color(),
+				nullptr, nullptr);
 	}
 }
 
@@ -18,9 +18,14 @@
 
 #include "lrucache.h"
 
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 
@@ -161,6 +166,9 @@ protected:
 		return (uintptr_t(selected_ref) > skip_main_items) ? selected_ref : m_prev_selected;
 	}
 
+	// get selected software and/or driver
+	void get_selection(ui_software_info const *&software, ui_system_info const *&system) const { get_item_info(get_selection_ptr(), software, system); }
+
 	static std::string make_system_audit_fail_text(media_auditor const &auditor, media_auditor::summary summary);
 	static std::string make_software_audit_fail_text(media_auditor const &auditor, media_auditor::summary summary);
 	static constexpr bool audit_passed(media_auditor::summary summary)
@@ -189,16 +197,21 @@ private:
 	class cache
 	{
 	public:
+		// artwork is identified by view, selection, search path and panel size in pixels
+		using art_key = std::tuple<uint8_t, game_driver const *, ui_software_info const *, std::string, int, int>;
+
+		// a request to load and scale artwork in the background
+		struct art_request
+		{
+			art_key                     key;
+			std::vector<std::string>    names;          // base names to try in order
+			bool                        force_4x3;      // pad to 4:3 if narrower
+			bool                        enlarge;        // scale up to fill the panel
+		};
+
 		cache(running_machine &machine);
 		~cache();
 
-		bitmap_argb32 &snapx_bitmap() { return *m_snapx_bitmap; }
-		render_texture *snapx_texture() { return m_snapx_texture.get(); }
-		bool snapx_driver_is(game_driver const *value) const { return m_snapx_driver == value; }
-		bool snapx_software_is(ui_software_info const *software) const { return m_snapx_software == software; }
-		void set_snapx_driver(game_driver const *value) { m_snapx_driver = value; }
-		void set_snapx_software(ui_software_info const *software) { m_snapx_software = software; }
-
 		bitmap_argb32 &no_avail_bitmap() { return m_no_avail_bitmap; }
 
 		bitmap_vector const &toolbar_bitmaps() { return m_toolbar_bitmaps; }
@@ -206,16 +219,45 @@ private:
 
 		void cache_toolbar(running_machine &machine, float width, float height);
 
+		// artwork
+		render_texture *find_art(art_key const &key);
+		void drop_art(art_key const &key);
+		void request_art(std::vector<art_request> &&requests);
+		void collect_art();
+
 	private:
-		bitmap_ptr              m_snapx_bitmap;
-		texture_ptr             m_snapx_texture;
-		game_driver const       *m_snapx_driver;
-		ui_software_info const  *m_snapx_software;
+		static constexpr std::size_t MAX_ART_ENTRIES = 64;
+		static constexpr std::size_t ART_BUDGET = 32 * 1024 * 1024;
+
+		struct art_result
+		{
+			art_key         key;
+			bitmap_argb32   bitmap;
+		};
+
+		using art_lru = texture_lru<art_key>;
+
+		void art_worker();
+		bool art_wanted(art_key const &key) const;
+
+		render_manager          &m_render;
 
 		bitmap_argb32           m_no_avail_bitmap;
 
 		bitmap_vector           m_toolbar_bitmaps;
 		texture_ptr_vector      m_toolbar_textures;
+
+		art_lru                 m_art;                  // decoded artwork ready to draw
+		std::size_t             m_art_bytes;            // bitmap memory held by m_art
+
+		std::thread             m_art_thread;           // background loader
+		mutable std::mutex      m_art_mutex;            // protects members below
+		std::condition_variable m_art_cv;               // wakes the loader
+		std::deque<art_request> m_art_queue;            // requests not yet started
+		std::vector<art_key>    m_art_wanted;           // keys still worth finishing
+		std::vector<art_result> m_art_done;             // results not yet collected
+		std::optional<art_key>  m_art_busy;             // key being loaded
+		bool                    m_art_exit;             // tells the loader to exit
 	};
 
 	// this is to satisfy the std::any requirement that objects be copyable
@@ -234,8 +276,6 @@ private:
 	bool mouse_pressed() const { return (osd_ticks() >= m_repeat); }
 	void set_pressed();
 
-	bool snapx_valid() const { return m_cache.snapx_bitmap().valid(); }
-
 	// draw left panel
 	virtual float draw_left_panel(float x1, float y1, float x2, float y2) = 0;
 	float draw_collapsed_left_panel(float x1, float y1, float x2, float y2);
@@ -244,8 +284,8 @@ private:
 	void infos_render(float x1, float y1, float x2, float y2);
 	void general_info(ui_system_info const *system, game_driver const &driver, std::string &buffer);
 
-	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, ui_system_info const *&system) const = 0;
+	// get software and/or driver for an item
+	virtual void get_item_info(void *itemref, ui_software_info const *&software, ui_system_info const *&system) const = 0;
 	virtual bool accept_search() const { return true; }
 	void select_prev()
 	{
@@ -273,6 +313,7 @@ private:
 	virtual render_texture *get_icon_texture(int linenum, void *selectedref) = 0;
 
 	void get_title_search(std::string &title, std::string &search);
+	std::string make_art_search_path(uint8_t view) const;
 
 	// event handling
 	virtual void handle_keys(uint32_t flags, int &iptkey) override;
@@ -288,8 +329,8 @@ private:
 	// images render
 	void arts_render(float origx1, float origy1, float origx2, float origy2);
 	std::string arts_render_common(float origx1, float origy1, float origx2, float origy2);
-	void arts_render_images(bitmap_argb32 &&bitmap, float origx1, float origy1, float origx2, float origy2);
-	void draw_snapx(float origx1, float origy1, float origx2, float origy2);
+	bool make_art_request(ui_software_info const *software, ui_system_info const *system, std::string const *searchpath, int width, int height, cache::art_request &request) const;
+	void draw_snapx(render_texture *texture, float origx1, float origy1, float origx2, float origy2);
 
 	// text for main top/bottom panels
 	virtual void make_topbox_text(std::string &line0, std::string &line1, std::string &line2) const = 0;
@@ -326,6 +367,7 @@ private:
 	bool                    m_switch_image;
 	bool                    m_default_image;
 	uint8_t                 m_image_view;
+	std::optional<cache::art_key> m_art_current;    // artwork currently requested for display
 	flags_cache             m_flags;
 };
 
@@ -694,9 +694,9 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 //  get selected software and/or driver
 //-------------------------------------------------
 
-void menu_select_software::get_selection(ui_software_info const *&software, ui_system_info const *&system) const
+void menu_select_software::get_item_info(void *itemref, ui_software_info const *&software, ui_system_info const *&system) const
 {
-	software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+	software = reinterpret_cast<ui_software_info const *>(itemref);
 	system = &m_system;
 }
 
@@ -46,8 +46,8 @@ private:
 	virtual float draw_left_panel(float x1, float y1, float x2, float y2) override;
 	virtual render_texture *get_icon_texture(int linenum, void *selectedref) override;
 
-	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, ui_system_info const *&system) const override;
+	// get software and/or driver for an item
+	virtual void get_item_info(void *itemref, ui_software_info const *&software, ui_system_info const *&system) const override;
 
 	// text for main top/bottom panels
 	virtual void make_topbox_text(std::string &line0, std::string &line1, std::string &line2) const override;
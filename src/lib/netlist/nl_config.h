@@ -203,6 +203,24 @@ namespace netlist
 		using max_solver_queue_size = std::integral_constant<std::size_t,
 															 512>; // NOLINT
 
+		/// \brief Minimum work for parallel solving
+		///
+		/// Solvers due at the same time step are only distributed to the
+		/// worker pool if the floating point operations outside the largest
+		/// solver reach this value. Below this the dispatch overhead
+		/// outweighs the gain and solving stays on the calling thread.
+		///
+		using parallel_solver_min_ops = std::integral_constant<std::size_t,
+															   2000>; // NOLINT
+
+		/// \brief Spin iterations before an idle solver worker sleeps
+		///
+		/// Keeps workers responsive between consecutive time steps without
+		/// burning a core while the netlist is idle.
+		///
+		using solver_worker_spin_count = std::integral_constant<std::size_t,
+																20000>; // NOLINT
+
 		/// \brief Support float type for matrix calculations.
 		///
 		/// Defaults to NL_USE_ACADEMIC_SOLVERS to provide faster build times
@@ -13,12 +13,36 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <exception>
 #include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
 
 namespace plib {
 
+	/// \brief Tell the processor the caller is busy-waiting.
+	///
+	/// Lets a hyper-threaded sibling run and avoids the memory order
+	/// violation penalty when the loop exits.
+	///
+	inline void pspin_pause() noexcept
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		_mm_pause();
+#elif defined(__aarch64__)
+		__asm__ __volatile__("yield");
+#endif
+	}
+
 	template<bool enabled_ = true>
 	struct pspin_mutex
 	{
@@ -83,6 +107,180 @@ namespace plib {
 		long m_count;
 	};
 
+	/// \brief Persistent worker pool for short, frequent parallel batches.
+	///
+	/// Workers stay alive for the lifetime of the pool. After finishing a
+	/// batch they busy-wait for `spin_count` iterations before parking on a
+	/// condition variable, so back-to-back batches (e.g. one per netlist
+	/// time step) are dispatched with a single atomic store and no kernel
+	/// transition. The calling thread takes part in each batch.
+	///
+	/// The job descriptor (generation, item count, next item) is packed into
+	/// a single 64 bit atomic. Items are claimed by compare-exchange, so a
+	/// worker still holding a descriptor from an earlier batch can never
+	/// claim an item of the current one.
+	///
+	/// An exception thrown by an item is caught on the thread running it and
+	/// rethrown by `for_each` once the whole batch has finished. If several
+	/// items throw, the first one caught wins.
+	///
+	class pworker_pool
+	{
+	public:
+		pworker_pool(std::size_t workers, std::size_t spin_count)
+		: m_spin_count(spin_count)
+		{
+			m_threads.reserve(workers);
+			for (std::size_t i = 0; i < workers; i++)
+				m_threads.emplace_back([this]() { worker(); });
+		}
+
+		pworker_pool(const pworker_pool &) = delete;
+		pworker_pool &operator=(const pworker_pool &) = delete;
+		pworker_pool(pworker_pool &&) = delete;
+		pworker_pool &operator=(pworker_pool &&) = delete;
+
+		~pworker_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop.store(true, std::memory_order_seq_cst);
+			}
+			m_cv.notify_all();
+			for (auto &t : m_threads)
+				t.join();
+		}
+
+		/// \brief Number of threads taking part in a batch, including the caller.
+		std::size_t threads() const noexcept { return m_threads.size() + 1; }
+
+		/// \brief Call `what(i)` for i in [0, count) and wait for completion.
+		///
+		/// Items may run concurrently and in any order.
+		///
+		template <typename T>
+		void for_each(std::size_t count, T &what)
+		{
+			if (count == 0)
+				return;
+			m_func = [](void *ctx, std::size_t i) { (*static_cast<T *>(ctx))(i); };
+			m_ctx = &what;
+			m_done.store(0, std::memory_order_relaxed);
+			m_gen = (m_gen + 1) & GEN_MASK;
+			const std::uint64_t gen(m_gen);
+			// seq_cst pairs with the sleeper count in worker()
+			m_job.store(pack(gen, count, 0), std::memory_order_seq_cst);
+			if (m_sleepers.load(std::memory_order_seq_cst) > 0)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_cv.notify_all();
+			}
+
+			while (run_one()) { }
+
+			// Wait for items still running on workers. Spin briefly, then give
+			// up the core in case a worker needs it to finish.
+			for (std::size_t spins = 0; m_done.load(std::memory_order_acquire) != count; spins++)
+			{
+				if (spins < WAIT_SPIN_COUNT)
+					pspin_pause();
+				else
+					std::this_thread::yield();
+			}
+
+			if (m_error)
+			{
+				std::exception_ptr error(std::move(m_error));
+				m_error = nullptr;
+				std::rethrow_exception(error);
+			}
+		}
+
+	private:
+		static constexpr const std::uint64_t FIELD_BITS = 20;
+		static constexpr const std::uint64_t FIELD_MASK = (std::uint64_t(1) << FIELD_BITS) - 1;
+		static constexpr const std::uint64_t GEN_MASK = (std::uint64_t(1) << 24) - 1;
+		static constexpr const std::size_t WAIT_SPIN_COUNT = 1000;
+
+		static constexpr std::uint64_t pack(std::uint64_t gen, std::uint64_t count, std::uint64_t idx) noexcept
+		{
+			return (gen << (2 * FIELD_BITS)) | (count << FIELD_BITS) | idx;
+		}
+
+		static constexpr bool has_work(std::uint64_t job) noexcept
+		{
+			return (job & FIELD_MASK) < ((job >> FIELD_BITS) & FIELD_MASK);
+		}
+
+		bool run_one()
+		{
+			std::uint64_t job = m_job.load(std::memory_order_acquire);
+			while (has_work(job))
+			{
+				if (m_job.compare_exchange_weak(job, job + 1,
+					std::memory_order_acq_rel, std::memory_order_acquire))
+				{
+					// m_func and m_ctx can not change before m_done reaches count
+					try
+					{
+						m_func(m_ctx, job & FIELD_MASK);
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						if (!m_error)
+							m_error = std::current_exception();
+					}
+					m_done.fetch_add(1, std::memory_order_release);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void worker()
+		{
+			std::size_t spins = 0;
+			for (;;)
+			{
+				if (run_one())
+				{
+					spins = 0;
+					continue;
+				}
+				if (m_stop.load(std::memory_order_relaxed))
+					return;
+				if (++spins < m_spin_count)
+					continue;
+
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+				while (!m_stop.load(std::memory_order_seq_cst)
+					&& !has_work(m_job.load(std::memory_order_seq_cst)))
+					m_cv.wait(lock);
+				m_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+				spins = 0;
+			}
+		}
+
+		using func_type = void (*)(void *, std::size_t);
+
+		std::size_t              m_spin_count;
+		std::vector<std::thread> m_threads;
+		func_type                m_func = nullptr;
+		void *                   m_ctx = nullptr;
+		std::exception_ptr       m_error;        // guarded by m_mutex until the batch completes
+		std::uint64_t            m_gen = 0;
+		std::mutex               m_mutex;
+		std::condition_variable  m_cv;
+		std::atomic<bool>        m_stop = false;
+		std::atomic<std::size_t> m_sleepers = 0;
+		PALIGNAS_CACHELINE()
+		std::atomic<std::uint64_t> m_job = 0;
+		PALIGNAS_CACHELINE()
+		std::atomic<std::size_t> m_done = 0;
+	};
+
 
 } // namespace plib
 
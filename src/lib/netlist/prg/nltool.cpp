@@ -26,6 +26,7 @@
 #include <iomanip> // scanf
 #include <ios>
 #include <iostream> // scanf
+#include <thread>
 
 #ifndef NL_DISABLE_DYNAMIC_LOAD
 #define NL_DISABLE_DYNAMIC_LOAD 0
@@ -62,7 +63,7 @@ public:
 		m_errors(0),
 
 		opt_grp1(*this,     "General options",              "The following options apply to all commands."),
-		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","list-devices","list-models","static","header","doc-header","tests"}), "run|validate|convert|list-devices|list-models|static|header|doc-header|tests"),
+		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","list-devices","list-models","static","header","doc-header","tests","bench"}), "run|validate|convert|list-devices|list-models|static|header|doc-header|tests|bench"),
 		opt_includes(*this, "I", "include",                 "Add the directory to the list of directories to be searched for header files. This option may be specified repeatedly."),
 		opt_defines(*this,  "D", "define",                  "predefine value as macro, e.g. -Dname=value. If '=value' is omitted predefine it as 1. This option may be specified repeatedly."),
 		opt_data_folders(*this, "d", "data",                    "where to look for data files"),
@@ -85,7 +86,7 @@ public:
 //      opt_static_include(*this, "", "static-include",     "write static solvers to individual files\nincluded by file specified with --output.\n--dir must be path to \"generated/static\" path in netlist folder."),
 		opt_static_include(*this, "", "static-include",     "write static solvers to individual files included by file specified with --output. --dir must be path to \"generated/static\" path in netlist folder."),
 
-		opt_grp4(*this,     "Options for run command",      "These options are only used by the run command."),
+		opt_grp4(*this,     "Options for run and bench commands", "These options are only used by the run and bench commands."),
 		opt_ttr (*this,     "t", "time_to_run", 1,          "time to run the emulation (seconds)"),
 		opt_boost_lib(*this,  "",  "boost-lib", "builtin",   "generic: will use generic solvers.\nbuiltin: Use optimized solvers compiled in.\nsome_lib.so: Use library with precompiled solvers."),
 		opt_stats(*this,    "s", "statistics",              "gather runtime statistics"),
@@ -94,6 +95,7 @@ public:
 		opt_load_state(*this,"", "load-state",   "",        "load state from file and continue from there"),
 		opt_save_state(*this,"", "save-state",   "",        "save state to file at end of run"),
 		opt_fp_error(*this,  "", "fp-error",                "raise exception on floating point errors. This is intended to be used during debugging."),
+		opt_threads(*this,   "", "threads",      0,         "number of solver threads for the parallel bench run; 0 uses all hardware threads"),
 
 		opt_grp5(*this,     "Options for convert command",  "These options are only used by the convert command."),
 		opt_type(*this,     "y", "type",        0,           std::vector<pstring>({"spice","eagle","rinf"}), "type of file to be converted: spice,eagle,rinf"),
@@ -116,7 +118,9 @@ public:
 		opt_ex5(*this,     "nltool --cmd static --output src/lib/netlist/generated/static_solvers.cpp --dir src/lib/netlist/generated/static --static_include src/mame/audio/nl_*.cpp src/mame/machine/nl_*.cpp",
 				"Create static solvers for the MAME project using a single source file which includes generated solvers written to --dir folder."),
 		opt_ex6(*this,     "nltool --cmd tests",
-			"Run unit tests. In case the unit tests are not linked in, this will do nothing.")
+			"Run unit tests. In case the unit tests are not linked in, this will do nothing."),
+		opt_ex7(*this,     "nltool --cmd bench -t 5 src/mame/audio/nl_mario.cpp src/mame/audio/nl_popeye.cpp",
+			"Run each netlist for 5 seconds with serial and parallel matrix solving and compare speed and results.")
 		{}
 
 	int execute() override;
@@ -167,6 +171,7 @@ private:
 	plib::option_str    opt_load_state;
 	plib::option_str    opt_save_state;
 	plib::option_bool   opt_fp_error;
+	plib::option_num<unsigned> opt_threads;
 
 	plib::option_group  opt_grp5;
 	plib::option_str_limit<unsigned> opt_type;
@@ -182,6 +187,7 @@ private:
 	plib::option_example opt_ex4;
 	plib::option_example opt_ex5;
 	plib::option_example opt_ex6;
+	plib::option_example opt_ex7;
 
 	struct compile_map_entry
 	{
@@ -201,6 +207,9 @@ private:
 	void run_with_progress(netlist_tool_t &nt, netlist::netlist_time_ext start, netlist::netlist_time_ext duration);
 
 	void run();
+	double bench_run(const pstring &file, unsigned threads,
+		netlist::netlist_time_ext duration, std::vector<netlist::nl_fptype> &values);
+	void bench();
 	void validate();
 	void convert();
 
@@ -276,7 +285,8 @@ public:
 			const std::vector<pstring> &logs,
 			const std::vector<pstring> &defines,
 			const std::vector<pstring> &roms,
-			const std::vector<pstring> &includes)
+			const std::vector<pstring> &includes,
+			const std::vector<std::pair<pstring, pstring>> &params = {})
 	{
 		// read the netlist ...
 
@@ -293,6 +303,9 @@ public:
 
 		parser().register_source<netlist::source_file_t>(filename);
 		parser().include(name);
+		// overrides values set by the netlist
+		for (const auto & p : params)
+			parser().register_param(p.first, p.second);
 		parser().register_dynamic_log_devices(logs);
 
 		// start devices
@@ -558,6 +571,70 @@ void tool_app_t::run()
 			(duration - start).as_fp<netlist::nl_fptype>() / emulation_time * netlist::nlconst::hundred());
 }
 
+double tool_app_t::bench_run(const pstring &file, unsigned threads,
+	netlist::netlist_time_ext duration, std::vector<netlist::nl_fptype> &values)
+{
+	plib::chrono::timer<plib::chrono::system_ticks> t;
+
+	netlist_tool_t nt(plib::plog_delegate(&tool_app_t::logger, this), "netlist", opt_boost_lib());
+
+	if (!opt_verb())
+		nt.log().verbose.set_enabled(false);
+	nt.log().info.set_enabled(false);
+
+	nt.read_netlist(file, opt_name(),
+			opt_logs(),
+			m_defines, opt_data_folders(), opt_includes(),
+			{{"Solver.PARALLEL", plib::pfmt("{1}")(threads)}});
+	nt.free_setup_resources();
+	nt.exec().reset();
+
+	{
+		auto t_guard(t.guard());
+		nt.exec().process_queue(duration);
+	}
+	nt.exec().stop();
+
+	values.clear();
+	for (const auto &n : nt.nets())
+		if (n->is_analog())
+			values.push_back(plib::downcast<netlist::analog_net_t &>(*n).Q_Analog());
+
+	return t.as_seconds<double>();
+}
+
+void tool_app_t::bench()
+{
+	if (opt_files().empty())
+		throw netlist::nl_exception("nltool: bench needs at least one file");
+
+	const netlist::netlist_time_ext duration(netlist::netlist_time_ext::from_fp(opt_ttr()));
+	const unsigned threads(opt_threads() > 0 ? opt_threads()
+		: std::max(std::thread::hardware_concurrency(), 2U));
+
+	unsigned mismatches(0);
+	std_out("{1:-40} {2:9} {3:9} {4:8}  {5}\n", "netlist", "serial", "parallel", "speedup", "result");
+	for (const auto &f : opt_files())
+	{
+		if (!plib::util::exists(f))
+			throw netlist::nl_exception("nltool: file doesn't exists: {}", f);
+
+		std::vector<netlist::nl_fptype> serial_values;
+		std::vector<netlist::nl_fptype> parallel_values;
+		const double serial(bench_run(f, 0, duration, serial_values));
+		const double parallel(bench_run(f, threads, duration, parallel_values));
+
+		// parallel solving must not change a single bit of the simulation
+		std_out("{1:-40} {2:9.3f} {3:9.3f} {4:8.2f}  {5}\n",
+				plib::util::basename(f), serial, parallel, serial / parallel,
+				serial_values == parallel_values ? "identical" : "MISMATCH");
+		if (serial_values != parallel_values)
+			mismatches++;
+	}
+	if (mismatches > 0)
+		throw netlist::nl_exception("bench: {1} netlists differ between serial and parallel runs", mismatches);
+}
+
 void tool_app_t::validate()
 {
 	netlist_tool_t nt(plib::plog_delegate(&tool_app_t::logger, this), "netlist", opt_boost_lib());
@@ -1387,6 +1464,8 @@ int tool_app_t::execute()
 			list_models();
 		else if (cmd == "run")
 			run();
+		else if (cmd == "bench")
+			bench();
 		else if (cmd == "validate")
 			validate();
 		else if (cmd == "static")
@@ -26,6 +26,7 @@
 #include "plib/ptimed_queue.h"
 
 #include <algorithm>
+#include <thread>
 #include <type_traits>
 
 namespace netlist::devices
@@ -65,6 +66,7 @@ namespace netlist::devices
 
 	void NETLIB_NAME(solver)::stop()
 	{
+		m_pool.reset();
 		for (auto &s : m_mat_solvers)
 			s->log_stats();
 	}
@@ -75,16 +77,6 @@ namespace netlist::devices
 	NETLIB_HANDLER(solver, fb_step)
 	{
 		const netlist_time_ext now(exec().time());
-		const std::size_t      nthreads = m_params.m_parallel() < 2
-											  ? 1
-											  : std::min(
-											 static_cast<std::size_t>(
-												 m_params.m_parallel()),
-											 plib::omp::get_max_threads());
-		const netlist_time_ext sched(
-			now
-			+ (nthreads <= 1 ? netlist_time_ext::zero()
-							 : netlist_time_ext::from_nsec(100)));
 		plib::uninitialised_array<solver::matrix_solver_t *,
 								  config::max_solver_queue_size::value>
 			tmp; // NOLINT
@@ -92,59 +84,52 @@ namespace netlist::devices
 								  config::max_solver_queue_size::value>
 					nt; // NOLINT
 		std::size_t p = 0;
+		std::size_t ops_total = 0;
+		std::size_t ops_max = 0;
 
-		while (!m_queue.empty())
+		// Only solvers due now are collected. Pulling in solvers scheduled
+		// slightly later would give results different from a serial run.
+		while (!m_queue.empty() && m_queue.top().exec_time() <= now)
 		{
-			const auto t = m_queue.top().exec_time();
-			auto *     o = m_queue.top().object();
-			if (t != now)
-				if (t > sched)
-					break;
+			auto *o = m_queue.top().object();
 			tmp[p++] = o;
 			m_queue.pop();
+			ops_total += o->ops();
+			ops_max = std::max(ops_max, o->ops());
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease
-		// performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		// The largest solver determines the critical path. Dispatch only
+		// pays off if there is enough work to run next to it.
+		if (!KEEP_STATS && m_pool && p > 1
+			&& ops_total - ops_max >= config::parallel_solver_min_ops::value)
+		{
+			auto func = [&tmp, &nt, now](std::size_t i)
+			{ nt[i] = tmp[i]->solve(now, "parallel"); };
+			m_pool->for_each(p, func);
+		}
+		else if (!KEEP_STATS)
 		{
-			if (!KEEP_STATS)
-			{
-				for (std::size_t i = 0; i < p; i++)
-					nt[i] = tmp[i]->solve(now, "no-parallel");
-			}
-			else
-			{
-				stats()->m_stat_total_time.stop();
-				for (std::size_t i = 0; i < p; i++)
-				{
-					tmp[i]->stats()->m_stat_call_count.inc();
-					auto g(tmp[i]->stats()->m_stat_total_time.guard());
-					nt[i] = tmp[i]->solve(now, "no-parallel");
-				}
-				stats()->m_stat_total_time.start();
-			}
-
 			for (std::size_t i = 0; i < p; i++)
-			{
-				if (nt[i] != netlist_time::zero())
-					m_queue.push<false>({now + nt[i], tmp[i]});
-				tmp[i]->update_inputs();
-			}
+				nt[i] = tmp[i]->solve(now, "no-parallel");
 		}
 		else
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), p,
-								  [&tmp, &nt, now](std::size_t i)
-								  { nt[i] = tmp[i]->solve(now, "parallel"); });
+			stats()->m_stat_total_time.stop();
 			for (std::size_t i = 0; i < p; i++)
 			{
-				if (nt[i] != netlist_time::zero())
-					m_queue.push<false>({now + nt[i], tmp[i]});
-				tmp[i]->update_inputs();
+				tmp[i]->stats()->m_stat_call_count.inc();
+				auto g(tmp[i]->stats()->m_stat_total_time.guard());
+				nt[i] = tmp[i]->solve(now, "no-parallel");
 			}
+			stats()->m_stat_total_time.start();
+		}
+
+		// rescheduling and input updates stay serial and in queue order
+		for (std::size_t i = 0; i < p; i++)
+		{
+			if (nt[i] != netlist_time::zero())
+				m_queue.push<false>({now + nt[i], tmp[i]});
+			tmp[i]->update_inputs();
 		}
 		if (!m_queue.empty())
 			m_Q_step.net().toggle_and_push_to_queue(
@@ -573,6 +558,17 @@ namespace netlist::devices
 			m_mat_params.push_back(std::move(params));
 			m_mat_solvers.push_back(std::move(ms));
 		}
+
+		const std::size_t nthreads = std::min(
+			static_cast<std::size_t>(std::max(m_params.m_parallel(), 1)),
+			static_cast<std::size_t>(
+				std::max(std::thread::hardware_concurrency(), 1U)));
+		if (nthreads > 1 && m_mat_solvers.size() > 1)
+		{
+			log().verbose("Using {1} threads for solving", nthreads);
+			m_pool = std::make_unique<plib::pworker_pool>(
+				nthreads - 1, config::solver_worker_spin_count::value);
+		}
 	}
 
 	solver::static_compile_container NETLIB_NAME(solver)::create_solver_code(
@@ -0,0 +1,40 @@
+// license:BSD-3-Clause
+// copyright-holders:Couriersud
+
+///
+/// \file test_pmulti_threading.cpp
+///
+/// tests for `pworker_pool` class
+///
+
+#include "plib/ptests.h"
+
+#include "plib/pmulti_threading.h"
+
+#include <vector>
+
+PTEST(pworker_pool, all_items_once)
+{
+	plib::pworker_pool pool(3, 100);
+	PEXPECT_EQ(std::size_t(4), pool.threads());
+
+	std::vector<int> hits(100, 0);
+	auto f = [&hits](std::size_t i) { hits[i]++; };
+	for (std::size_t n = 0; n <= hits.size(); n++)
+		pool.for_each(n, f);
+
+	for (std::size_t i = 0; i < hits.size(); i++)
+		PEXPECT_EQ(int(hits.size() - i), hits[i]);
+}
+
+PTEST(pworker_pool, no_spin)
+{
+	// workers park immediately and must be woken for every batch
+	plib::pworker_pool pool(2, 0);
+	std::vector<long> v(7, 0);
+	auto f = [&v](std::size_t i) { v[i] += long(i); };
+	for (int i = 0; i < 1000; i++)
+		pool.for_each(v.size(), f);
+	for (std::size_t i = 0; i < v.size(); i++)
+		PEXPECT_EQ(long(i) * 1000, v[i]);
+}
@@ -272,6 +272,9 @@ cdrom_file::cdrom_file(chd_file *_chd)
 
 	LOG(("CD has %d tracks\n", cdtoc.numtrks));
 
+	/* streamed audio and video read sequentially, so decompress ahead of them */
+	chd->set_readahead(READAHEAD_HUNKS, READAHEAD_CACHE_HUNKS);
+
 	/* calculate the starting frame for each track, keeping in mind that CHDMAN
 	   pads tracks out with extra frames to fit 4-frame size boundries
 	*/
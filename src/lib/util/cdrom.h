@@ -30,6 +30,10 @@ public:
 
 	static constexpr uint32_t METADATA_WORDS   = 1 + MAX_TRACKS * 6;
 
+	// CHD hunks to decompress ahead of sequential reads, and to keep cached
+	static constexpr uint32_t READAHEAD_HUNKS       = 8;
+	static constexpr uint32_t READAHEAD_CACHE_HUNKS = 32;
+
 	enum
 	{
 		CD_TRACK_MODE1 = 0,         /* mode 1 2048 bytes/sector */
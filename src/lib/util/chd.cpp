@@ -21,11 +21,14 @@
 
 #include <zlib.h>
 
+#include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
 #include <ctime>
 #include <new>
+#include <unordered_map>
 
 
 //**************************************************************************
@@ -123,6 +126,84 @@ struct chd_file::metadata_hash
 };
 
 
+// ======================> readahead
+
+// hunks decompressed ahead of sequential reads on worker threads, kept
+// in a small LRU cache along with recently read hunks
+struct chd_file::readahead
+{
+	// reads must follow on from this many earlier ones before we read ahead
+	static constexpr uint32_t SEQUENTIAL_READS = 2;
+
+	enum entry_state : uint8_t
+	{
+		ENTRY_EMPTY,
+		ENTRY_PENDING,                          // waiting for a worker
+		ENTRY_READY,
+		ENTRY_FAILED
+	};
+
+	// a cached hunk
+	struct entry
+	{
+		uint32_t                hunknum = ~uint32_t(0);
+		entry_state             state = ENTRY_EMPTY;
+		bool                    used = false;   // read since it was prefetched?
+		uint64_t                lastuse = 0;    // clock at last use, for LRU
+		std::vector<uint8_t>    data;
+	};
+
+	// decompression state for a worker thread
+	struct worker
+	{
+		chd_decompressor::ptr   decompressor[4];    // array of decompression codecs
+		std::vector<uint8_t>    compressed;         // temporary buffer for compressed data
+		std::vector<uint8_t>    parentdata;         // buffer for coalesced parent reads
+	};
+
+	// work for a worker: one hunk, or a run of hunks coming from
+	// consecutive data in the parent, read with a single parent access
+	struct job
+	{
+		readahead *             owner;
+		uint32_t                first;          // first hunk
+		bool                    parent;         // read from the parent?
+		uint64_t                parentoffset;   // where in the parent
+		std::vector<unsigned>   slots;          // cache entries to fill
+	};
+
+	readahead(chd_file &chd, uint32_t hunks, uint32_t cachehunks);
+	~readahead();
+
+	bool read(uint32_t hunknum, uint8_t *dest);
+	void insert(uint32_t hunknum, const uint8_t *source);
+	void advance(uint32_t hunknum);
+	void invalidate(uint32_t hunknum);
+
+	int claim(uint32_t hunknum);
+	void run(job &work, int threadid);
+	static void *job_callback(void *param, int threadid);
+
+	chd_file &              m_chd;
+	uint32_t                m_hunks;            // how far ahead to read
+	osd_work_queue *        m_queue;            // queue for the workers
+	mutable std::mutex      m_lock;             // protects entry states and statistics
+	std::condition_variable m_ready;            // signalled when workers finish
+	std::vector<entry>      m_entries;
+	std::unordered_map<uint32_t, unsigned> m_index; // hunk number to entry
+	uint64_t                m_clock;            // LRU clock
+	uint32_t                m_last;             // last hunk read
+	uint32_t                m_sequential;       // reads in a row following on from the last
+	uint32_t                m_ahead;            // last hunk read ahead
+	std::unique_ptr<worker> m_workers[WORK_MAX_THREADS];
+	readahead_stats         m_stats;
+
+	static thread_local bool s_in_worker;       // is this thread running a job?
+};
+
+thread_local bool chd_file::readahead::s_in_worker = false;
+
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -194,6 +275,7 @@ inline void chd_file::file_read(uint64_t offset, void *dest, uint32_t length)
 		throw std::error_condition(error::NOT_OPEN);
 
 	// seek and read
+	std::lock_guard<std::mutex> lock(m_file_lock);
 	m_file->seek(offset, SEEK_SET);
 	size_t count;
 	std::error_condition err = m_file->read(dest, length, count);
@@ -216,6 +298,7 @@ inline void chd_file::file_write(uint64_t offset, const void *source, uint32_t l
 		throw std::error_condition(error::NOT_OPEN);
 
 	// seek and write
+	std::lock_guard<std::mutex> lock(m_file_lock);
 	m_file->seek(offset, SEEK_SET);
 	size_t count;
 	std::error_condition err = m_file->write(source, length, count);
@@ -241,6 +324,7 @@ inline uint64_t chd_file::file_append(const void *source, uint32_t length, uint3
 		throw std::error_condition(error::NOT_OPEN);
 
 	// seek to the end and align if necessary
+	std::lock_guard<std::mutex> lock(m_file_lock);
 	err = m_file->seek(0, SEEK_END);
 	if (err)
 		throw err;
@@ -303,6 +387,318 @@ inline uint8_t chd_file::bits_for_value(uint64_t value)
 //  CHD FILE MANAGEMENT
 //**************************************************************************
 
+//**************************************************************************
+//  READ-AHEAD
+//**************************************************************************
+
+//-------------------------------------------------
+//  readahead - constructor
+//-------------------------------------------------
+
+chd_file::readahead::readahead(chd_file &chd, uint32_t hunks, uint32_t cachehunks)
+	: m_chd(chd)
+	, m_hunks(hunks)
+	, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO | WORK_QUEUE_FLAG_MULTI))
+	, m_entries(cachehunks)
+	, m_clock(0)
+	, m_last(~uint32_t(0))
+	, m_sequential(0)
+	, m_ahead(0)
+	, m_stats{ 0, 0, 0, 0, 0, 0 }
+{
+	for (entry &cached : m_entries)
+		cached.data.resize(chd.hunk_bytes());
+	m_index.reserve(cachehunks);
+}
+
+
+//-------------------------------------------------
+//  ~readahead - destructor
+//-------------------------------------------------
+
+chd_file::readahead::~readahead()
+{
+	// let the workers finish before their buffers go away
+	osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  read - copy a hunk out of the cache if it's
+//  there, waiting for a worker if necessary
+//-------------------------------------------------
+
+bool chd_file::readahead::read(uint32_t hunknum, uint8_t *dest)
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+	auto const found = m_index.find(hunknum);
+	if (found == m_index.end())
+	{
+		m_stats.misses++;
+		return false;
+	}
+
+	entry &cached = m_entries[found->second];
+	if (cached.state == ENTRY_PENDING)
+	{
+		// a worker waiting here could be waiting for itself
+		if (s_in_worker)
+		{
+			m_stats.misses++;
+			return false;
+		}
+		m_stats.waits++;
+		m_ready.wait(lock, [&cached] () { return cached.state != ENTRY_PENDING; });
+	}
+
+	// on failure, let the caller read it again to get the error
+	if (cached.state != ENTRY_READY)
+	{
+		cached.state = ENTRY_EMPTY;
+		m_index.erase(found);
+		m_stats.misses++;
+		return false;
+	}
+
+	memcpy(dest, &cached.data[0], cached.data.size());
+	cached.used = true;
+	cached.lastuse = ++m_clock;
+	m_stats.hits++;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  insert - keep a hunk read on the calling
+//  thread in case it's wanted again
+//-------------------------------------------------
+
+void chd_file::readahead::insert(uint32_t hunknum, const uint8_t *source)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	if (m_index.find(hunknum) != m_index.end())
+		return;
+
+	int const slot = claim(hunknum);
+	if (slot < 0)
+		return;
+
+	entry &cached = m_entries[slot];
+	memcpy(&cached.data[0], source, cached.data.size());
+	cached.state = ENTRY_READY;
+	cached.used = true;
+}
+
+
+//-------------------------------------------------
+//  advance - note a hunk has been read, and get
+//  workers started on the hunks after it if
+//  reads are sequential
+//-------------------------------------------------
+
+void chd_file::readahead::advance(uint32_t hunknum)
+{
+	// only read ahead of reads that follow on from each other
+	if (hunknum == m_last + 1)
+		m_sequential++;
+	else if (hunknum != m_last)
+		m_sequential = 0;
+	m_last = hunknum;
+	if (m_sequential < SEQUENTIAL_READS)
+	{
+		m_ahead = hunknum;
+		return;
+	}
+
+	// top the window up once it's half used, so runs are long enough to coalesce
+	if (m_ahead > hunknum && (m_ahead - hunknum) > (m_hunks / 2))
+		return;
+	uint32_t const end = std::min<uint64_t>(uint64_t(hunknum) + m_hunks + 1, m_chd.hunk_count());
+	std::vector<job *> jobs;
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		job *work = nullptr;
+		for (uint32_t ahead = std::max(hunknum, m_ahead) + 1; ahead < end; ahead++)
+		{
+			if (m_index.find(ahead) != m_index.end())
+			{
+				m_ahead = ahead;
+				if (work)
+					jobs.push_back(std::exchange(work, nullptr));
+				continue;
+			}
+
+			// hunks from consecutive parent data go to the same worker
+			uint64_t parentoffset;
+			bool const parent = m_chd.hunk_parent_offset(ahead, parentoffset);
+			if (work && !(parent && (parentoffset == work->parentoffset + (uint64_t(work->slots.size()) * m_chd.hunk_bytes()))))
+				jobs.push_back(std::exchange(work, nullptr));
+
+			int const slot = claim(ahead);
+			if (slot < 0)
+				break;
+			m_ahead = ahead;
+			m_entries[slot].state = ENTRY_PENDING;
+			m_entries[slot].used = false;
+
+			if (!work)
+				work = new job{ this, ahead, parent, parentoffset, { } };
+			work->slots.push_back(slot);
+			if (!parent)
+				jobs.push_back(std::exchange(work, nullptr));
+		}
+		if (work)
+			jobs.push_back(work);
+	}
+
+	// queue outside the lock, as the queue may run jobs right away
+	for (job *work : jobs)
+		osd_work_item_queue(m_queue, &job_callback, work, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  invalidate - drop a hunk about to be written,
+//  after letting the workers finish
+//-------------------------------------------------
+
+void chd_file::readahead::invalidate(uint32_t hunknum)
+{
+	while (!osd_work_queue_wait(m_queue, 10 * osd_ticks_per_second())) { }
+
+	std::lock_guard<std::mutex> lock(m_lock);
+	auto const found = m_index.find(hunknum);
+	if (found != m_index.end())
+	{
+		m_entries[found->second].state = ENTRY_EMPTY;
+		m_index.erase(found);
+	}
+}
+
+
+//-------------------------------------------------
+//  claim - find the least recently used entry
+//  that isn't busy or about to be read, and
+//  assign it to a hunk; called with the lock held
+//-------------------------------------------------
+
+int chd_file::readahead::claim(uint32_t hunknum)
+{
+	int best = -1;
+	for (unsigned slot = 0; slot < m_entries.size(); slot++)
+	{
+		entry const &cached = m_entries[slot];
+		if (cached.state == ENTRY_EMPTY || cached.state == ENTRY_FAILED)
+		{
+			best = slot;
+			break;
+		}
+		if (cached.state == ENTRY_PENDING)
+			continue;
+		if (!cached.used && (cached.hunknum > m_last) && (cached.hunknum <= (m_last + m_hunks)))
+			continue;
+		if (best < 0 || cached.lastuse < m_entries[best].lastuse)
+			best = slot;
+	}
+	if (best < 0)
+		return -1;
+
+	entry &cached = m_entries[best];
+	if (cached.state != ENTRY_EMPTY)
+	{
+		if (cached.state == ENTRY_READY && !cached.used)
+			m_stats.wasted++;
+		m_index.erase(cached.hunknum);
+	}
+	cached.hunknum = hunknum;
+	cached.state = ENTRY_EMPTY;
+	cached.lastuse = ++m_clock;
+	m_index.emplace(hunknum, best);
+	return best;
+}
+
+
+//-------------------------------------------------
+//  run - decompress or fetch the hunks for a job
+//  on a worker thread
+//-------------------------------------------------
+
+void chd_file::readahead::run(job &work, int threadid)
+{
+	assert(threadid < std::size(m_workers));
+
+	// each worker needs its own codecs
+	std::unique_ptr<worker> &state = m_workers[threadid];
+	std::error_condition err;
+	try
+	{
+		if (!state)
+		{
+			state = std::make_unique<worker>();
+			for (int decompnum = 0; decompnum < std::size(state->decompressor); decompnum++)
+				state->decompressor[decompnum] = chd_codec_list::new_decompressor(m_chd.m_compression[decompnum], m_chd);
+			state->compressed.resize(m_chd.hunk_bytes());
+		}
+	}
+	catch (std::error_condition const &codecerr)
+	{
+		state.reset();
+		err = codecerr;
+	}
+	catch (std::bad_alloc const &)
+	{
+		state.reset();
+		err = std::errc::not_enough_memory;
+	}
+
+	uint32_t const hunkbytes = m_chd.hunk_bytes();
+	uint32_t const count = work.slots.size();
+	if (!err && work.parent)
+	{
+		// one parent access for the whole run
+		state->parentdata.resize(size_t(count) * hunkbytes);
+		{
+			std::lock_guard<std::mutex> parentlock(m_chd.m_parent_lock);
+			err = m_chd.m_parent->read_bytes(work.parentoffset, &state->parentdata[0], count * hunkbytes);
+		}
+		if (!err)
+		{
+			for (uint32_t index = 0; index < count; index++)
+				memcpy(&m_entries[work.slots[index]].data[0], &state->parentdata[size_t(index) * hunkbytes], hunkbytes);
+		}
+	}
+	else if (!err)
+	{
+		err = m_chd.read_hunk_direct(work.first, &m_entries[work.slots[0]].data[0], state->decompressor, state->compressed);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		for (unsigned slot : work.slots)
+			m_entries[slot].state = err ? ENTRY_FAILED : ENTRY_READY;
+		if (!err)
+			m_stats.prefetched += count;
+		if (work.parent)
+			m_stats.parentreads++;
+	}
+	m_ready.notify_all();
+}
+
+
+//-------------------------------------------------
+//  job_callback - work queue callback for a job
+//-------------------------------------------------
+
+void *chd_file::readahead::job_callback(void *param, int threadid)
+{
+	std::unique_ptr<job> work(reinterpret_cast<job *>(param));
+	s_in_worker = true;
+	work->owner->run(*work, threadid);
+	s_in_worker = false;
+	return nullptr;
+}
+
+
 /**
  * @fn  chd_file::chd_file()
  *
@@ -830,6 +1226,9 @@ std::error_condition chd_file::open(util::random_read_write::ptr &&file, bool wr
 
 void chd_file::close()
 {
+	// stop reading ahead before anything goes away
+	m_readahead.reset();
+
 	// reset file characteristics
 	m_file.reset();
 	m_allow_reads = false;
@@ -893,6 +1292,43 @@ void chd_file::close()
  */
 
 std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
+{
+	auto *dest = reinterpret_cast<uint8_t *>(buffer);
+
+	// without read-ahead, or for codecs writing elsewhere, just decompress
+	if (!m_readahead || dest == nullptr || !m_file || hunknum >= m_hunkcount)
+		return read_hunk_direct(hunknum, dest, m_decompressor, m_compressed);
+
+	// use the cached copy if we have one; otherwise read it now and keep it
+	std::error_condition err;
+	if (!m_readahead->read(hunknum, dest))
+	{
+		err = read_hunk_direct(hunknum, dest, m_decompressor, m_compressed);
+		if (err)
+			return err;
+		m_readahead->insert(hunknum, dest);
+	}
+	m_readahead->advance(hunknum);
+	return err;
+}
+
+/**
+ * @fn  std::error_condition chd_file::read_hunk_direct(uint32_t hunknum, uint8_t *dest, chd_decompressor::ptr (&decompressor)[4], std::vector<uint8_t> &compbuf)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunk_direct - read a single hunk from the CHD file, bypassing the cache, using
+ *            the given codecs
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum             The hunknum.
+ * @param [in,out]  dest        If non-null, the buffer.
+ * @param [in,out]  decompressor    The codecs to use.
+ * @param [in,out]  compbuf     Temporary buffer for compressed data.
+ *
+ * @return  A std::error_condition.
+ */
+
+std::error_condition chd_file::read_hunk_direct(uint32_t hunknum, uint8_t *dest, chd_decompressor::ptr (&decompressor)[4], std::vector<uint8_t> &compbuf)
 {
 	// wrap this for clean reporting
 	try
@@ -910,7 +1346,6 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 		uint32_t blocklen;
 		util::crc32_t blockcrc;
 		uint8_t *rawmap;
-		auto *dest = reinterpret_cast<uint8_t *>(buffer);
 		switch (m_version)
 		{
 			// v3/v4 map entries
@@ -923,8 +1358,8 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 				{
 					case V34_MAP_ENTRY_TYPE_COMPRESSED:
 						blocklen = be_read(&rawmap[12], 2) + (rawmap[14] << 16);
-						file_read(blockoffs, &m_compressed[0], blocklen);
-						m_decompressor[0]->decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
+						file_read(blockoffs, &compbuf[0], blocklen);
+						decompressor[0]->decompress(&compbuf[0], blocklen, dest, m_hunkbytes);
 						if (!(rawmap[15] & V34_MAP_ENTRY_FLAG_NO_CRC) && dest != nullptr && util::crc32_creator::simple(dest, m_hunkbytes) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
 						return std::error_condition();
@@ -944,12 +1379,15 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case V34_MAP_ENTRY_TYPE_SELF_HUNK:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_direct(blockoffs, dest, decompressor, compbuf);
 
 					case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
+					{
 						if (m_parent_missing)
 							throw std::error_condition(error::REQUIRES_PARENT);
+						std::lock_guard<std::mutex> parentlock(m_parent_lock);
 						return m_parent->read_hunk(blockoffs, dest);
+					}
 				}
 				break;
 
@@ -966,7 +1404,10 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					else if (m_parent_missing)
 						throw std::error_condition(error::REQUIRES_PARENT);
 					else if (m_parent != nullptr)
+					{
+						std::lock_guard<std::mutex> parentlock(m_parent_lock);
 						m_parent->read_hunk(hunknum, dest);
+					}
 					else
 						memset(dest, 0, m_hunkbytes);
 					return std::error_condition();
@@ -982,11 +1423,11 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					case COMPRESSION_TYPE_1:
 					case COMPRESSION_TYPE_2:
 					case COMPRESSION_TYPE_3:
-						file_read(blockoffs, &m_compressed[0], blocklen);
-						m_decompressor[rawmap[0]]->decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
-						if (!m_decompressor[rawmap[0]]->lossy() && dest != nullptr && util::crc16_creator::simple(dest, m_hunkbytes) != blockcrc)
+						file_read(blockoffs, &compbuf[0], blocklen);
+						decompressor[rawmap[0]]->decompress(&compbuf[0], blocklen, dest, m_hunkbytes);
+						if (!decompressor[rawmap[0]]->lossy() && dest != nullptr && util::crc16_creator::simple(dest, m_hunkbytes) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
-						if (m_decompressor[rawmap[0]]->lossy() && util::crc16_creator::simple(&m_compressed[0], blocklen) != blockcrc)
+						if (decompressor[rawmap[0]]->lossy() && util::crc16_creator::simple(&compbuf[0], blocklen) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
 						return std::error_condition();
 
@@ -997,12 +1438,15 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case COMPRESSION_SELF:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_direct(blockoffs, dest, decompressor, compbuf);
 
 					case COMPRESSION_PARENT:
+					{
 						if (m_parent_missing)
 							throw std::error_condition(error::REQUIRES_PARENT);
+						std::lock_guard<std::mutex> parentlock(m_parent_lock);
 						return m_parent->read_bytes(uint64_t(blockoffs) * uint64_t(m_parent->unit_bytes()), dest, m_hunkbytes);
+					}
 				}
 				break;
 		}
@@ -1017,6 +1461,56 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 	}
 }
 
+/**
+ * @fn  bool chd_file::hunk_parent_offset(uint32_t hunknum, uint64_t &offset)
+ *
+ * @brief   -------------------------------------------------
+ *            hunk_parent_offset - find where in the parent a hunk's data comes from, if it's a
+ *            straight copy of a hunk's worth of parent data
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [out] offset      Byte offset in the parent.
+ *
+ * @return  true if the hunk comes from the parent.
+ */
+
+bool chd_file::hunk_parent_offset(uint32_t hunknum, uint64_t &offset)
+{
+	offset = 0;
+	if (m_parent == nullptr || m_parent_missing)
+		return false;
+
+	uint8_t const *rawmap;
+	switch (m_version)
+	{
+		// v3/v4 map entries
+		case 3:
+		case 4:
+			rawmap = &m_rawmap[16 * hunknum];
+			if ((rawmap[15] & V34_MAP_ENTRY_FLAG_TYPE_MASK) != V34_MAP_ENTRY_TYPE_PARENT_HUNK || m_parent->hunk_bytes() != m_hunkbytes)
+				return false;
+			offset = be_read(&rawmap[0], 8) * m_hunkbytes;
+			return true;
+
+		// v5 map entries
+		case 5:
+			rawmap = &m_rawmap[m_mapentrybytes * hunknum];
+			if (!compressed())
+			{
+				if (be_read(rawmap, 4) != 0 || m_parent->hunk_bytes() != m_hunkbytes)
+					return false;
+				offset = uint64_t(hunknum) * m_hunkbytes;
+				return true;
+			}
+			if (rawmap[0] != COMPRESSION_PARENT)
+				return false;
+			offset = be_read(&rawmap[4], 6) * m_parent->unit_bytes();
+			return true;
+	}
+	return false;
+}
+
 /**
  * @fn  std::error_condition chd_file::write_hunk(uint32_t hunknum, const void *buffer)
  *
@@ -1057,6 +1551,10 @@ std::error_condition chd_file::write_hunk(uint32_t hunknum, const void *buffer)
 		if (compressed())
 			throw std::error_condition(error::FILE_NOT_WRITEABLE);
 
+		// don't let read-ahead keep stale data or read the map as it changes
+		if (m_readahead)
+			m_readahead->invalidate(hunknum);
+
 		// see if we have allocated the space on disk for this hunk
 		uint8_t *rawmap = &m_rawmap[hunknum * 4];
 		uint32_t rawentry = be_read(rawmap, 4);
@@ -1655,6 +2153,67 @@ std::error_condition chd_file::codec_configure(chd_codec_type codec, int param,
 	}
 }
 
+/**
+ * @fn  std::error_condition chd_file::set_readahead(uint32_t hunks, uint32_t cachehunks)
+ *
+ * @brief   -------------------------------------------------
+ *            set_readahead - start or stop decompressing hunks ahead of sequential reads on
+ *            worker threads
+ *          -------------------------------------------------.
+ *
+ * @param   hunks       How many hunks to read ahead, or 0 to stop.
+ * @param   cachehunks  How many hunks to keep, at least twice hunks.
+ *
+ * @return  A std::error_condition.
+ */
+
+std::error_condition chd_file::set_readahead(uint32_t hunks, uint32_t cachehunks)
+{
+	// punt if no file
+	if (!m_file)
+		return error::NOT_OPEN;
+
+	// stop what's running first
+	m_readahead.reset();
+	if (hunks == 0)
+		return std::error_condition();
+
+	// A/V codecs are configured for each read, which workers can't see
+	for (chd_codec_type codec : m_compression)
+		if (codec == CHD_CODEC_AVHUFF)
+			return error::UNSUPPORTED_FORMAT;
+
+	try
+	{
+		hunks = std::min(hunks, m_hunkcount);
+		m_readahead = std::make_unique<readahead>(*this, hunks, std::max(cachehunks, hunks * 2));
+	}
+	catch (std::bad_alloc const &)
+	{
+		return std::errc::not_enough_memory;
+	}
+	return std::error_condition();
+}
+
+/**
+ * @fn  chd_file::readahead_stats chd_file::readahead_statistics() const
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_statistics - return how well read-ahead is doing
+ *          -------------------------------------------------.
+ *
+ * @return  The statistics, all zero if read-ahead is off.
+ */
+
+chd_file::readahead_stats chd_file::readahead_statistics() const
+{
+	if (!m_readahead)
+		return readahead_stats{ 0, 0, 0, 0, 0, 0 };
+
+	std::lock_guard<std::mutex> lock(m_readahead->m_lock);
+	return m_readahead->m_stats;
+}
+
 /**
  * @fn  const char *chd_file::error_string(chd_error err)
  *
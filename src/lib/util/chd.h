@@ -19,9 +19,12 @@
 #include "osdcore.h"
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <vector>
 
 
 /***************************************************************************
@@ -289,6 +292,17 @@ public:
 		COMPRESSING
 	};
 
+	// read-ahead statistics
+	struct readahead_stats
+	{
+		uint64_t hits;          // hunk reads satisfied from the cache
+		uint64_t waits;         // hits that had to wait for a worker to finish
+		uint64_t misses;        // hunk reads decompressed on the calling thread
+		uint64_t prefetched;    // hunks decompressed ahead of time by workers
+		uint64_t wasted;        // prefetched hunks evicted without being read
+		uint64_t parentreads;   // parent reads, each covering one or more hunks
+	};
+
 	// construction/destruction
 	chd_file();
 	virtual ~chd_file();
@@ -352,9 +366,14 @@ public:
 	// codec interfaces
 	std::error_condition codec_configure(chd_codec_type codec, int param, void *config);
 
+	// read-ahead; hunks is how far ahead of sequential reads to decompress, 0 to turn it off
+	std::error_condition set_readahead(uint32_t hunks, uint32_t cachehunks);
+	readahead_stats readahead_statistics() const;
+
 private:
 	struct metadata_entry;
 	struct metadata_hash;
+	struct readahead;
 
 	// inline helpers
 	uint64_t be_read(const uint8_t *base, int numbytes);
@@ -380,6 +399,8 @@ private:
 	void hunk_write_compressed(uint32_t hunknum, int8_t compression, const uint8_t *compressed, uint32_t complength, util::crc16_t crc16);
 	void hunk_copy_from_self(uint32_t hunknum, uint32_t otherhunk);
 	void hunk_copy_from_parent(uint32_t hunknum, uint64_t parentunit);
+	std::error_condition read_hunk_direct(uint32_t hunknum, uint8_t *dest, chd_decompressor::ptr (&decompressor)[4], std::vector<uint8_t> &compbuf);
+	bool hunk_parent_offset(uint32_t hunknum, uint64_t &offset);
 	bool metadata_find(chd_metadata_tag metatag, int32_t metaindex, metadata_entry &metaentry, bool resume = false);
 	void metadata_set_previous_next(uint64_t prevoffset, uint64_t nextoffset);
 	void metadata_update_hash();
@@ -387,6 +408,7 @@ private:
 
 	// file characteristics
 	util::random_read_write::ptr m_file;        // handle to the open core file
+	std::mutex              m_file_lock;        // serializes file access with read-ahead workers
 	bool                    m_allow_reads;      // permit reads from this CHD?
 	bool                    m_allow_writes;     // permit writes to this CHD?
 
@@ -402,6 +424,7 @@ private:
 	chd_codec_type          m_compression[4];   // array of compression types used
 	chd_file *              m_parent;           // pointer to parent file, or nullptr if none
 	bool                    m_parent_missing;   // are we missing our parent?
+	std::mutex              m_parent_lock;      // serializes parent access with read-ahead workers
 
 	// key offsets within the header
 	uint64_t                m_mapoffset_offset; // offset of map offset field
@@ -421,6 +444,7 @@ private:
 	// caching
 	std::vector<uint8_t>    m_cache;            // single-hunk cache for partial reads/writes
 	uint32_t                m_cachehunk;        // which hunk is in the cache?
+	std::unique_ptr<readahead> m_readahead;     // read-ahead workers and hunk cache
 };
 
 
@@ -66,6 +66,8 @@ public:
 	virtual int vprintf(util::format_argument_pack<std::ostream> const &args) override { return m_file.vprintf(args); }
 	virtual std::error_condition truncate(std::uint64_t offset) override { return m_file.truncate(offset); }
 
+	virtual std::error_condition map(std::uint64_t offset, std::size_t length, std::shared_ptr<std::uint8_t> &data) noexcept override { return m_file.map(offset, length, data); }
+
 private:
 	core_file &m_file;
 };
@@ -227,6 +229,8 @@ public:
 
 	virtual std::error_condition truncate(std::uint64_t offset) override;
 
+	virtual std::error_condition map(std::uint64_t offset, std::size_t length, std::shared_ptr<std::uint8_t> &data) noexcept override;
+
 protected:
 	bool is_buffered(std::uint64_t offset) const noexcept { return (offset >= m_bufferbase) && (offset < (m_bufferbase + m_bufferbytes)); }
 
@@ -830,6 +834,24 @@ std::error_condition core_osd_file::truncate(std::uint64_t offset)
 }
 
 
+//-------------------------------------------------
+//  map - map part of the file into memory
+//-------------------------------------------------
+
+std::error_condition core_osd_file::map(std::uint64_t offset, std::size_t length, std::shared_ptr<std::uint8_t> &data) noexcept
+{
+	// don't hand out a view that could disagree with later writes
+	if (!m_file)
+		return std::errc::bad_file_descriptor;
+	if (write_access())
+		return std::errc::not_supported;
+	if ((offset > size()) || (length > (size() - offset)))
+		return std::errc::invalid_argument;
+
+	return m_file->map(offset, length, data);
+}
+
+
 //-------------------------------------------------
 //  flush - flush file buffers
 //-------------------------------------------------
@@ -962,6 +984,17 @@ core_file::~core_file()
 }
 
 
+//-------------------------------------------------
+//  map - map part of the file into memory; not
+//  supported unless overridden
+//-------------------------------------------------
+
+std::error_condition core_file::map(std::uint64_t offset, std::size_t length, std::shared_ptr<std::uint8_t> &data) noexcept
+{
+	return std::errc::not_supported;
+}
+
+
 //-------------------------------------------------
 //  load - open a file with the specified
 //  filename, read it into memory, and return a
@@ -95,6 +95,12 @@ public:
 
 	// file truncation
 	virtual std::error_condition truncate(std::uint64_t offset) = 0;
+
+
+	// ----- memory mapping -----
+
+	// map part of the file read-only with copy-on-write pages (not supported by all file types)
+	virtual std::error_condition map(std::uint64_t offset, std::size_t length, std::shared_ptr<std::uint8_t> &data) noexcept;
 };
 
 } // namespace util
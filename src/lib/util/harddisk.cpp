@@ -41,6 +41,9 @@ hard_disk_file::hard_disk_file(chd_file *_chd)
 	/* parse the metadata */
 	if (sscanf(metadata.c_str(), HARD_DISK_METADATA_FORMAT, &hdinfo.cylinders, &hdinfo.heads, &hdinfo.sectors, &hdinfo.sectorbytes) != 4)
 		throw nullptr;
+
+	/* decompress ahead of sequential reads such as loading files */
+	chd->set_readahead(READAHEAD_HUNKS, READAHEAD_CACHE_HUNKS);
 }
 
 hard_disk_file::hard_disk_file(util::random_read_write &corefile, uint32_t skipoffs)
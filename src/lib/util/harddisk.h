@@ -46,6 +46,10 @@ public:
 	std::error_condition get_disk_key_data(std::vector<uint8_t> &data) const;
 
 private:
+	// CHD hunks to decompress ahead of sequential reads, and to keep cached
+	static constexpr uint32_t READAHEAD_HUNKS = 16;
+	static constexpr uint32_t READAHEAD_CACHE_HUNKS = 64;
+
 	chd_file *                  chd;        // CHD file
 	util::random_read_write *   fhandle;    // file if not a CHD
 	info                        hdinfo;     // hard disk info
@@ -273,6 +273,9 @@ public:
 
 	virtual std::error_condition decompress(void *buffer, std::size_t length) noexcept override { return m_impl->decompress(buffer, length); }
 
+	// solid archives never keep a member contiguous and uncompressed
+	virtual std::error_condition map(std::shared_ptr<std::uint8_t> &data) noexcept override { return archive_file::error::UNSUPPORTED; }
+
 private:
 	m7z_file_impl::ptr m_impl;
 };
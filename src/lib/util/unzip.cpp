@@ -219,6 +219,7 @@ public:
 	std::uint32_t current_crc() const noexcept { return m_header.crc; }
 
 	std::error_condition decompress(void *buffer, std::size_t length) noexcept;
+	std::error_condition map(std::shared_ptr<std::uint8_t> &data) noexcept;
 
 private:
 	zip_file_impl(const zip_file_impl &) = delete;
@@ -376,6 +377,7 @@ public:
 	virtual std::uint32_t current_crc() const noexcept override { return m_impl->current_crc(); }
 
 	virtual std::error_condition decompress(void *buffer, std::size_t length) noexcept override { return m_impl->decompress(buffer, length); }
+	virtual std::error_condition map(std::shared_ptr<std::uint8_t> &data) noexcept override { return m_impl->map(data); }
 
 private:
 	zip_file_impl::ptr m_impl;
@@ -952,6 +954,52 @@ std::error_condition zip_file_impl::decompress(void *buffer, std::size_t length)
 
 
 
+/*-------------------------------------------------
+    map - map a stored file from a ZIP directly
+    into memory
+-------------------------------------------------*/
+
+std::error_condition zip_file_impl::map(std::shared_ptr<std::uint8_t> &data) noexcept
+{
+	// only stored files with no data descriptor funny business can be mapped
+	if (m_header.compression != 0)
+		return archive_file::error::UNSUPPORTED;
+	if (m_header.compressed_length != m_header.uncompressed_length)
+	{
+		osd_printf_error("unzip: %s in %s has inconsistent stored length\n", m_header.file_name, m_filename);
+		return archive_file::error::FILE_CORRUPT;
+	}
+	if (!m_header.uncompressed_length || (std::size_t(m_header.uncompressed_length) != m_header.uncompressed_length))
+		return archive_file::error::UNSUPPORTED;
+
+	// we need a path to get a mappable handle
+	if (m_filename.empty())
+		return archive_file::error::UNSUPPORTED;
+
+	// get the data offset (this also validates the local header)
+	std::uint64_t offset;
+	auto const ziperr = get_compressed_data_offset(offset);
+	if (ziperr)
+		return ziperr;
+	if ((offset > m_length) || (m_header.uncompressed_length > (m_length - offset)))
+	{
+		osd_printf_error(
+				"unzip: unexpectedly reached end-of-file while mapping %s from %s\n",
+				m_header.file_name, m_filename);
+		return archive_file::error::FILE_TRUNCATED;
+	}
+
+	// open a separate handle - the mapping outlives it
+	osd_file::ptr file;
+	std::uint64_t filesize;
+	auto const filerr = osd_file::open(m_filename, OPEN_FLAG_READ, file, filesize);
+	if (filerr)
+		return filerr;
+	return file->map(offset, std::size_t(m_header.uncompressed_length), data);
+}
+
+
+
 /***************************************************************************
     ZIP FILE PARSING
 ***************************************************************************/
@@ -85,6 +85,9 @@ public:
 
 	// decompress the most recently found file in the ZIP
 	virtual std::error_condition decompress(void *buffer, std::size_t length) noexcept = 0;
+
+	// map the most recently found file into memory if it's stored without compression
+	virtual std::error_condition map(std::shared_ptr<std::uint8_t> &data) noexcept = 0;
 };
 
 
@@ -53,6 +53,9 @@ void nes_state::nes(machine_config &config)
 	// basic machine hardware
 	rp2a03_device &maincpu(RP2A03G(config, m_maincpu, NTSC_APU_CLOCK));
 	maincpu.set_addrmap(AS_PROGRAM, &nes_state::nes_map);
+	// games spin on RAM or the PPU status until the vblank NMI, which the PPU only raises from its scanline timer
+	maincpu.add_idle_read_range(0x0000, 0x07ff, 0x1800);
+	maincpu.add_idle_read_range(0x2002, 0x2002, 0x1ff8);
 
 	SCREEN(config, m_screen, SCREEN_TYPE_RASTER);
 	m_screen->set_refresh_hz(60.0988);
@@ -128,6 +131,8 @@ void nes_state::famicomo(machine_config &config)
 	// basic machine hardware
 	rp2a03_device &maincpu(RP2A03(config.replace(), m_maincpu, NTSC_APU_CLOCK));
 	maincpu.set_addrmap(AS_PROGRAM, &nes_state::nes_map);
+	maincpu.add_idle_read_range(0x0000, 0x07ff, 0x1800);
+	maincpu.add_idle_read_range(0x2002, 0x2002, 0x1ff8);
 
 	// sound hardware
 	maincpu.add_route(ALL_OUTPUTS, "mono", 0.90);
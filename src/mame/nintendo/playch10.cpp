@@ -1908,6 +1908,8 @@ void playch10_state::playch10(machine_config &config)
 
 	RP2A03G(config, m_cartcpu, NTSC_APU_CLOCK); // really RP2A03E
 	m_cartcpu->set_addrmap(AS_PROGRAM, &playch10_state::cart_map);
+	m_cartcpu->add_idle_read_range(0x0000, 0x07ff, 0x1800);
+	m_cartcpu->add_idle_read_range(0x2002, 0x2002, 0x1ff8);
 
 	ls259_device &outlatch1(LS259(config, "outlatch1")); // 7D
 	outlatch1.q_out_cb<0>().set(FUNC(playch10_state::sdcs_w));
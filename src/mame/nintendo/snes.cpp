@@ -47,6 +47,7 @@ public:
 			, m_ctrl1(*this, "ctrl1")
 			, m_ctrl2(*this, "ctrl2")
 			, m_cartslot(*this, "snsslot")
+			, m_options(*this, "OPTIONS")
 	{ }
 
 	void snespal(machine_config &config);
@@ -105,6 +106,8 @@ private:
 	required_device<snes_control_port_device> m_ctrl1;
 	required_device<snes_control_port_device> m_ctrl2;
 	optional_device<sns_cart_slot_device> m_cartslot;
+	required_ioport m_options;
+	bool m_apu_mode_chosen = false;
 
 	void snes_map(address_map &map);
 	void spc_map(address_map &map);
@@ -1023,6 +1026,9 @@ static INPUT_PORTS_START( snes )
 	PORT_CONFNAME( 0x01, 0x00, "Hi-Res pixels blurring (TV effect)")
 	PORT_CONFSETTING(    0x00, DEF_STR( Off ) )
 	PORT_CONFSETTING(    0x01, DEF_STR( On ) )
+	PORT_CONFNAME( 0x02, 0x00, "APU synchronization (requires hard reset)")
+	PORT_CONFSETTING(    0x00, "Every instruction (reference)" )
+	PORT_CONFSETTING(    0x02, "On port access (faster)" )
 
 #if SNES_LAYER_DEBUG
 	PORT_START("DEBUG1")
@@ -1324,6 +1330,17 @@ void snes_console_state::machine_start()
 void snes_console_state::machine_reset()
 {
 	snes_state::machine_reset();
+
+	// the S-CPU and S-SMP run in lockstep unless the faster mode is selected, where they
+	// only interleave closely around APU port accesses; S-CPU reads of the ports can then
+	// see the S-SMP up to a timeslice late, so it isn't the default
+	if (!m_apu_mode_chosen)
+	{
+		m_apu_sync_on_access = BIT(m_options->read(), 1);
+		if (!m_apu_sync_on_access)
+			machine().scheduler().perfect_quantum(attotime::never);
+		m_apu_mode_chosen = true;
+	}
 }
 
 
@@ -1340,7 +1357,6 @@ void snes_console_state::snes(machine_config &config)
 	m_soundcpu->dsp_io_write_callback().set(m_s_dsp, FUNC(s_dsp_device::dsp_io_w));
 
 	//config.set_maximum_quantum(attotime::from_hz(48000));
-	config.set_perfect_quantum(m_maincpu);
 
 	INPUT_MERGER_ANY_HIGH(config, m_scpu_irq);
 	m_scpu_irq->output_handler().set_inputline(m_maincpu, G65816_LINE_IRQ);
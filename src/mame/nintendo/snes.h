@@ -369,6 +369,7 @@ protected:
 	uint8_t                 m_dma_regs[0x80]{};
 	uint8_t                 m_cpu_regs[0x20]{};
 	uint8_t                 m_oldjoy1_latch = 0;
+	bool                    m_apu_sync_on_access = false;   // S-CPU and S-SMP only interleave closely around port traffic
 
 	/* input-related */
 	uint16_t                m_data1[4]{};   // JOY1/JOY2 + 3rd & 4th only used by multitap (hacky support)
@@ -425,6 +426,7 @@ protected:
 	TIMER_CALLBACK_MEMBER(snes_reset_oam_address);
 	TIMER_CALLBACK_MEMBER(snes_reset_hdma);
 	TIMER_CALLBACK_MEMBER(snes_update_io);
+	TIMER_CALLBACK_MEMBER(spc_port_in_sync);
 	TIMER_CALLBACK_MEMBER(snes_scanline_tick);
 	TIMER_CALLBACK_MEMBER(snes_hblank_tick);
 	DECLARE_WRITE_LINE_MEMBER(snes_extern_irq_w);
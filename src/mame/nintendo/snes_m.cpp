@@ -34,6 +34,10 @@ uint32_t snes_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap,
 	for (int y = cliprect.min_y; y <= cliprect.max_y; y++)
 		m_ppu->refresh_scanline(bitmap, y + 1);
 
+	/* the PPU composes lines in the background; they must be done before the frame is shown */
+	if (cliprect.max_y >= screen.visible_area().max_y)
+		m_ppu->flush_scanlines();
+
 	return 0;
 }
 
@@ -84,6 +88,12 @@ TIMER_CALLBACK_MEMBER(snes_state::snes_reset_hdma)
 	hdma_init(cpu0space);
 }
 
+// the S-SMP lags the S-CPU, so a write takes effect once it has caught up
+TIMER_CALLBACK_MEMBER(snes_state::spc_port_in_sync)
+{
+	m_soundcpu->spc_port_in_w(param >> 8, param & 0xff);
+}
+
 TIMER_CALLBACK_MEMBER(snes_state::snes_update_io)
 {
 	io_read();
@@ -356,6 +366,14 @@ uint8_t snes_state::snes_r_io(offs_t offset)
 	// APU is mirrored from 2140 to 217f
 	if (offset >= APU00 && offset < WMDATA)
 	{
+		// without lockstep the S-SMP runs behind the S-CPU, and this read sees it where it
+		// stood at the end of the last timeslice; end the timeslice here so it catches up
+		// before the next instruction, and keep the two in step while they talk
+		if (m_apu_sync_on_access && !machine().side_effects_disabled())
+		{
+			machine().scheduler().synchronize();
+			machine().scheduler().perfect_quantum(attotime::from_usec(20));
+		}
 		return m_soundcpu->spc_port_out_r(offset & 0x3);
 	}
 
@@ -451,7 +469,10 @@ void snes_state::snes_w_io(address_space &space, offs_t offset, uint8_t data)
 	if (offset >= APU00 && offset < WMDATA)
 	{
 //      printf("816: %02x to APU @ %d (PC=%06x)\n", data, offset & 3,m_maincpu->pc());
-		m_soundcpu->spc_port_in_w(offset & 0x3, data);
+		if (m_apu_sync_on_access)
+			machine().scheduler().synchronize(timer_expired_delegate(FUNC(snes_state::spc_port_in_sync), this), ((offset & 0x3) << 8) | data);
+		else
+			m_soundcpu->spc_port_in_w(offset & 0x3, data);
 		machine().scheduler().perfect_quantum(attotime::from_usec(20));
 		return;
 	}
@@ -2424,6 +2424,8 @@ void vs_uni_state::vsnes(machine_config &config)
 	// basic machine hardware
 	rp2a03_device &maincpu(RP2A03(config, m_maincpu, NTSC_APU_CLOCK));
 	maincpu.set_addrmap(AS_PROGRAM, &vs_uni_state::vsnes_cpu1_map);
+	maincpu.add_idle_read_range(0x0000, 0x07ff, 0x1800);
+	maincpu.add_idle_read_range(0x2002, 0x2002, 0x1ff8);
 
 	NVRAM(config, "nvram", nvram_device::DEFAULT_ALL_0);
 
@@ -2494,9 +2496,13 @@ void vs_dual_state::vsdual(machine_config &config)
 	// basic machine hardware
 	rp2a03_device &maincpu(RP2A03(config, m_maincpu, NTSC_APU_CLOCK));
 	maincpu.set_addrmap(AS_PROGRAM, &vs_dual_state::vsnes_cpu1_map);
+	maincpu.add_idle_read_range(0x0000, 0x07ff, 0x1800);
+	maincpu.add_idle_read_range(0x2002, 0x2002, 0x1ff8);
 
 	rp2a03_device &subcpu(RP2A03(config, m_subcpu, NTSC_APU_CLOCK));
 	subcpu.set_addrmap(AS_PROGRAM, &vs_dual_state::vsnes_cpu2_map);
+	subcpu.add_idle_read_range(0x0000, 0x07ff, 0x1800);
+	subcpu.add_idle_read_range(0x2002, 0x2002, 0x1ff8);
 
 	// need high level of interleave to keep screens in sync in Balloon Fight.
 	config.set_perfect_quantum(m_maincpu);
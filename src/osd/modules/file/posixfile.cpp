@@ -61,6 +61,12 @@
 #include <cstdlib>
 #include <unistd.h>
 
+#if defined(_WIN32)
+#include <io.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <sys/mman.h>
+#endif
+
 
 
 namespace {
@@ -160,6 +166,57 @@ public:
 		return std::error_condition();
 	}
 
+	virtual std::error_condition sync() noexcept override
+	{
+#if defined(_WIN32)
+		if (::_commit(m_fd) < 0)
+#else
+		if (::fsync(m_fd) < 0)
+#endif
+			return std::error_condition(errno, std::generic_category());
+		return std::error_condition();
+	}
+
+	virtual std::error_condition map(std::uint64_t offset, std::size_t length, std::shared_ptr<std::uint8_t> &data) noexcept override
+	{
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+		return std::errc::not_supported;
+#else
+		if (!length)
+			return std::errc::invalid_argument;
+
+		// mappings must start on a page boundary
+		long const pagesize = ::sysconf(_SC_PAGESIZE);
+		std::uint64_t const pagemask = (pagesize > 0) ? std::uint64_t(pagesize - 1) : 0U;
+		std::uint64_t const base = offset & ~pagemask;
+		std::size_t const slop = std::size_t(offset - base);
+		std::size_t const maplength = length + slop;
+
+		// private writable mapping so drivers that patch their ROMs get copy-on-write pages
+#if defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__bsdi__) || defined(__DragonFly__) || defined(SDLMAME_NO64BITIO) || defined(__ANDROID__)
+		void *const mapping = ::mmap(nullptr, maplength, PROT_READ | PROT_WRITE, MAP_PRIVATE, m_fd, off_t(std::make_unsigned_t<off_t>(base)));
+#else
+		void *const mapping = ::mmap64(nullptr, maplength, PROT_READ | PROT_WRITE, MAP_PRIVATE, m_fd, off64_t(base));
+#endif
+		if (MAP_FAILED == mapping)
+			return std::error_condition(errno, std::generic_category());
+
+		try
+		{
+			std::shared_ptr<std::uint8_t> owner(
+					reinterpret_cast<std::uint8_t *>(mapping),
+					[maplength] (std::uint8_t *p) { ::munmap(p, maplength); });
+			data = std::shared_ptr<std::uint8_t>(owner, owner.get() + slop);
+		}
+		catch (...)
+		{
+			// the deleter has already been invoked if the control block couldn't be allocated
+			return std::errc::not_enough_memory;
+		}
+		return std::error_condition();
+#endif
+	}
+
 private:
 	int m_fd;
 };
@@ -116,6 +116,14 @@ public:
 			return std::error_condition(errno, std::generic_category());
 	}
 
+	virtual std::error_condition sync() noexcept override
+	{
+		if (std::fflush(m_file) || (::fsync(fileno(m_file)) < 0))
+			return std::error_condition(errno, std::generic_category());
+		else
+			return std::error_condition();
+	}
+
 private:
 	FILE *m_file;
 };
@@ -111,6 +111,13 @@ public:
 		return std::error_condition();
 	}
 
+	virtual std::error_condition sync() noexcept override
+	{
+		if (!FlushFileBuffers(m_handle))
+			return win_error_to_error_condition(GetLastError());
+		return std::error_condition();
+	}
+
 private:
 	HANDLE m_handle;
 };
@@ -20,6 +20,7 @@
 
 #include <dlfcn.h>
 #include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/sysctl.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -223,6 +224,19 @@ int osd_getpid()
 	return getpid();
 }
 
+//============================================================
+//  osd_peak_memory_usage
+//============================================================
+
+uint64_t osd_peak_memory_usage()
+{
+	// Darwin reports bytes rather than kilobytes
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0;
+	return uint64_t(usage.ru_maxrss);
+}
+
 
 namespace osd {
 
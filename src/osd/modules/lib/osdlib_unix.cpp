@@ -22,6 +22,7 @@
 
 #include <dlfcn.h>
 #include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -140,6 +141,18 @@ int osd_getpid()
 	return getpid();
 }
 
+//============================================================
+//  osd_peak_memory_usage
+//============================================================
+
+uint64_t osd_peak_memory_usage()
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0;
+	return uint64_t(usage.ru_maxrss) * 1024;
+}
+
 
 namespace osd {
 
@@ -23,6 +23,7 @@
 
 #include <windows.h>
 #include <memoryapi.h>
+#include <psapi.h>
 
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -258,6 +259,18 @@ int osd_getpid()
 	return GetCurrentProcessId();
 }
 
+//============================================================
+//  osd_peak_memory_usage
+//============================================================
+
+uint64_t osd_peak_memory_usage()
+{
+	PROCESS_MEMORY_COUNTERS counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		return 0;
+	return counters.PeakWorkingSetSize;
+}
+
 //============================================================
 //  osd_dynamic_bind
 //============================================================
@@ -107,6 +107,14 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_FILTER ";glfilter;flt",       "1",              core_options::option_type::BOOLEAN,   "use bilinear filtering when scaling emulated video" },
 	{ OSDOPTION_PRESCALE "(1-8)",             "1",              core_options::option_type::INTEGER,   "scale emulated video by this factor before applying filters/shaders" },
 
+	{ nullptr,                                nullptr,          core_options::option_type::HEADER,    "OSD SOFTWARE CRT OPTIONS" },
+	{ OSDOPTION_SWCRT_SCANLINE "(0.0-1.0)",   "0.0",            core_options::option_type::FLOAT,     "darken the gaps between emulated scanlines by this amount (software renderers)" },
+	{ OSDOPTION_SWCRT_MASK "(0.0-1.0)",       "0.0",            core_options::option_type::FLOAT,     "strength of the aperture grille mask (software renderers)" },
+	{ OSDOPTION_SWCRT_BLOOM "(0.0-1.0)",      "0.0",            core_options::option_type::FLOAT,     "let bright pixels bleed into scanline gaps and the mask by this amount (software renderers)" },
+	{ OSDOPTION_SWCRT_NTSC,                   "0",              core_options::option_type::BOOLEAN,   "simulate a composite NTSC signal on emulated screens (software renderers)" },
+	{ OSDOPTION_SWCRT_BUDGET,                 "8.0",            core_options::option_type::FLOAT,     "milliseconds per frame the software CRT filters may take before they are dropped, 0 for no limit" },
+	{ OSDOPTION_SWCRT_BENCHMARK,              "0",              core_options::option_type::BOOLEAN,   "time each software CRT filter on the running screen after a few seconds and report the results" },
+
 #if USE_OPENGL
 	{ nullptr,                                nullptr,          core_options::option_type::HEADER,    "OpenGL-SPECIFIC OPTIONS" },
 	{ OSDOPTION_GL_FORCEPOW2TEXTURE,          "0",              core_options::option_type::BOOLEAN,   "force power-of-two texture sizes (default no)" },
@@ -56,6 +56,13 @@
 #define OSDOPTION_FILTER                "filter"
 #define OSDOPTION_PRESCALE              "prescale"
 
+#define OSDOPTION_SWCRT_SCANLINE        "swcrt_scanline"
+#define OSDOPTION_SWCRT_MASK            "swcrt_mask"
+#define OSDOPTION_SWCRT_BLOOM           "swcrt_bloom"
+#define OSDOPTION_SWCRT_NTSC            "swcrt_ntsc"
+#define OSDOPTION_SWCRT_BUDGET          "swcrt_budget"
+#define OSDOPTION_SWCRT_BENCHMARK       "swcrt_benchmark"
+
 #define OSDOPTION_SHADER_MAME           "glsl_shader_mame"
 #define OSDOPTION_SHADER_SCREEN         "glsl_shader_screen"
 #define OSDOPTION_GLSL_FILTER           "gl_glsl_filter"
@@ -135,6 +142,14 @@ public:
 	bool filter() const { return bool_value(OSDOPTION_FILTER); }
 	int prescale() const { return int_value(OSDOPTION_PRESCALE); }
 
+	// software CRT options
+	float swcrt_scanline() const { return float_value(OSDOPTION_SWCRT_SCANLINE); }
+	float swcrt_mask() const { return float_value(OSDOPTION_SWCRT_MASK); }
+	float swcrt_bloom() const { return float_value(OSDOPTION_SWCRT_BLOOM); }
+	bool swcrt_ntsc() const { return bool_value(OSDOPTION_SWCRT_NTSC); }
+	float swcrt_budget() const { return float_value(OSDOPTION_SWCRT_BUDGET); }
+	bool swcrt_benchmark() const { return bool_value(OSDOPTION_SWCRT_BENCHMARK); }
+
 	// OpenGL specific options
 	bool gl_force_pow2_texture() const { return bool_value(OSDOPTION_GL_FORCEPOW2TEXTURE); }
 	bool gl_no_texture_rect() const { return bool_value(OSDOPTION_GL_NOTEXTURERECT); }
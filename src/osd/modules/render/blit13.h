@@ -125,7 +125,8 @@ struct blit_base
 	{ }
 	virtual ~blit_base() { }
 
-	virtual void texop(const texture_info *texture, const render_texinfo *texsource) const = 0;
+	// convert texture rows top..bottom into texture->m_pixels, starting at its first row
+	virtual void texop(const texture_info *texture, const render_texinfo *texsource, int top, int bottom) const = 0;
 	int m_dest_bpp;
 	bool m_is_rot;
 	bool m_is_passthrough;
@@ -135,13 +136,13 @@ template<typename _src_type, typename _dest_type, typename _op, int _len_div>
 struct blit_texcopy : public blit_base
 {
 	blit_texcopy() : blit_base(sizeof(_dest_type) / _len_div, false, false) { }
-	void texop(const texture_info *texture, const render_texinfo *texsource) const override
+	void texop(const texture_info *texture, const render_texinfo *texsource, int top, int bottom) const override
 	{
 		const rgb_t *palbase = texsource->palette;
 		/* loop over Y */
-		for (int y = 0; y < texsource->height; y++) {
+		for (int y = top; y <= bottom; y++) {
 			_src_type *src = (_src_type *)texsource->base + y * texsource->rowpixels / (_len_div);
-			_dest_type *dst = (_dest_type *)((uint8_t *)texture->m_pixels + y * texture->m_pitch);
+			_dest_type *dst = (_dest_type *)((uint8_t *)texture->m_pixels + (y - top) * texture->m_pitch);
 			int x = texsource->width / (_len_div);
 			while (x > 0) {
 				*dst++ = m_op.op(*src, palbase);
@@ -161,17 +162,17 @@ template<typename _src_type, typename _dest_type, typename _op>
 struct blit_texrot : public blit_base
 {
 	blit_texrot() : blit_base(sizeof(_dest_type), true, false) { }
-	void texop(const texture_info *texture, const render_texinfo *texsource) const override
+	void texop(const texture_info *texture, const render_texinfo *texsource, int top, int bottom) const override
 	{
 		const rgb_t *palbase = texsource->palette;
 		const quad_setup_data *setup = &texture->m_setup;
 		int dudx = setup->dudx;
 		int dvdx = setup->dvdx;
 		/* loop over Y */
-		for (int y = 0; y < setup->rotheight; y++) {
+		for (int y = top; y <= bottom; y++) {
 			int32_t curu = setup->startu + y * setup->dudy;
 			int32_t curv = setup->startv + y * setup->dvdy;
-			_dest_type *dst = (_dest_type *)((uint8_t *)texture->m_pixels + y * texture->m_pitch);
+			_dest_type *dst = (_dest_type *)((uint8_t *)texture->m_pixels + (y - top) * texture->m_pitch);
 			int x = setup->rotwidth;
 			while (x>0) {
 				_src_type *src = (_src_type *) texsource->base + (curv >> 16) * texsource->rowpixels + (curu >> 16);
@@ -193,7 +194,7 @@ template<typename _src_type, typename _dest_type>
 struct blit_texpass : public blit_base
 {
 	blit_texpass() : blit_base(sizeof(_dest_type), false, true) { }
-	void texop(const texture_info *texture, const render_texinfo *texsource) const override
+	void texop(const texture_info *texture, const render_texinfo *texsource, int top, int bottom) const override
 	{
 	}
 };
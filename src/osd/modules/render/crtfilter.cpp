@@ -0,0 +1,731 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+//============================================================
+//
+//  crtfilter.cpp - CPU CRT post-processing for software renderers
+//
+//  The composite stage works on emulated screen textures at
+//  their native resolution: each row is encoded as an NTSC
+//  signal sampled four times per colour subcarrier cycle and
+//  decoded again, which turns fine luma detail into artifact
+//  colour the way a composite monitor does.
+//
+//  The scanline, aperture grille and bloom stages share one
+//  pass over the finished frame, limited to the area covered
+//  by each screen.  Every byte is scaled by a per-column
+//  multiplier (mask, and scanlines on rotated screens) and a
+//  per-row one (scanlines), with bloom adding back light from
+//  bright pixels in proportion to how much was taken away.
+//
+//============================================================
+
+#include "emu.h"
+#include "crtfilter.h"
+
+#include "modules/lib/osdobj_common.h"
+
+#include "render.h"
+
+#include <algorithm>
+#include <cmath>
+
+// enable SIMD versions of the screen pass where available
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define CRTFILTER_SSE2 1
+#include <emmintrin.h>
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__ARM_NEON) && defined(__aarch64__)
+#define CRTFILTER_NEON 1
+#include <arm_neon.h>
+#endif
+
+// set to 1 to check the SIMD screen pass against the scalar one at startup
+#define CRTFILTER_VERIFY_SIMD 0
+
+
+namespace {
+
+//============================================================
+//  screen pass kernels
+//============================================================
+
+// scale count pixels; colmul has one multiplier per byte, rowscale one per byte of a pixel
+inline void crt_span_scalar(u32 *dest, u16 const *colmul, u16 const *rowscale, u32 bloom, int count)
+{
+	u8 *const bytes = reinterpret_cast<u8 *>(dest);
+	for (int i = 0; i < count * 4; i++)
+	{
+		u32 const c = bytes[i];
+		u32 const m = colmul[i];
+		u32 const r = rowscale[i & 3];
+		u32 const scaled = (((c * m) >> 8) * r) >> 8;
+		u32 const taken = 256 - ((m * (r >> 1)) >> 7);
+		u32 const bleed = (((((c * c) >> 8) * taken) >> 8) * bloom) >> 8;
+		bytes[i] = u8(std::min<u32>(scaled + bleed, 255));
+	}
+}
+
+#if defined(CRTFILTER_SSE2)
+
+inline void crt_span(u32 *dest, u16 const *colmul, u16 const *rowscale, u32 bloom, int count)
+{
+	__m128i const zero = _mm_setzero_si128();
+	__m128i const rs = _mm_set_epi16(rowscale[3], rowscale[2], rowscale[1], rowscale[0], rowscale[3], rowscale[2], rowscale[1], rowscale[0]);
+	__m128i const rshalf = _mm_srli_epi16(rs, 1);
+	__m128i const bl = _mm_set1_epi16(s16(bloom));
+	__m128i const full = _mm_set1_epi16(256);
+
+	auto const half = [&] (__m128i c, __m128i m)
+	{
+		__m128i const scaled = _mm_srli_epi16(_mm_mullo_epi16(_mm_srli_epi16(_mm_mullo_epi16(c, m), 8), rs), 8);
+		__m128i const taken = _mm_sub_epi16(full, _mm_srli_epi16(_mm_mullo_epi16(m, rshalf), 7));
+		__m128i const square = _mm_srli_epi16(_mm_mullo_epi16(c, c), 8);
+		__m128i const bleed = _mm_srli_epi16(_mm_mullo_epi16(_mm_srli_epi16(_mm_mullo_epi16(square, taken), 8), bl), 8);
+		return _mm_add_epi16(scaled, bleed);
+	};
+
+	int x = 0;
+	for ( ; (x + 4) <= count; x += 4, colmul += 16)
+	{
+		__m128i const px = _mm_loadu_si128(reinterpret_cast<__m128i const *>(dest + x));
+		__m128i const lo = half(_mm_unpacklo_epi8(px, zero), _mm_loadu_si128(reinterpret_cast<__m128i const *>(colmul)));
+		__m128i const hi = half(_mm_unpackhi_epi8(px, zero), _mm_loadu_si128(reinterpret_cast<__m128i const *>(colmul + 8)));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), _mm_packus_epi16(lo, hi));
+	}
+	if (x < count)
+		crt_span_scalar(dest + x, colmul, rowscale, bloom, count - x);
+}
+
+#elif defined(CRTFILTER_NEON)
+
+inline void crt_span(u32 *dest, u16 const *colmul, u16 const *rowscale, u32 bloom, int count)
+{
+	u16 const rsarray[8] = { rowscale[0], rowscale[1], rowscale[2], rowscale[3], rowscale[0], rowscale[1], rowscale[2], rowscale[3] };
+	uint16x8_t const rs = vld1q_u16(rsarray);
+	uint16x8_t const rshalf = vshrq_n_u16(rs, 1);
+	uint16x8_t const bl = vdupq_n_u16(u16(bloom));
+	uint16x8_t const full = vdupq_n_u16(256);
+
+	auto const half = [&] (uint16x8_t c, uint16x8_t m)
+	{
+		uint16x8_t const scaled = vshrq_n_u16(vmulq_u16(vshrq_n_u16(vmulq_u16(c, m), 8), rs), 8);
+		uint16x8_t const taken = vsubq_u16(full, vshrq_n_u16(vmulq_u16(m, rshalf), 7));
+		uint16x8_t const square = vshrq_n_u16(vmulq_u16(c, c), 8);
+		uint16x8_t const bleed = vshrq_n_u16(vmulq_u16(vshrq_n_u16(vmulq_u16(square, taken), 8), bl), 8);
+		return vaddq_u16(scaled, bleed);
+	};
+
+	int x = 0;
+	for ( ; (x + 4) <= count; x += 4, colmul += 16)
+	{
+		uint8x16_t const px = vld1q_u8(reinterpret_cast<u8 const *>(dest + x));
+		uint16x8_t const lo = half(vmovl_u8(vget_low_u8(px)), vld1q_u16(colmul));
+		uint16x8_t const hi = half(vmovl_u8(vget_high_u8(px)), vld1q_u16(colmul + 8));
+		vst1q_u8(reinterpret_cast<u8 *>(dest + x), vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)));
+	}
+	if (x < count)
+		crt_span_scalar(dest + x, colmul, rowscale, bloom, count - x);
+}
+
+#else
+
+inline void crt_span(u32 *dest, u16 const *colmul, u16 const *rowscale, u32 bloom, int count)
+{
+	crt_span_scalar(dest, colmul, rowscale, bloom, count);
+}
+
+#endif
+
+
+#if CRTFILTER_VERIFY_SIMD
+//-------------------------------------------------
+//  verify_span - check the SIMD screen pass
+//  against the scalar one with random data
+//-------------------------------------------------
+
+void verify_span()
+{
+	u32 seed = 0x12345678;
+	auto const rand = [&seed] () { seed = seed * 1664525 + 1013904223; return seed >> 8; };
+
+	for (int iter = 0; iter < 1000; iter++)
+	{
+		int const count = 1 + (rand() % 67);
+		std::vector<u32> simd(count), scalar(count);
+		std::vector<u16> colmul(count * 4);
+		for (int x = 0; x < count; x++)
+			simd[x] = scalar[x] = rand() ^ (rand() << 16);
+		for (u16 &m : colmul)
+			m = rand() % 257;
+		u16 const rowscale[4] = { u16(rand() % 257), u16(rand() % 257), u16(rand() % 257), 256 };
+		u32 const bloom = rand() % 257;
+
+		crt_span(&simd[0], &colmul[0], rowscale, bloom, count);
+		crt_span_scalar(&scalar[0], &colmul[0], rowscale, bloom, count);
+		for (int x = 0; x < count; x++)
+			if (simd[x] != scalar[x])
+				fatalerror("crt_filter: SIMD mismatch at pixel %d of %d: %08X != %08X\n", x, count, simd[x], scalar[x]);
+	}
+}
+#endif
+
+
+//============================================================
+//  composite helpers
+//============================================================
+
+// 5-tap [1 2 2 2 1]/8 low pass; nulls both the subcarrier (a quarter
+// of the sample rate) and the doubled subcarrier left by demodulation
+inline float lowpass(float const *s, int x, int width)
+{
+	auto const at = [s, width] (int i) { return s[std::clamp(i, 0, width - 1)]; };
+	return (at(x - 2) + 2.0f * (at(x - 1) + at(x) + at(x + 1)) + at(x + 2)) * 0.125f;
+}
+
+inline u32 clamp_channel(float v)
+{
+	return u32(std::clamp(v + 0.5f, 0.0f, 255.0f));
+}
+
+} // anonymous namespace
+
+
+//============================================================
+//  crt_filter
+//============================================================
+
+crt_filter::crt_filter(osd_options &options)
+	: m_configured(0)
+	, m_scanline(std::clamp(options.swcrt_scanline(), 0.0f, 1.0f))
+	, m_mask(std::clamp(options.swcrt_mask(), 0.0f, 1.0f))
+	, m_bloom(u32(std::clamp(options.swcrt_bloom(), 0.0f, 1.0f) * 256.0f + 0.5f))
+	, m_budget(std::max(options.swcrt_budget(), 0.0f))
+	, m_bench(options.swcrt_benchmark())
+	, m_queue(nullptr)
+	, m_composite_count(0)
+	, m_pass_count(0)
+	, m_dest(nullptr)
+	, m_pitch(0)
+	, m_alpha_lane(3)
+	, m_frame(0)
+	, m_composite_time(0)
+	, m_level(STAGE_COUNT)
+	, m_average(0.0)
+	, m_settled(0)
+	, m_total_composite(0)
+	, m_total_pass(0)
+	, m_worst(0)
+{
+	if (m_scanline > 0.0f)
+		m_configured |= 1 << STAGE_SCANLINE;
+	if (options.swcrt_ntsc())
+		m_configured |= 1 << STAGE_NTSC;
+	if (m_mask > 0.0f)
+		m_configured |= 1 << STAGE_MASK;
+	if (m_bloom > 0)
+		m_configured |= 1 << STAGE_BLOOM;
+
+	if (m_configured)
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
+#if CRTFILTER_VERIFY_SIMD
+	verify_span();
+#endif
+}
+
+
+crt_filter::~crt_filter()
+{
+	if (m_queue)
+		osd_work_queue_free(m_queue);
+
+	// report what the filters cost on average
+	if (m_frame)
+	{
+		double const scale = 1000.0 / double(osd_ticks_per_second());
+		double const composite = double(m_total_composite) * scale / double(m_frame);
+		double const pass = double(m_total_pass) * scale / double(m_frame);
+		if (m_bench)
+			osd_printf_info("crt_filter: average %.3f ms composite + %.3f ms screen pass per frame, worst %.3f ms, %d of %d stages kept\n",
+					composite, pass, double(m_worst) * scale, m_level, int(STAGE_COUNT));
+		else
+			osd_printf_verbose("crt_filter: average %.3f ms composite + %.3f ms screen pass per frame, worst %.3f ms, %d of %d stages kept\n",
+					composite, pass, double(m_worst) * scale, m_level, int(STAGE_COUNT));
+	}
+}
+
+
+//-------------------------------------------------
+//  begin_frame - composite filter the screen
+//  textures and point the primitives at them
+//-------------------------------------------------
+
+void crt_filter::begin_frame(render_primitive_list &primlist)
+{
+	m_composite_count = 0;
+	m_composite_time = 0;
+	if (!(active_stages() & (1 << STAGE_NTSC)))
+		return;
+
+	osd_ticks_t const start = osd_ticks();
+	gather_screens(primlist);
+	composite_screens();
+
+	// draw from the filtered copies
+	for (unsigned i = 0; i < m_composite_count; i++)
+	{
+		composite_screen &screen = m_composite[i];
+		render_primitive &prim = *screen.prim;
+		prim.texture.base = &screen.pixels[0];
+		prim.texture.rowpixels = prim.texture.width;
+		prim.texture.palette = nullptr;
+		prim.texture.palette_length = 0;
+		prim.flags = (prim.flags & ~PRIMFLAG_TEXFORMAT_MASK) | PRIMFLAG_TEXFORMAT(TEXFORMAT_RGB32);
+	}
+	m_composite_time = osd_ticks() - start;
+}
+
+
+//-------------------------------------------------
+//  end_frame - apply the screen pass and restore
+//  the primitive list
+//-------------------------------------------------
+
+void crt_filter::end_frame(render_primitive_list &primlist, u32 *dest, int width, int height, int pitch, int rshift, int gshift, int bshift)
+{
+	osd_ticks_t const start = osd_ticks();
+	u32 const stages = active_stages() & PASS_STAGES;
+	if (stages)
+	{
+		prepare_passes(primlist, stages, width, height);
+		run_passes(dest, pitch, rshift, gshift, bshift);
+	}
+	osd_ticks_t const pass_time = osd_ticks() - start;
+
+	// time everything on request once the machine is running
+	if (m_bench && (m_frame == BENCHMARK_FRAME))
+		benchmark(primlist, dest, width, height, pitch, rshift, gshift, bshift);
+
+	restore_screens();
+
+	// keep within the budget
+	m_frame++;
+	m_total_composite += m_composite_time;
+	m_total_pass += pass_time;
+	m_worst = std::max(m_worst, m_composite_time + pass_time);
+	update_budget(m_composite_time + pass_time);
+}
+
+
+//-------------------------------------------------
+//  gather_screens - find screen textures the
+//  composite stage can work from
+//-------------------------------------------------
+
+void crt_filter::gather_screens(render_primitive_list &primlist)
+{
+	m_composite_count = 0;
+	for (render_primitive &prim : primlist)
+	{
+		if ((prim.type != render_primitive::QUAD) || !PRIMFLAG_GET_SCREENTEX(prim.flags) || !prim.texture.base)
+			continue;
+
+		// only formats where the whole pixel is colour
+		u32 const format = PRIMFLAG_GET_TEXFORMAT(prim.flags);
+		if ((format != TEXFORMAT_PALETTE16) && (format != TEXFORMAT_RGB32))
+			continue;
+		if ((format == TEXFORMAT_PALETTE16) && !prim.texture.palette)
+			continue;
+
+		if (m_composite.size() <= m_composite_count)
+			m_composite.resize(m_composite_count + 1);
+		composite_screen &screen = m_composite[m_composite_count++];
+		screen.prim = &prim;
+		screen.flags = prim.flags;
+		screen.base = prim.texture.base;
+		screen.rowpixels = prim.texture.rowpixels;
+		screen.palette = prim.texture.palette;
+		screen.palette_length = prim.texture.palette_length;
+		screen.pixels.resize(prim.texture.width * prim.texture.height);
+	}
+}
+
+
+//-------------------------------------------------
+//  composite_screens - filter all gathered
+//  screens on the worker threads
+//-------------------------------------------------
+
+void crt_filter::composite_screens()
+{
+	m_bands.clear();
+	for (unsigned i = 0; i < m_composite_count; i++)
+	{
+		int const rows = m_composite[i].prim->texture.height;
+		for (int top = 0; top < rows; top += ROWS_PER_BAND)
+			m_bands.push_back(work_band{ this, i, top, std::min(top + ROWS_PER_BAND, rows) });
+	}
+	run_bands(&crt_filter::composite_callback);
+}
+
+
+//-------------------------------------------------
+//  composite_rows - encode and decode a range of
+//  rows of a screen as a composite signal
+//-------------------------------------------------
+
+void crt_filter::composite_rows(composite_screen &screen, int top, int bottom)
+{
+	render_texinfo const &texture = screen.prim->texture;
+	int const width = texture.width;
+	u32 const format = PRIMFLAG_GET_TEXFORMAT(screen.flags);
+
+	// subcarrier at a quarter of the sample rate
+	static constexpr float carrier_cos[4] = { 1.0f, 0.0f, -1.0f, 0.0f };
+	static constexpr float carrier_sin[4] = { 0.0f, 1.0f, 0.0f, -1.0f };
+
+	std::vector<float> signal(width * 3);
+	float *const s = &signal[0];
+	float *const si = &signal[width];
+	float *const sq = &signal[width * 2];
+
+	for (int y = top; y < bottom; y++)
+	{
+		// the phase moves a quarter cycle per line and half a cycle per frame
+		int const phase = y + ((m_frame & 1) << 1);
+
+		// encode
+		for (int x = 0; x < width; x++)
+		{
+			u32 r, g, b;
+			if (format == TEXFORMAT_PALETTE16)
+			{
+				rgb_t const pix = screen.palette[reinterpret_cast<u16 const *>(screen.base)[y * screen.rowpixels + x]];
+				r = pix.r();
+				g = pix.g();
+				b = pix.b();
+			}
+			else
+			{
+				rgb_t const pix = reinterpret_cast<u32 const *>(screen.base)[y * screen.rowpixels + x];
+				r = pix.r();
+				g = pix.g();
+				b = pix.b();
+				if (screen.palette)
+				{
+					r = screen.palette[r] & 0xff;
+					g = screen.palette[g] & 0xff;
+					b = screen.palette[b] & 0xff;
+				}
+			}
+
+			float const luma = 0.299f * r + 0.587f * g + 0.114f * b;
+			float const i = 0.596f * r - 0.274f * g - 0.322f * b;
+			float const q = 0.211f * r - 0.523f * g + 0.312f * b;
+			int const p = (x + phase) & 3;
+			s[x] = luma + i * carrier_cos[p] + q * carrier_sin[p];
+			si[x] = s[x] * carrier_cos[p] * 2.0f;
+			sq[x] = s[x] * carrier_sin[p] * 2.0f;
+		}
+
+		// decode
+		u32 *const out = &screen.pixels[y * width];
+		for (int x = 0; x < width; x++)
+		{
+			float const luma = lowpass(s, x, width);
+			float const i = lowpass(si, x, width);
+			float const q = lowpass(sq, x, width);
+			out[x] = rgb_t(
+					clamp_channel(luma + 0.956f * i + 0.621f * q),
+					clamp_channel(luma - 0.272f * i - 0.647f * q),
+					clamp_channel(luma - 1.106f * i + 1.703f * q));
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  restore_screens - put back the textures the
+//  composite stage replaced
+//-------------------------------------------------
+
+void crt_filter::restore_screens()
+{
+	for (unsigned i = 0; i < m_composite_count; i++)
+	{
+		composite_screen &screen = m_composite[i];
+		render_primitive &prim = *screen.prim;
+		prim.flags = screen.flags;
+		prim.texture.base = screen.base;
+		prim.texture.rowpixels = screen.rowpixels;
+		prim.texture.palette = screen.palette;
+		prim.texture.palette_length = screen.palette_length;
+	}
+	m_composite_count = 0;
+}
+
+
+//-------------------------------------------------
+//  prepare_passes - work out the area and the
+//  multipliers for each screen in the frame
+//-------------------------------------------------
+
+void crt_filter::prepare_passes(render_primitive_list &primlist, u32 stages, int width, int height)
+{
+	m_pass_count = 0;
+	for (render_primitive &prim : primlist)
+	{
+		if ((prim.type != render_primitive::QUAD) || !PRIMFLAG_GET_SCREENTEX(prim.flags) || !prim.texture.base)
+			continue;
+
+		int const x0 = std::max(int(std::lround(prim.bounds.x0)), 0);
+		int const y0 = std::max(int(std::lround(prim.bounds.y0)), 0);
+		int const x1 = std::min(int(std::lround(prim.bounds.x1)), width);
+		int const y1 = std::min(int(std::lround(prim.bounds.y1)), height);
+		if ((x0 >= x1) || (y0 >= y1))
+			continue;
+
+		if (m_passes.size() <= m_pass_count)
+			m_passes.resize(m_pass_count + 1);
+		screen_pass &pass = m_passes[m_pass_count++];
+		pass.x0 = x0;
+		pass.y0 = y0;
+		pass.x1 = x1;
+		pass.y1 = y1;
+		pass.colmul.assign((x1 - x0) * 4, 256);
+		pass.rowscale.assign(y1 - y0, 256);
+
+		// scanlines follow the texture rows, which run down the screen when it's rotated;
+		// work from the texture coordinates so renderers can rescale the bounds
+		bool const swap = (PRIMFLAG_GET_TEXORIENT(prim.flags) & ORIENTATION_SWAP_XY) != 0;
+		float const lines = float(prim.texture.height);
+		float const start = swap ? prim.bounds.x0 : prim.bounds.y0;
+		float const extent = swap ? (prim.bounds.x1 - prim.bounds.x0) : (prim.bounds.y1 - prim.bounds.y0);
+		float const v0 = prim.texcoords.tl.v * lines;
+		float const v1 = (swap ? prim.texcoords.tr.v : prim.texcoords.bl.v) * lines;
+
+		// below two pixels per line there's no room for a gap
+		bool const scanlines = (stages & (1 << STAGE_SCANLINE)) && (v0 != v1) && (extent >= 2.0f * std::fabs(v1 - v0));
+		auto const weight = [this, start, extent, v0, v1] (int pos)
+		{
+			float const where = v0 + (float(pos) + 0.5f - start) * (v1 - v0) / extent;
+			float const dist = std::fabs(where - std::floor(where) - 0.5f) * 2.0f;
+			return u16(std::lround(256.0f * (1.0f - m_scanline * dist * dist)));
+		};
+
+		if (scanlines && !swap)
+		{
+			for (int y = y0; y < y1; y++)
+				pass.rowscale[y - y0] = weight(y);
+		}
+
+		u16 const dim = u16(std::lround(256.0f * (1.0f - m_mask)));
+		bool const mask = (stages & (1 << STAGE_MASK)) != 0;
+		if (mask || (scanlines && swap))
+		{
+			for (int x = x0; x < x1; x++)
+			{
+				u16 const scan = (scanlines && swap) ? weight(x) : 256;
+				u16 *const mul = &pass.colmul[(x - x0) * 4];
+				for (int channel = 0; channel < 3; channel++)
+				{
+					// channel 0 is red, 1 green, 2 blue; lanes are filled in when the pass runs
+					u16 const m = (mask && ((x % 3) != channel)) ? dim : 256;
+					mul[channel] = u16((m * scan) >> 8);
+				}
+				mul[3] = 256;
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  run_passes - apply the screen pass to the
+//  finished frame
+//-------------------------------------------------
+
+void crt_filter::run_passes(u32 *dest, int pitch, int rshift, int gshift, int bshift)
+{
+	if (!m_pass_count)
+		return;
+
+	// map red/green/blue/alpha to bytes within a pixel
+#ifdef LSB_FIRST
+	auto const lane = [] (int shift) { return shift >> 3; };
+#else
+	auto const lane = [] (int shift) { return 3 - (shift >> 3); };
+#endif
+	int const lanes[3] = { lane(rshift), lane(gshift), lane(bshift) };
+	m_alpha_lane = u16(6 - lanes[0] - lanes[1] - lanes[2]);
+
+	m_bands.clear();
+	for (unsigned i = 0; i < m_pass_count; i++)
+	{
+		screen_pass &pass = m_passes[i];
+
+		// reorder the column multipliers from red/green/blue/alpha to memory order
+		for (std::size_t x = 0; x < pass.colmul.size(); x += 4)
+		{
+			u16 ordered[4];
+			ordered[lanes[0]] = pass.colmul[x + 0];
+			ordered[lanes[1]] = pass.colmul[x + 1];
+			ordered[lanes[2]] = pass.colmul[x + 2];
+			ordered[m_alpha_lane] = 256;
+			std::copy_n(ordered, 4, &pass.colmul[x]);
+		}
+
+		for (int top = pass.y0; top < pass.y1; top += ROWS_PER_BAND)
+			m_bands.push_back(work_band{ this, i, top, std::min(top + ROWS_PER_BAND, pass.y1) });
+	}
+
+	m_dest = dest;
+	m_pitch = pitch;
+	run_bands(&crt_filter::pass_callback);
+}
+
+
+//-------------------------------------------------
+//  run_bands - run the current bands on the
+//  worker threads and wait for them
+//-------------------------------------------------
+
+void crt_filter::run_bands(osd_work_callback callback)
+{
+	if (m_bands.empty())
+		return;
+
+	if (m_queue && (m_bands.size() > 1))
+	{
+		osd_work_item_queue_multiple(m_queue, callback, m_bands.size(), &m_bands[0], sizeof(m_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 10);
+	}
+	else
+	{
+		for (work_band &band : m_bands)
+			callback(&band, 0);
+	}
+}
+
+
+//-------------------------------------------------
+//  composite_callback - composite filter a band
+//  of rows
+//-------------------------------------------------
+
+void *crt_filter::composite_callback(void *param, int threadid)
+{
+	work_band const &band = *reinterpret_cast<work_band const *>(param);
+	band.filter->composite_rows(band.filter->m_composite[band.index], band.top, band.bottom);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  pass_callback - apply the screen pass to a
+//  band of rows
+//-------------------------------------------------
+
+void *crt_filter::pass_callback(void *param, int threadid)
+{
+	work_band const &band = *reinterpret_cast<work_band const *>(param);
+	crt_filter &filter = *band.filter;
+	screen_pass const &pass = filter.m_passes[band.index];
+
+	for (int y = band.top; y < band.bottom; y++)
+	{
+		u16 rowscale[4];
+		std::fill_n(rowscale, 4, pass.rowscale[y - pass.y0]);
+		rowscale[filter.m_alpha_lane] = 256;
+		crt_span(filter.m_dest + y * filter.m_pitch + pass.x0, &pass.colmul[0], rowscale, (filter.active_stages() & (1 << STAGE_BLOOM)) ? filter.m_bloom : 0, pass.x1 - pass.x0);
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  update_budget - give up stages while the
+//  filters take too long, and take them back
+//  once there's room again
+//-------------------------------------------------
+
+void crt_filter::update_budget(osd_ticks_t elapsed)
+{
+	if (m_budget <= 0.0)
+		return;
+
+	double const ms = double(elapsed) * 1000.0 / double(osd_ticks_per_second());
+	m_average = m_average * 0.9 + ms * 0.1;
+	m_settled++;
+
+	// drop quickly, recover slowly
+	if ((m_average > m_budget) && (m_settled > 30) && (m_level > 0))
+	{
+		m_level--;
+		m_settled = 0;
+		osd_printf_verbose("crt_filter: %.2f ms per frame is over the %.2f ms budget, dropping to %d stages\n", m_average, m_budget, m_level);
+	}
+	else if ((m_average < m_budget * 0.5) && (m_settled > 600) && (m_level < STAGE_COUNT))
+	{
+		m_level++;
+		m_settled = 0;
+		m_average = m_budget * 0.5;
+		osd_printf_verbose("crt_filter: back to %d stages\n", m_level);
+	}
+}
+
+
+//-------------------------------------------------
+//  benchmark - time each stage on its own and
+//  all of them together on the current frame
+//-------------------------------------------------
+
+void crt_filter::benchmark(render_primitive_list &primlist, u32 const *dest, int width, int height, int pitch, int rshift, int gshift, int bshift)
+{
+	// work on a copy so the frame being shown isn't affected
+	std::vector<u32> scratch(dest, dest + std::size_t(pitch) * height);
+
+	// the composite stage needs the original textures
+	restore_screens();
+	gather_screens(primlist);
+
+	int const level = m_level;
+	m_level = STAGE_COUNT;
+
+	static char const *const names[STAGE_COUNT] = { "scanline", "ntsc", "mask", "bloom" };
+	double const scale = 1000.0 / double(osd_ticks_per_second());
+	osd_printf_info("crt_filter: timing %dx%d frame, %u screen(s), %.2f ms budget\n", width, height, m_composite_count, m_budget);
+	for (int stage = 0; stage <= STAGE_COUNT; stage++)
+	{
+		// each stage on its own, then everything together
+		u32 const stages = (stage < STAGE_COUNT) ? (1 << stage) : ((1 << STAGE_COUNT) - 1);
+		u32 const saved = m_configured;
+		m_configured = stages;
+
+		osd_ticks_t total = 0, worst = 0;
+		for (int pass = 0; pass < BENCHMARK_PASSES; pass++)
+		{
+			osd_ticks_t const start = osd_ticks();
+			if (stages & (1 << STAGE_NTSC))
+				composite_screens();
+			if (stages & PASS_STAGES)
+			{
+				prepare_passes(primlist, stages, width, height);
+				run_passes(scratch.data(), pitch, rshift, gshift, bshift);
+			}
+			osd_ticks_t const elapsed = osd_ticks() - start;
+			total += elapsed;
+			worst = std::max(worst, elapsed);
+		}
+		m_configured = saved;
+
+		double const average = double(total) * scale / BENCHMARK_PASSES;
+		osd_printf_info("crt_filter: %-8s %7.3f ms average %7.3f ms worst%s\n",
+				(stage < STAGE_COUNT) ? names[stage] : "all",
+				average,
+				double(worst) * scale,
+				((m_budget > 0.0) && (average > m_budget)) ? "  over budget" : "");
+	}
+
+	m_level = level;
+	m_composite_count = 0;
+}
@@ -0,0 +1,143 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+//============================================================
+//
+//  crtfilter.h - CPU CRT post-processing for software renderers
+//
+//============================================================
+#ifndef MAME_OSD_MODULES_RENDER_CRTFILTER_H
+#define MAME_OSD_MODULES_RENDER_CRTFILTER_H
+
+#pragma once
+
+#include "osdcore.h"
+
+#include <vector>
+
+
+//============================================================
+//  TYPE DEFINITIONS
+//============================================================
+
+class osd_options;
+class render_primitive;
+class render_primitive_list;
+
+// crt_filter adds scanlines, an aperture grille, bloom and composite
+// NTSC artifacts to emulated screens around a software renderer's
+// draw_primitives call
+class crt_filter
+{
+public:
+	crt_filter(osd_options &options);
+	~crt_filter();
+
+	bool enabled() const { return m_configured != 0; }
+
+	// call before draw_primitives; swaps screen textures for
+	// composite filtered copies
+	void begin_frame(render_primitive_list &primlist);
+
+	// call after draw_primitives on a 32bpp destination; applies
+	// the screen effects and puts the list back the way it was
+	void end_frame(render_primitive_list &primlist, u32 *dest, int width, int height, int pitch, int rshift, int gshift, int bshift);
+
+private:
+	// stages, in the order they are given up when over budget
+	enum
+	{
+		STAGE_SCANLINE = 0,
+		STAGE_NTSC,
+		STAGE_MASK,
+		STAGE_BLOOM,
+		STAGE_COUNT
+	};
+
+	static constexpr u32 PASS_STAGES = (1 << STAGE_SCANLINE) | (1 << STAGE_MASK) | (1 << STAGE_BLOOM);
+	static constexpr int ROWS_PER_BAND = 16;        // rows handed to a worker at a time
+	static constexpr int BENCHMARK_FRAME = 300;     // frames to let things settle before benchmarking
+	static constexpr int BENCHMARK_PASSES = 30;     // times each stage is run when benchmarking
+
+	// a screen texture and the composite filtered copy that replaces it
+	struct composite_screen
+	{
+		render_primitive *  prim;               // primitive we change
+		u32                 flags;              // its original flags
+		void *              base;               // its original texture base
+		u32                 rowpixels;          // its original row pitch
+		const rgb_t *       palette;            // its original palette
+		u32                 palette_length;     // its original palette length
+		std::vector<u32>    pixels;             // filtered copy of the texture
+	};
+
+	// the part of the frame covered by a screen
+	struct screen_pass
+	{
+		int                 x0, y0, x1, y1;     // covered area, exclusive on the right and bottom
+		std::vector<u16>    colmul;             // multiplier per byte of a row, 0-256
+		std::vector<u16>    rowscale;           // multiplier per row, 0-256
+	};
+
+	// a band of rows for a worker
+	struct work_band
+	{
+		crt_filter *        filter;
+		unsigned            index;              // screen index
+		int                 top;                // first row
+		int                 bottom;             // last row, exclusive
+	};
+
+	// stage selection
+	u32 active_stages() const { return m_configured & ((1 << m_level) - 1); }
+
+	// composite stage
+	void gather_screens(render_primitive_list &primlist);
+	void composite_screens();
+	void composite_rows(composite_screen &screen, int top, int bottom);
+	void restore_screens();
+
+	// screen pass stage
+	void prepare_passes(render_primitive_list &primlist, u32 stages, int width, int height);
+	void run_passes(u32 *dest, int pitch, int rshift, int gshift, int bshift);
+
+	// helpers
+	void run_bands(osd_work_callback callback);
+	void update_budget(osd_ticks_t elapsed);
+	void benchmark(render_primitive_list &primlist, u32 const *dest, int width, int height, int pitch, int rshift, int gshift, int bshift);
+
+	static void *composite_callback(void *param, int threadid);
+	static void *pass_callback(void *param, int threadid);
+
+	// configuration
+	u32                     m_configured;           // stages asked for
+	float                   m_scanline;             // scanline gap darkening
+	float                   m_mask;                 // aperture grille strength
+	u32                     m_bloom;                // bloom amount, 0-256
+	double                  m_budget;               // milliseconds per frame, 0 for no limit
+	bool                    m_bench;                // report timings
+
+	// current frame
+	osd_work_queue *        m_queue;                // worker threads
+	std::vector<composite_screen> m_composite;      // screens being composite filtered
+	unsigned                m_composite_count;      // number of those in use
+	std::vector<screen_pass> m_passes;              // screens getting scanlines/mask/bloom
+	unsigned                m_pass_count;           // number of those in use
+	std::vector<work_band>  m_bands;                // work for the current stage
+	u32 *                   m_dest;                 // frame being filtered
+	int                     m_pitch;                // its pitch in pixels
+	u16                     m_alpha_lane;           // byte of a pixel holding alpha
+	u32                     m_frame;                // frames drawn
+	osd_ticks_t             m_composite_time;       // time spent on the composite stage this frame
+
+	// time budget
+	int                     m_level;                // stages still allowed
+	double                  m_average;              // moving average of the frame cost in ms
+	int                     m_settled;              // frames since the level last changed
+
+	// statistics
+	osd_ticks_t             m_total_composite;
+	osd_ticks_t             m_total_pass;
+	osd_ticks_t             m_worst;
+};
+
+#endif // MAME_OSD_MODULES_RENDER_CRTFILTER_H
@@ -64,6 +64,9 @@ renderer_sdl2::renderer_sdl2(std::shared_ptr<osd_window> window, int extra_flags
 	: osd_renderer(window,  FLAG_NEEDS_OPENGL | extra_flags)
 	, m_sdl_renderer(nullptr)
 	, m_blittimer(0)
+	, m_drawn_list(nullptr)
+	, m_drawn_generation(0)
+	, m_drawn_prescale(0)
 	, m_last_hofs(0)
 	, m_last_vofs(0)
 	, m_width(0)
@@ -487,6 +490,9 @@ void renderer_sdl2::destroy_all_textures()
 	if (win == nullptr)
 		return;
 
+	m_drawn_list = nullptr;
+	m_drawn_textures.clear();
+
 	if(win->m_primlist)
 	{
 		win->m_primlist->acquire_lock();
@@ -562,6 +568,18 @@ int renderer_sdl2::draw(int update)
 
 	win->m_primlist->acquire_lock();
 
+	// skip looking up and checking textures if the list hasn't changed
+	bool const reuse = (win->m_primlist == m_drawn_list) && (win->m_primlist->generation() == m_drawn_generation) && (win->prescale() == m_drawn_prescale);
+	if (!reuse)
+	{
+		m_drawn_list = win->m_primlist;
+		m_drawn_generation = win->m_primlist->generation();
+		m_drawn_prescale = win->prescale();
+		m_drawn_textures.clear();
+	}
+	osd_ticks_t const now = osd_ticks();
+	size_t quadnum = 0;
+
 	// now draw
 	for (render_primitive &prim : *win->m_primlist)
 	{
@@ -581,7 +599,17 @@ int renderer_sdl2::draw(int update)
 						prim.bounds.x1 + hofs, prim.bounds.y1 + vofs);
 				break;
 			case render_primitive::QUAD:
-				texture = texture_update(prim);
+				if (reuse)
+				{
+					texture = m_drawn_textures[quadnum++];
+					if (texture)
+						texture->m_last_access = now;
+				}
+				else
+				{
+					texture = texture_update(prim);
+					m_drawn_textures.push_back(texture);
+				}
 				if (texture)
 					blit_pixels += (texture->raw_height() * texture->raw_width());
 				render_quad(texture, prim,
@@ -759,33 +787,46 @@ texture_info::~texture_info()
 //  texture_set_data
 //============================================================
 
-void texture_info::set_data(const render_texinfo &texsource, const uint32_t flags)
+void texture_info::set_data(const render_texinfo &texsource, const uint32_t flags, const bool dirty_only)
 {
+	// when the previous contents are known to be current, only upload the rows that changed;
+	// rotated textures don't map source rows onto texture rows, so they always go in full
+	int top = 0;
+	int bottom = m_setup.rotheight - 1;
+	if (dirty_only && !m_is_rotated)
+	{
+		top = std::max<int>(texsource.dirty_top, top);
+		bottom = std::min<int>(texsource.dirty_bottom, bottom);
+		if (top > bottom)
+			return;
+	}
+	SDL_Rect const rect = { 0, top, m_setup.rotwidth, bottom + 1 - top };
+
 	m_copyinfo->time -= osd_ticks();
 	if (m_sdl_access == SDL_TEXTUREACCESS_STATIC)
 	{
 		if ( m_copyinfo->blitter->m_is_passthrough )
 		{
-			m_pixels = texsource.base;
 			m_pitch = m_texinfo.rowpixels * m_copyinfo->blitter->m_dest_bpp;
+			m_pixels = (uint8_t *) texsource.base + top * m_pitch;
 		}
 		else
 		{
 			m_pitch = m_setup.rotwidth * m_copyinfo->blitter->m_dest_bpp;
-			m_copyinfo->blitter->texop(this, &texsource);
+			m_copyinfo->blitter->texop(this, &texsource, top, bottom);
 		}
-		SDL_UpdateTexture(m_texture_id, nullptr, m_pixels, m_pitch);
+		SDL_UpdateTexture(m_texture_id, &rect, m_pixels, m_pitch);
 	}
 	else
 	{
-		SDL_LockTexture(m_texture_id, nullptr, (void **) &m_pixels, &m_pitch);
+		SDL_LockTexture(m_texture_id, &rect, (void **) &m_pixels, &m_pitch);
 		if ( m_copyinfo->blitter->m_is_passthrough )
 		{
-			uint8_t *src = (uint8_t *) texsource.base;
-			uint8_t *dst = (uint8_t *) m_pixels;
 			int spitch = texsource.rowpixels * m_copyinfo->blitter->m_dest_bpp;
+			uint8_t *src = (uint8_t *) texsource.base + top * spitch;
+			uint8_t *dst = (uint8_t *) m_pixels;
 			int num = texsource.width * m_copyinfo->blitter->m_dest_bpp;
-			int h = texsource.height;
+			int h = bottom + 1 - top;
 			while (h--) {
 				memcpy(dst, src, num);
 				src += spitch;
@@ -793,7 +834,7 @@ void texture_info::set_data(const render_texinfo &texsource, const uint32_t flag
 			}
 		}
 		else
-			m_copyinfo->blitter->texop(this, &texsource);
+			m_copyinfo->blitter->texop(this, &texsource, top, bottom);
 		SDL_UnlockTexture(m_texture_id);
 	}
 	m_copyinfo->time += osd_ticks();
@@ -951,9 +992,11 @@ texture_info * renderer_sdl2::texture_update(const render_primitive &prim)
 	{
 		if (prim.texture.base != nullptr && texture->texinfo().seqid != prim.texture.seqid)
 		{
+			// if we are exactly one update behind on the same texture, its dirty rows are all that changed
+			bool const dirty_only = (texture->texinfo().seqid + 1 == prim.texture.seqid) && (texture->texinfo().unique_id == prim.texture.unique_id);
 			texture->texinfo().seqid = prim.texture.seqid;
 			// if we found it, but with a different seqid, copy the data
-			texture->set_data(prim.texture, prim.flags);
+			texture->set_data(prim.texture, prim.flags, dirty_only);
 		}
 
 	}
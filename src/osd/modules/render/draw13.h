@@ -28,6 +28,8 @@ typedef uint64_t HashT;
 #include "emucore.h"
 #include "render.h"
 
+#include <vector>
+
 struct quad_setup_data
 {
 	quad_setup_data()
@@ -64,7 +66,7 @@ public:
 	texture_info(renderer_sdl2 *renderer, const render_texinfo &texsource, const quad_setup_data &setup, const uint32_t flags);
 	~texture_info();
 
-	void set_data(const render_texinfo &texsource, const uint32_t flags);
+	void set_data(const render_texinfo &texsource, const uint32_t flags, const bool dirty_only);
 	void render_quad(const render_primitive &prim, const int x, const int y);
 	bool matches(const render_primitive &prim, const quad_setup_data &setup);
 
@@ -191,6 +193,12 @@ private:
 
 	simple_list<texture_info>  m_texlist;                // list of active textures
 
+	// an identical primitive list resolves to the same textures as last time
+	const render_primitive_list *m_drawn_list;         // list drawn last time
+	uint64_t                    m_drawn_generation;    // generation of that list
+	int                         m_drawn_prescale;      // prescale it was drawn with
+	std::vector<texture_info *> m_drawn_textures;      // texture for each quad in that list
+
 	float           m_last_hofs;
 	float           m_last_vofs;
 
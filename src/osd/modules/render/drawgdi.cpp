@@ -34,6 +34,11 @@ int renderer_gdi::create()
 	m_bminfo.bmiHeader.biYPelsPerMeter   = 0;
 	m_bminfo.bmiHeader.biClrUsed         = 0;
 	m_bminfo.bmiHeader.biClrImportant    = 0;
+
+	// set up the CRT filter if any of it was asked for
+	m_crt_filter = std::make_unique<crt_filter>(downcast<osd_options &>(assert_window()->machine().options()));
+	if (!m_crt_filter->enabled())
+		m_crt_filter.reset();
 	return 0;
 }
 
@@ -86,7 +91,11 @@ int renderer_gdi::draw(const int update)
 
 	// draw the primitives to the bitmap
 	win->m_primlist->acquire_lock();
+	if (m_crt_filter)
+		m_crt_filter->begin_frame(*win->m_primlist);
 	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, m_bmdata.get(), width, height, pitch);
+	if (m_crt_filter)
+		m_crt_filter->end_frame(*win->m_primlist, reinterpret_cast<uint32_t *>(m_bmdata.get()), width, height, pitch, 16, 8, 0);
 	win->m_primlist->release_lock();
 
 	// fill in bitmap-specific info
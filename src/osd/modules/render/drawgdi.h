@@ -18,6 +18,9 @@
 
 // MAMEOS headers
 #include "window.h"
+#include "crtfilter.h"
+
+#include <memory>
 
 
 //============================================================
@@ -50,6 +53,7 @@ private:
 	BITMAPINFO                  m_bminfo;
 	std::unique_ptr<uint8_t []> m_bmdata;
 	size_t                      m_bmsize;
+	std::unique_ptr<crt_filter> m_crt_filter;
 };
 
 #endif // MAME_OSD_MODULES_RENDER_DRAWGDI_H
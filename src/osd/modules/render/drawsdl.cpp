@@ -240,6 +240,10 @@ int renderer_sdl1::create()
 	m_yuv_lookup = nullptr;
 	m_blittimer = 0;
 
+	m_crt_filter = std::make_unique<crt_filter>(downcast<osd_options &>(win->machine().options()));
+	if (!m_crt_filter->enabled())
+		m_crt_filter.reset();
+
 	yuv_init();
 	osd_printf_verbose("Leave renderer_sdl2::create\n");
 	return 0;
@@ -388,8 +392,11 @@ int renderer_sdl1::draw(int update)
 	// FIXME: this could be a lot easier if we get the primlist here!
 	//          Bounds would be set fit for purpose and done!
 
+	// the same list may be handed to us again if nothing changed, so keep the original bounds
+	m_saved_bounds.clear();
 	for (render_primitive &prim : *win->m_primlist)
 	{
+		m_saved_bounds.push_back(prim.bounds);
 		prim.bounds.x0 = floor(fw * prim.bounds.x0 + 0.5f);
 		prim.bounds.x1 = floor(fw * prim.bounds.x1 + 0.5f);
 		prim.bounds.y0 = floor(fh * prim.bounds.y0 + 0.5f);
@@ -399,22 +406,35 @@ int renderer_sdl1::draw(int update)
 	// render to it
 	if (!sm->is_yuv)
 	{
+		// the CRT filter only handles 32bpp surfaces
+		crt_filter *const filter = (bpp == 4) ? m_crt_filter.get() : nullptr;
+		if (filter)
+			filter->begin_frame(*win->m_primlist);
+
 		switch (rmask)
 		{
 			case 0xff000000:
 				software_renderer<uint32_t, 0,0,0, 24,16,8>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				if (filter)
+					filter->end_frame(*win->m_primlist, reinterpret_cast<uint32_t *>(surfptr), mamewidth, mameheight, pitch / 4, 24, 16, 8);
 				break;
 
 			case 0x0000ff00:
 				software_renderer<uint32_t, 0,0,0, 8,16,24>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				if (filter)
+					filter->end_frame(*win->m_primlist, reinterpret_cast<uint32_t *>(surfptr), mamewidth, mameheight, pitch / 4, 8, 16, 24);
 				break;
 
 			case 0x00ff0000:
 				software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				if (filter)
+					filter->end_frame(*win->m_primlist, reinterpret_cast<uint32_t *>(surfptr), mamewidth, mameheight, pitch / 4, 16, 8, 0);
 				break;
 
 			case 0x000000ff:
 				software_renderer<uint32_t, 0,0,0, 0,8,16>::draw_primitives(*win->m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				if (filter)
+					filter->end_frame(*win->m_primlist, reinterpret_cast<uint32_t *>(surfptr), mamewidth, mameheight, pitch / 4, 0, 8, 16);
 				break;
 
 			case 0xf800:
@@ -427,6 +447,8 @@ int renderer_sdl1::draw(int update)
 
 			default:
 				osd_printf_error("SDL: ERROR! Unknown video mode: R=%08X G=%08X B=%08X\n", rmask, gmask, bmask);
+				if (filter)
+					filter->end_frame(*win->m_primlist, reinterpret_cast<uint32_t *>(surfptr), 0, 0, pitch / 4, 16, 8, 0);
 				break;
 		}
 	}
@@ -438,6 +460,11 @@ int renderer_sdl1::draw(int update)
 		sm->yuv_blit(m_yuv_bitmap.get(), surfptr, pitch, m_yuv_lookup.get(), mamewidth, mameheight);
 	}
 
+	// put the bounds back
+	auto saved = m_saved_bounds.cbegin();
+	for (render_primitive &prim : *win->m_primlist)
+		prim.bounds = *saved++;
+
 	win->m_primlist->release_lock();
 
 	// unlock and flip
@@ -15,8 +15,13 @@
 
 #pragma once
 
+#include "crtfilter.h"
+
 #include <SDL2/SDL.h>
 
+#include <memory>
+#include <vector>
+
 /* renderer_sdl1 is the information about SDL for the current screen */
 class renderer_sdl1 : public osd_renderer
 {
@@ -71,6 +76,10 @@ private:
 	int                 m_last_vofs;
 	osd_dim             m_blit_dim;
 	osd_dim             m_last_dim;
+
+	std::vector<render_bounds> m_saved_bounds;
+
+	std::unique_ptr<crt_filter> m_crt_filter;
 };
 
 struct sdl_scale_mode
@@ -38,6 +38,13 @@ const char *osd_getenv(const char *name);
 int osd_getpid();
 
 
+/// \brief Get peak memory usage of the current process
+///
+/// \return The largest resident set size the process has had, in
+///   bytes, or zero if this cannot be determined.
+uint64_t osd_peak_memory_usage();
+
+
 /*-----------------------------------------------------------------------------
     osd_uchar_from_osdchar: convert the given character or sequence of
         characters from the OS-default encoding to a Unicode character
@@ -186,6 +193,12 @@ typedef void *(*osd_work_callback)(void *param, int threadid);
         A work queue abstracts the notion of how potentially threaded work
         can be performed. If no threading support is available, it is a
         simple matter to execute the work items as they are queued.
+
+        All queues share a single pool of worker threads started with the
+        first queue that needs one. Items from WORK_QUEUE_FLAG_HIGH_FREQ
+        queues are run ahead of everything else, and items from
+        WORK_QUEUE_FLAG_IO queues behind everything else and on no more
+        than half the workers.
 -----------------------------------------------------------------------------*/
 osd_work_queue *osd_work_queue_alloc(int flags);
 
@@ -275,6 +288,40 @@ void osd_work_queue_free(osd_work_queue *queue);
 osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_callback callback, int32_t numitems, void *parambase, int32_t paramstep, uint32_t flags);
 
 
+/*-----------------------------------------------------------------------------
+    osd_work_item_queue_multiple_then: queue a set of work items, followed
+    by one more once they are all complete
+
+    Parameters:
+
+        queue - pointer to an osd_work_queue that was previously created via
+            osd_work_queue_alloc
+
+        callback, numitems, param, paramstep - as for
+            osd_work_item_queue_multiple
+
+        continuation - pointer to a function to call after every one of the
+            numitems items has completed
+
+        contparam - a void * parameter passed to the continuation
+
+        flags - one or more of the WORK_ITEM_FLAG_* values ORed together;
+            these apply to the continuation, the other items are always
+            released automatically
+
+    Return value:
+
+        A pointer to the continuation's osd_work_item, or nullptr if it is
+        released automatically.
+
+    Notes:
+
+        The continuation counts as queued from the start, so
+        osd_work_queue_wait won't return before it has run.
+-----------------------------------------------------------------------------*/
+osd_work_item *osd_work_item_queue_multiple_then(osd_work_queue *queue, osd_work_callback callback, int32_t numitems, void *parambase, int32_t paramstep, osd_work_callback continuation, void *contparam, uint32_t flags);
+
+
 /* inline helper to queue a single work item using the same interface */
 static inline osd_work_item *osd_work_item_queue(osd_work_queue *queue, osd_work_callback callback, void *param, uint32_t flags)
 {
@@ -151,6 +151,38 @@ public:
 	/// \return Result of the operation.
 	virtual std::error_condition flush() noexcept = 0;
 
+	/// \brief Commit written data to persistent storage
+	///
+	/// Unlike flush, this does not return until all prior writes have
+	/// reached persistent storage.  On POSIX systems a directory opened
+	/// for reading can be synchronised too, which makes files created
+	/// or renamed in it durable.  Not all file-like objects support
+	/// this.
+	/// \return Result of the operation.
+	virtual std::error_condition sync() noexcept
+	{
+		return std::errc::not_supported;
+	}
+
+	/// \brief Map part of an open file into memory
+	///
+	/// Creates a private, copy-on-write mapping of part of the file.
+	/// Pages are shared with the operating system's file cache until
+	/// they are written to; writes are never reflected in the
+	/// underlying file.  The mapping remains valid after the file is
+	/// closed, until the last reference to it is released.  Not all
+	/// file-like objects support mapping.
+	/// \param [in] offset Byte offset within the file to start mapping
+	///   at, relative to the start of the file.  Need not be aligned.
+	/// \param [in] length Number of bytes to map.
+	/// \param [out] data Receives a pointer to the mapped data if the
+	///   operation succeeds.  Not valid if the operation fails.
+	/// \return Result of the operation.
+	virtual std::error_condition map(std::uint64_t offset, std::size_t length, std::shared_ptr<std::uint8_t> &data) noexcept
+	{
+		return std::errc::not_supported;
+	}
+
 	/// \brief Delete a file
 	///
 	/// \param [in] filename Path to the file to delete.
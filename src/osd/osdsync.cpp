@@ -17,13 +17,16 @@
 #endif
 #endif
 #include <mutex>
+#include <condition_variable>
 #include <atomic>
 #include <thread>
 #include <vector>
+#include <deque>
 #include <algorithm>
 // MAME headers
 #include "osdcore.h"
 #include "osdsync.h"
+#include "osdtrace.h"
 
 #include "eminline.h"
 
@@ -43,6 +46,7 @@
 
 #define ENV_PROCESSORS               "OSDPROCESSORS"
 #define ENV_WORKQUEUEMAXTHREADS      "OSDWORKQUEUEMAXTHREADS"
+#define ENV_WORKQUEUEPIN             "OSDWORKQUEUEPIN"
 
 #define SPIN_LOOP_TIME          (osd_ticks_per_second() / 10000)
 
@@ -101,12 +105,24 @@ int osd_get_num_processors(bool heavy_mt)
 //  TYPE DEFINITIONS
 //============================================================
 
+// all queues share one pool of worker threads; a queue's flags choose
+// the priority class its items are run at
+enum work_priority
+{
+	WORK_PRIORITY_REALTIME = 0,     // high frequency queues: video and audio rendering
+	WORK_PRIORITY_NORMAL,           // everything else
+	WORK_PRIORITY_BACKGROUND,       // I/O queues; these may block, so can't have every worker
+	WORK_PRIORITY_COUNT
+};
+
+
+struct work_pool;
+
 struct work_thread_info
 {
-	work_thread_info(uint32_t aid, osd_work_queue &aqueue)
-	: queue(aqueue)
+	work_thread_info(uint32_t aid)
+	: pool(nullptr)
 	, handle(nullptr)
-	, wakeevent(true, false)  // manual reset, not signalled
 	, id(aid)
 #if KEEP_STATISTICS
 	, itemsdone(0)
@@ -117,9 +133,10 @@ struct work_thread_info
 #endif
 	{
 	}
-	osd_work_queue &    queue;          // pointer back to the queue
+	std::mutex          lock;           // lock protecting the pending lists
+	std::deque<osd_work_queue *> pending[WORK_PRIORITY_COUNT]; // queues with work posted to this thread
+	work_pool *         pool;           // pool the thread belongs to
 	std::thread *       handle;         // handle to the thread
-	osd_event           wakeevent;      // wake event for the thread
 	uint32_t              id;
 
 #if KEEP_STATISTICS
@@ -132,6 +149,35 @@ struct work_thread_info
 };
 
 
+struct work_pool
+{
+	work_pool()
+	: posted(0)
+	, sleeping(0)
+	, nextthread(0)
+	, background(0)
+	, backgroundlimit(1)
+	, exiting(false)
+	, refcount(0)
+	{
+		for (auto &count : postedprio)
+			count = 0;
+	}
+
+	std::vector<work_thread_info *> thread; // the workers
+	std::mutex          sleeplock;      // lock for sleeping and waking workers
+	std::condition_variable wake;       // signalled when work is posted
+	std::atomic<int32_t>  posted;         // work posted and not yet taken
+	std::atomic<int32_t>  postedprio[WORK_PRIORITY_COUNT]; // the same by priority
+	std::atomic<int32_t>  sleeping;       // workers waiting for work
+	std::atomic<uint32_t> nextthread;     // next worker to post work to
+	std::atomic<int32_t>  background;     // workers running background work
+	int32_t               backgroundlimit; // most workers background work may have
+	bool                exiting;        // should the workers exit? (protected by sleeplock)
+	int                 refcount;       // queues using the pool (protected by s_pool_lock)
+};
+
+
 struct osd_work_queue
 {
 	osd_work_queue()
@@ -139,11 +185,14 @@ struct osd_work_queue
 	, tailptr(nullptr)
 	, free(nullptr)
 	, items(0)
-	, livethreads(0)
+	, active(0)
+	, tokens(0)
 	, waiting(0)
-	, exiting(0)
 	, threads(0)
 	, flags(0)
+	, priority(WORK_PRIORITY_NORMAL)
+	, pool(nullptr)
+	, caller(0)
 	, doneevent(true, true)     // manual reset, signalled
 #if KEEP_STATISTICS
 	, itemsqueued(0)
@@ -159,12 +208,14 @@ struct osd_work_queue
 	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
 	std::atomic<osd_work_item *> free;  // free list of work items
 	std::atomic<int32_t>  items;          // items in the queue
-	std::atomic<int32_t>  livethreads;    // number of live threads
+	std::atomic<int32_t>  active;         // pool workers processing the queue
+	std::atomic<int32_t>  tokens;         // references to the queue held in pool pending lists
 	std::atomic<int32_t>  waiting;        // is someone waiting on the queue to complete?
-	std::atomic<int32_t>  exiting;        // should the threads exit on their next opportunity?
-	uint32_t              threads;        // number of threads in this queue
+	uint32_t              threads;        // most pool workers that may process the queue at once
 	uint32_t              flags;          // creation flags
-	std::vector<work_thread_info *>  thread;         // array of thread information
+	work_priority       priority;       // priority class for the queue's items
+	work_pool *         pool;           // shared workers, or nullptr if run on the caller
+	work_thread_info    caller;         // statistics and thread ID for the calling thread
 	osd_event           doneevent;      // event signalled when work is complete
 
 #if KEEP_STATISTICS
@@ -185,8 +236,10 @@ struct osd_work_item
 	, param(nullptr)
 	, result(nullptr)
 	, event(nullptr)                // manual reset, not signalled
+	, then(nullptr)
 	, flags(0)
 	, done(false)
+	, dependencies(0)
 	{
 	}
 
@@ -196,8 +249,10 @@ struct osd_work_item
 	void *              param;          // callback parameter
 	void *              result;         // callback result
 	osd_event *         event;          // event signalled when complete
+	osd_work_item *     then;           // continuation waiting on this item
 	uint32_t              flags;          // creation flags
 	std::atomic<int32_t>  done;           // is the item done?
+	std::atomic<int32_t>  dependencies;   // items that must finish before this is queued
 };
 
 //============================================================
@@ -206,13 +261,21 @@ struct osd_work_item
 
 int osd_num_processors = 0;
 
+static std::mutex s_pool_lock;
+static work_pool *s_pool = nullptr;
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
 
 static int effective_num_processors(bool heavy_mt);
+static work_pool *pool_acquire();
+static void pool_release(work_pool *pool);
+static void pool_post(work_pool *pool, osd_work_queue *queue, int count);
 static void * worker_thread_entry(void *param);
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
+static bool worker_thread_process(osd_work_queue *queue, work_thread_info *thread, work_pool *preempt);
+static osd_work_item *work_item_alloc(osd_work_queue *queue);
+static void work_item_enqueue(osd_work_queue *queue, osd_work_item *itemlist, osd_work_item **item_tailptr, int32_t numitems);
 static bool queue_has_list_items(osd_work_queue *queue);
 
 //============================================================
@@ -243,6 +306,23 @@ int thread_adjust_priority(std::thread *thread, int adjust)
 	return true;
 }
 
+//============================================================
+//  thread_pin_to_processor
+//============================================================
+
+static void thread_pin_to_processor(std::thread *thread, unsigned processor)
+{
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	if (processor < (sizeof(DWORD_PTR) * 8))
+		SetThreadAffinityMask((HANDLE)thread->native_handle(), DWORD_PTR(1) << processor);
+#elif defined(SDLMAME_LINUX)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(processor, &set);
+	pthread_setaffinity_np(thread->native_handle(), sizeof(set), &set);
+#endif
+}
+
 //============================================================
 //  osd_work_queue_alloc
 //============================================================
@@ -253,7 +333,6 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	int numprocs = effective_num_processors(!(flags & WORK_QUEUE_FLAG_HIGH_FREQ));
 	osd_work_queue *queue;
 	int osdthreadnum = 0;
-	int allocthreadnum;
 	const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
 
 	// allocate a new queue
@@ -262,12 +341,18 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	// initialize basic queue members
 	queue->tailptr = (osd_work_item **)&queue->list;
 	queue->flags = flags;
+	if (flags & WORK_QUEUE_FLAG_HIGH_FREQ)
+		queue->priority = WORK_PRIORITY_REALTIME;
+	else if (flags & WORK_QUEUE_FLAG_IO)
+		queue->priority = WORK_PRIORITY_BACKGROUND;
+	else
+		queue->priority = WORK_PRIORITY_NORMAL;
 
-	// determine how many threads to create...
-	// on a single-CPU system, create 1 thread for I/O queues, and 0 threads for everything else
+	// determine how many workers may run the queue's items at once...
+	// on a single-CPU system, use 1 thread for I/O queues, and 0 threads for everything else
 	if (numprocs == 1)
 		threadnum = (flags & WORK_QUEUE_FLAG_IO) ? 1 : 0;
-	// on an n-CPU system, create n-1 threads for multi queues, and 1 thread for everything else
+	// on an n-CPU system, use n-1 threads for multi queues, and 1 thread for everything else
 	else
 		threadnum = (flags & WORK_QUEUE_FLAG_MULTI) ? (numprocs - 1) : 1;
 
@@ -279,50 +364,27 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	threadnum = 0;
 #endif
 
-	// clamp to the maximum
-	queue->threads = std::min(threadnum, WORK_MAX_THREADS);
+	// attach to the shared workers, and clamp to how many there are
+	if (threadnum > 0)
+	{
+		queue->pool = pool_acquire();
+		threadnum = std::min<int>(threadnum, queue->pool->thread.size());
+	}
+	queue->threads = std::max(threadnum, 0);
 
-	// allocate memory for thread array (+1 to count the calling thread if WORK_QUEUE_FLAG_MULTI)
-	if (flags & WORK_QUEUE_FLAG_MULTI)
-		allocthreadnum = queue->threads + 1;
-	else
-		allocthreadnum = std::max(queue->threads, 1u);
+	// the calling thread gets the ID after the last worker when it helps out
+	queue->caller.id = queue->pool ? queue->pool->thread.size() : 0;
 
 #if KEEP_STATISTICS
-	printf("osdprocs: %d effecprocs: %d threads: %d allocthreads: %d osdthreads: %d maxthreads: %d queuethreads: %d\n", osd_num_processors, numprocs, threadnum, allocthreadnum, osdthreadnum, WORK_MAX_THREADS, queue->threads);
+	printf("osdprocs: %d effecprocs: %d threads: %d osdthreads: %d maxthreads: %d queuethreads: %d\n", osd_num_processors, numprocs, threadnum, osdthreadnum, WORK_MAX_THREADS, queue->threads);
 #endif
 
-	for (threadnum = 0; threadnum < allocthreadnum; threadnum++)
-		queue->thread.push_back(new work_thread_info(threadnum, *queue));
-
-	// iterate over threads
-	for (threadnum = 0; threadnum < queue->threads; threadnum++)
-	{
-		work_thread_info *thread = queue->thread[threadnum];
-
-		// create the thread
-		thread->handle = new std::thread(worker_thread_entry, thread);
-		if (thread->handle == nullptr)
-			goto error;
-
-		// set its priority: I/O threads get high priority because they are assumed to be
-		// blocked most of the time; other threads just match the creator's priority
-		if (flags & WORK_QUEUE_FLAG_IO)
-			thread_adjust_priority(thread->handle, 1);
-		else
-			thread_adjust_priority(thread->handle, 0);
-	}
-
 	// start a timer going for "waittime" on the main thread
 	if (flags & WORK_QUEUE_FLAG_MULTI)
 	{
-		begin_timing(queue->thread[queue->threads]->waittime);
+		begin_timing(queue->caller.waittime);
 	}
 	return queue;
-
-error:
-	osd_work_queue_free(queue);
-	return nullptr;
 }
 
 
@@ -354,12 +416,12 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 	// if this is a multi queue, help out rather than doing nothing
 	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
 	{
-		work_thread_info *thread = queue->thread[queue->threads];
+		work_thread_info *thread = &queue->caller;
 
 		end_timing(thread->waittime);
 
 		// process what we can as a worker thread
-		worker_thread_process(queue, thread);
+		worker_thread_process(queue, thread, nullptr);
 
 		// if we're a high frequency queue, spin until done
 		if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue->items != 0)
@@ -375,11 +437,20 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 		begin_timing(thread->waittime);
 	}
 
-	// reset our done event and double-check the items before waiting
-	queue->doneevent.reset();
+	// reset our done event and double-check the items before waiting; with
+	// several workers, one running out of items doesn't mean all are done
+	osd_ticks_t const stopends = osd_ticks() + timeout;
 	queue->waiting = true;
-	if (queue->items != 0)
-		queue->doneevent.wait(timeout);
+	while (true)
+	{
+		queue->doneevent.reset();
+		if (queue->items == 0)
+			break;
+		osd_ticks_t const now = osd_ticks();
+		if (now >= stopends)
+			break;
+		queue->doneevent.wait(stopends - now);
+	}
 	queue->waiting = false;
 
 	// return true if we actually hit 0
@@ -396,38 +467,46 @@ void osd_work_queue_free(osd_work_queue *queue)
 	// stop the timer for "waittime" on the main thread
 	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
 	{
-		end_timing(queue->thread[queue->threads]->waittime);
+		end_timing(queue->caller.waittime);
 	}
 
-	// signal all the threads to exit
-	queue->exiting = true;
-	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
+	// the workers are shared, so let them finish what was queued here
+	if (queue->pool != nullptr)
 	{
-		work_thread_info *thread = queue->thread[threadnum];
-		thread->wakeevent.set();
-	}
-
-	// wait for all the threads to go away
-	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
-	{
-		work_thread_info *thread = queue->thread[threadnum];
+		while (!osd_work_queue_wait(queue, 100 * osd_ticks_per_second()))
+		{
+		}
 
-		// block on the thread going away, then close the handle
-		if (thread->handle != nullptr)
+		// drop anything still pointing here from the pending lists, and wait
+		// for workers that already picked the queue up to let go of it
+		for (work_thread_info *thread : queue->pool->thread)
 		{
-			thread->handle->join();
-			delete thread->handle;
+			std::lock_guard<std::mutex> lock(thread->lock);
+			for (int priority = 0; priority < WORK_PRIORITY_COUNT; priority++)
+			{
+				std::deque<osd_work_queue *> &pending = thread->pending[priority];
+				auto const found = std::remove(pending.begin(), pending.end(), queue);
+				int32_t const removed = pending.end() - found;
+				pending.erase(found, pending.end());
+				queue->pool->posted -= removed;
+				queue->pool->postedprio[priority] -= removed;
+				queue->tokens -= removed;
+			}
 		}
+		while (queue->tokens != 0)
+			std::this_thread::yield();
 
+		pool_release(queue->pool);
+		queue->pool = nullptr;
 	}
 
 #if KEEP_STATISTICS
-	// output per-thread statistics
-	for (work_thread_info *thread : queue->thread)
+	// output statistics for the calling thread
 	{
+		work_thread_info *thread = &queue->caller;
 		osd_ticks_t total = thread->runtime + thread->waittime + thread->spintime;
-		printf("Thread %d:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
-				thread->id, thread->itemsdone,
+		printf("Caller:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
+				thread->itemsdone,
 				(double)thread->runtime * 100.0 / (double)total,
 				(double)thread->actruntime * 100.0 / (double)total,
 				(double)thread->spintime * 100.0 / (double)total,
@@ -436,11 +515,6 @@ void osd_work_queue_free(osd_work_queue *queue)
 	}
 #endif
 
-	// free the list
-	for (auto & th : queue->thread)
-		delete th;
-	queue->thread.clear();
-
 	// free all items in the free list
 	while (queue->free.load() != nullptr)
 	{
@@ -484,35 +558,13 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 	// loop over items, building up a local list of work
 	for (itemnum = 0; itemnum < numitems; itemnum++)
 	{
-		osd_work_item *item;
-
-		// first allocate a new work item; try the free list first
-		{
-			std::lock_guard<std::mutex> lock(queue->lock);
-			do
-			{
-				item = (osd_work_item *)queue->free;
-			} while (item != nullptr && !queue->free.compare_exchange_weak(item, item->next, std::memory_order_release, std::memory_order_relaxed));
-		}
-
-		// if nothing, allocate something new
+		osd_work_item *item = work_item_alloc(queue);
 		if (item == nullptr)
-		{
-			// allocate the item
-			item = new osd_work_item(*queue);
-			if (item == nullptr)
-				return nullptr;
-		}
-		else
-		{
-			item->done = false; // needs to be set this way to prevent data race/usage of uninitialized memory on Linux
-		}
+			return nullptr;
 
 		// fill in the basics
-		item->next = nullptr;
 		item->callback = callback;
 		item->param = parambase;
-		item->result = nullptr;
 		item->flags = flags;
 
 		// advance to the next
@@ -522,48 +574,61 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		parambase = (uint8_t *)parambase + paramstep;
 	}
 
-	// enqueue the whole thing within the critical section
-	{
-		std::lock_guard<std::mutex> lock(queue->lock);
-		*queue->tailptr = itemlist;
-		queue->tailptr = item_tailptr;
-	}
-
-	// increment the number of items in the queue
+	// increment the number of items in the queue, then hand them out
 	queue->items += numitems;
 	add_to_stat(queue->itemsqueued, numitems);
+	work_item_enqueue(queue, itemlist, item_tailptr, numitems);
 
-	// look for free threads to do the work
-	if (queue->livethreads < queue->threads)
-	{
-		int threadnum;
+	// only return the item if it won't get released automatically
+	return (flags & WORK_ITEM_FLAG_AUTO_RELEASE) ? nullptr : lastitem;
+}
 
-		// iterate over all the threads
-		for (threadnum = 0; threadnum < queue->threads; threadnum++)
-		{
-			work_thread_info *thread = queue->thread[threadnum];
 
-			// Attempt to wake the thread
-			if (thread->wakeevent.set())
-			{
-				add_to_stat(queue->setevents, 1);
+//============================================================
+//  osd_work_item_queue_multiple_then
+//============================================================
 
-				// for non-shared, the first one we find is good enough
-				if (--numitems == 0)
-					break;
-			}
-		}
+osd_work_item *osd_work_item_queue_multiple_then(osd_work_queue *queue, osd_work_callback callback, int32_t numitems, void *parambase, int32_t paramstep, osd_work_callback continuation, void *contparam, uint32_t flags)
+{
+	// the continuation is counted as queued now, so waiting on the queue covers it
+	osd_work_item *const then = work_item_alloc(queue);
+	if (then == nullptr)
+		return nullptr;
+	then->callback = continuation;
+	then->param = contparam;
+	then->flags = flags;
+	then->dependencies = std::max(numitems, 0);
+	++queue->items;
+	add_to_stat(queue->itemsqueued, 1);
+
+	// nothing to wait for, so it can go straight away
+	if (numitems <= 0)
+	{
+		work_item_enqueue(queue, then, &then->next, 1);
+		return (flags & WORK_ITEM_FLAG_AUTO_RELEASE) ? nullptr : then;
 	}
 
-	// if no threads, run the queue now on this thread
-	if (queue->threads == 0)
+	// the items themselves can't be waited on, so they release themselves
+	osd_work_item *itemlist = nullptr;
+	osd_work_item **item_tailptr = &itemlist;
+	for (int itemnum = 0; itemnum < numitems; itemnum++)
 	{
-		end_timing(queue->thread[0]->waittime);
-		worker_thread_process(queue, queue->thread[0]);
-		begin_timing(queue->thread[0]->waittime);
+		osd_work_item *item = work_item_alloc(queue);
+		if (item == nullptr)
+			return nullptr;
+		item->callback = callback;
+		item->param = parambase;
+		item->flags = flags | WORK_ITEM_FLAG_AUTO_RELEASE;
+		item->then = then;
+		*item_tailptr = item;
+		item_tailptr = &item->next;
+		parambase = (uint8_t *)parambase + paramstep;
 	}
-	// only return the item if it won't get released automatically
-	return (flags & WORK_ITEM_FLAG_AUTO_RELEASE) ? nullptr : lastitem;
+
+	queue->items += numitems;
+	add_to_stat(queue->itemsqueued, numitems);
+	work_item_enqueue(queue, itemlist, item_tailptr, numitems);
+	return (flags & WORK_ITEM_FLAG_AUTO_RELEASE) ? nullptr : then;
 }
 
 
@@ -663,59 +728,282 @@ static int effective_num_processors(bool heavy_mt)
 
 
 //============================================================
-//  worker_thread_entry
+//  pool_acquire - get the shared workers,
+//  starting them if this is the first queue
 //============================================================
 
-static void *worker_thread_entry(void *param)
+static work_pool *pool_acquire()
 {
-	auto *thread = (work_thread_info *)param;
-	osd_work_queue &queue = thread->queue;
+	std::lock_guard<std::mutex> lock(s_pool_lock);
+	if (s_pool == nullptr)
+	{
+		// one worker per processor, leaving one for the emulation thread
+		int const numprocs = effective_num_processors(true);
+		int const numthreads = std::clamp(numprocs - 1, 1, WORK_MAX_THREADS - 1);
 
-	// loop until we exit
+		s_pool = new work_pool();
+		for (int threadnum = 0; threadnum < numthreads; threadnum++)
+		{
+			s_pool->thread.push_back(new work_thread_info(threadnum));
+			s_pool->thread.back()->pool = s_pool;
+		}
+
+		// blocking I/O may tie up at most half the workers
+		s_pool->backgroundlimit = std::max(numthreads / 2, 1);
+
+		// keep the workers off the first processor, where the emulation thread is
+		// most likely to run, unless that's been turned off
+		const char *pin = osd_getenv(ENV_WORKQUEUEPIN);
+		unsigned const hwprocs = std::thread::hardware_concurrency();
+		bool const pinning = (hwprocs > 1) && (numthreads < int(hwprocs)) && (pin == nullptr || atoi(pin) != 0);
+
+		for (work_thread_info *thread : s_pool->thread)
+		{
+			thread->handle = new std::thread(worker_thread_entry, thread);
+			thread_adjust_priority(thread->handle, 0);
+			if (pinning)
+				thread_pin_to_processor(thread->handle, thread->id + 1);
+		}
+	}
+	++s_pool->refcount;
+	return s_pool;
+}
+
+
+//============================================================
+//  pool_release - stop the shared workers once
+//  the last queue is gone
+//============================================================
+
+static void pool_release(work_pool *pool)
+{
+	std::lock_guard<std::mutex> lock(s_pool_lock);
+	if (--pool->refcount != 0)
+		return;
+
+	{
+		std::lock_guard<std::mutex> sleeplock(pool->sleeplock);
+		pool->exiting = true;
+	}
+	pool->wake.notify_all();
+
+#if KEEP_STATISTICS
+	// output per-thread statistics
+	for (work_thread_info *thread : pool->thread)
+	{
+		thread->handle->join();
+		osd_ticks_t total = thread->runtime + thread->waittime + thread->spintime;
+		printf("Thread %d:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
+				thread->id, thread->itemsdone,
+				(double)thread->runtime * 100.0 / (double)total,
+				(double)thread->actruntime * 100.0 / (double)total,
+				(double)thread->spintime * 100.0 / (double)total,
+				(double)thread->waittime * 100.0 / (double)total,
+				(uint32_t) total);
+	}
+#endif
+
+	// workers steal from each other, so they all have to stop before any go
+	for (work_thread_info *thread : pool->thread)
+	{
+		if (thread->handle->joinable())
+			thread->handle->join();
+	}
+	for (work_thread_info *thread : pool->thread)
+	{
+		delete thread->handle;
+		delete thread;
+	}
+	if (s_pool == pool)
+		s_pool = nullptr;
+	delete pool;
+}
+
+
+//============================================================
+//  pool_post - tell the workers a queue has work,
+//  spreading it across their pending lists
+//============================================================
+
+static void pool_post(work_pool *pool, osd_work_queue *queue, int count)
+{
+	int const numthreads = pool->thread.size();
+	uint32_t const first = pool->nextthread.fetch_add(count);
+	for (int i = 0; i < count; i++)
+	{
+		work_thread_info *thread = pool->thread[(first + i) % numthreads];
+		++queue->tokens;
+		std::lock_guard<std::mutex> lock(thread->lock);
+		thread->pending[queue->priority].push_back(queue);
+	}
+	pool->postedprio[queue->priority] += count;
+	pool->posted += count;
+
+	// wake sleepers; checking under the lock means a worker can't miss this
+	// between seeing nothing posted and going to sleep
+	std::lock_guard<std::mutex> lock(pool->sleeplock);
+	if (pool->sleeping > 0)
+	{
+		if (count == 1)
+			pool->wake.notify_one();
+		else
+			pool->wake.notify_all();
+	}
+}
+
+
+//============================================================
+//  pool_take - find the most urgent posted work,
+//  looking in our own list before stealing
+//============================================================
+
+static osd_work_queue *pool_take(work_pool *pool, work_thread_info *self)
+{
+	int const numthreads = pool->thread.size();
+	for (int priority = 0; priority < WORK_PRIORITY_COUNT; priority++)
+	{
+		if (pool->postedprio[priority] <= 0)
+			continue;
+
+		// don't let background work take every worker
+		bool const background = (priority == WORK_PRIORITY_BACKGROUND);
+		if (background && (pool->background.fetch_add(1) >= pool->backgroundlimit))
+		{
+			--pool->background;
+			continue;
+		}
+
+		// our own list oldest first, then steal the newest from the others
+		for (int i = 0; i < numthreads; i++)
+		{
+			work_thread_info *victim = pool->thread[(self->id + i) % numthreads];
+			std::lock_guard<std::mutex> lock(victim->lock);
+			std::deque<osd_work_queue *> &pending = victim->pending[priority];
+			if (!pending.empty())
+			{
+				osd_work_queue *queue;
+				if (i == 0)
+				{
+					queue = pending.front();
+					pending.pop_front();
+				}
+				else
+				{
+					queue = pending.back();
+					pending.pop_back();
+				}
+				--pool->postedprio[priority];
+				--pool->posted;
+				return queue;
+			}
+		}
+
+		if (background)
+			--pool->background;
+	}
+	return nullptr;
+}
+
+
+//============================================================
+//  worker_thread_run - process a queue taken from
+//  the pending lists
+//============================================================
+
+static void worker_thread_run(work_pool *pool, work_thread_info *thread, osd_work_queue *queue)
+{
+	// claim one of the queue's slots; if they're all taken, whoever has them
+	// will look for more work before letting go, so there's nothing to do
 	for ( ;; )
 	{
-		// block waiting for work or exit
-		// bail on exit, and only wait if there are no pending items in queue
-		if (queue.exiting)
+		int32_t active = queue->active;
+		bool claimed = false;
+		while (active < int32_t(queue->threads))
+		{
+			if (queue->active.compare_exchange_weak(active, active + 1))
+			{
+				claimed = true;
+				break;
+			}
+		}
+		if (!claimed)
 			break;
 
-		if (!queue_has_list_items(&queue))
+		// process until the queue is empty or something more urgent turns up
+		bool const preempted = worker_thread_process(queue, thread, pool);
+		--queue->active;
+
+		if (preempted)
 		{
-			begin_timing(thread->waittime);
-			thread->wakeevent.wait( OSD_EVENT_WAIT_INFINITE);
-			end_timing(thread->waittime);
+			// put the queue back so the rest of its work gets picked up later
+			if (queue_has_list_items(queue))
+				pool_post(pool, queue, 1);
+			break;
 		}
 
-		if (queue.exiting)
+		// make sure nothing arrived just as we let go
+		if (!queue_has_list_items(queue))
 			break;
+	}
+
+	if (queue->priority == WORK_PRIORITY_BACKGROUND)
+		--pool->background;
+
+	// this was our last look at the queue
+	--queue->tokens;
+}
 
-		// indicate that we are live
-		++queue.livethreads;
 
-		// process work items
-		for ( ;; )
+//============================================================
+//  worker_thread_entry
+//============================================================
+
+static void *worker_thread_entry(void *param)
+{
+	auto *thread = (work_thread_info *)param;
+	work_pool *const pool = thread->pool;
+
+	osd_trace_set_thread_name("work queue");
+
+	// loop until we exit
+	for ( ;; )
+	{
+		osd_work_queue *queue = pool_take(pool, thread);
+		if (queue != nullptr)
 		{
-			// process as much as we can
-			worker_thread_process(&queue, thread);
+			bool const realtime = (queue->priority == WORK_PRIORITY_REALTIME);
+			worker_thread_run(pool, thread, queue);
 
-			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
+			// high frequency work tends to come in bursts, so spin for a while before giving up
+			if (realtime && pool->posted <= 0)
 			{
-				// spin for a while looking for more work
 				begin_timing(thread->spintime);
-				spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
+				spin_while<std::atomic<int32_t>, int32_t>(&pool->posted, 0, SPIN_LOOP_TIME);
 				end_timing(thread->spintime);
 			}
-
-			// if nothing more, release the processor
-			if (!queue_has_list_items(&queue))
-				break;
-			add_to_stat(queue.spinloops, 1);
+			continue;
 		}
 
-		// decrement the live thread count
-		thread->wakeevent.reset();
-		--queue.livethreads;
+		// block waiting for work or exit
+		std::unique_lock<std::mutex> lock(pool->sleeplock);
+		if (pool->exiting)
+			break;
+		if (pool->posted <= 0)
+		{
+			begin_timing(thread->waittime);
+			++pool->sleeping;
+			pool->wake.wait(lock);
+			--pool->sleeping;
+			end_timing(thread->waittime);
+		}
+		else
+		{
+			// only background work is left and it already has all the workers
+			// it's allowed, so wait for some to finish
+			++pool->sleeping;
+			pool->wake.wait_for(lock, std::chrono::milliseconds(1));
+			--pool->sleeping;
+		}
 	}
 
 	return nullptr;
@@ -726,9 +1014,10 @@ static void *worker_thread_entry(void *param)
 //  worker_thread_process
 //============================================================
 
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread)
+static bool worker_thread_process(osd_work_queue *queue, work_thread_info *thread, work_pool *preempt)
 {
 	int threadid = thread->id;
+	bool preempted = false;
 
 	begin_timing(thread->runtime);
 
@@ -768,9 +1057,16 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 		{
 			// call the callback and stash the result
 			begin_timing(thread->actruntime);
+			osd_trace_begin("work item");
 			item->result = (*item->callback)(item->param, threadid);
+			osd_trace_end();
 			end_timing(thread->actruntime);
 
+			// queue the continuation once everything it depends on is done
+			osd_work_item *const then = item->then;
+			if (then != nullptr && --then->dependencies == 0)
+				work_item_enqueue(queue, then, &then->next, 1);
+
 			// decrement the item count after we are done
 			--queue->items;
 			item->done = true;
@@ -795,6 +1091,18 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 			// if we removed an item and there's still work to do, bump the stats
 			if (queue_has_list_items(queue))
 				add_to_stat(queue->extraitems, 1);
+
+			// pool workers give way to more urgent work between items
+			if (preempt != nullptr)
+			{
+				for (int priority = 0; priority < queue->priority; priority++)
+				{
+					if (preempt->postedprio[priority] > 0)
+						preempted = true;
+				}
+				if (preempted)
+					break;
+			}
 		}
 	}
 
@@ -806,6 +1114,77 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 	}
 
 	end_timing(thread->runtime);
+	return preempted;
+}
+
+
+//============================================================
+//  work_item_alloc - get a blank work item,
+//  reusing one from the free list if possible
+//============================================================
+
+static osd_work_item *work_item_alloc(osd_work_queue *queue)
+{
+	osd_work_item *item;
+
+	// first try the free list
+	{
+		std::lock_guard<std::mutex> lock(queue->lock);
+		do
+		{
+			item = (osd_work_item *)queue->free;
+		} while (item != nullptr && !queue->free.compare_exchange_weak(item, item->next, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	// if nothing, allocate something new
+	if (item == nullptr)
+	{
+		item = new osd_work_item(*queue);
+		if (item == nullptr)
+			return nullptr;
+	}
+	else
+	{
+		item->done = false; // needs to be set this way to prevent data race/usage of uninitialized memory on Linux
+	}
+
+	item->next = nullptr;
+	item->result = nullptr;
+	item->then = nullptr;
+	item->dependencies = 0;
+	return item;
+}
+
+
+//============================================================
+//  work_item_enqueue - add already counted items
+//  to a queue and get them processed
+//============================================================
+
+static void work_item_enqueue(osd_work_queue *queue, osd_work_item *itemlist, osd_work_item **item_tailptr, int32_t numitems)
+{
+	// enqueue the whole thing within the critical section
+	{
+		std::lock_guard<std::mutex> lock(queue->lock);
+		*queue->tailptr = itemlist;
+		queue->tailptr = item_tailptr;
+	}
+
+	// let workers know, but no more than can work on the queue at once
+	if (queue->threads != 0)
+	{
+		int const count = std::min<int32_t>(numitems, queue->threads - queue->active);
+		if (count > 0)
+			pool_post(queue->pool, queue, count);
+	}
+
+	// if no threads, run the queue now on this thread
+	else
+	{
+		end_timing(queue->caller.waittime);
+		worker_thread_process(queue, &queue->caller, nullptr);
+		begin_timing(queue->caller.waittime);
+	}
 }
 
 bool queue_has_list_items(osd_work_queue *queue)
@@ -0,0 +1,256 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+//============================================================
+//
+//  osdtrace.cpp - Timeline event tracing
+//
+//============================================================
+
+#include "osdtrace.h"
+
+#ifdef MAME_TRACE
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+//============================================================
+//  CONSTANTS
+//============================================================
+
+// events per thread; must be a power of two
+#define TRACE_RING_SIZE         (65536)
+
+// events closest to being overwritten are not trusted by a dump
+#define TRACE_RING_SLACK        (1024)
+
+
+//============================================================
+//  TYPE DEFINITIONS
+//============================================================
+
+namespace {
+
+struct trace_event
+{
+	std::atomic<osd_ticks_t>    time;
+	std::atomic<const char *>   name;           // nullptr for an end event
+};
+
+struct trace_ring
+{
+	trace_ring(unsigned i, const char *n) : id(i), name(n), head(0) { }
+
+	unsigned const              id;
+	std::atomic<const char *>   name;
+	std::atomic<uint64_t>       head;           // total events ever recorded
+	trace_event                 events[TRACE_RING_SIZE];
+};
+
+struct trace_snapshot_event
+{
+	osd_ticks_t     time;
+	const char *    name;
+};
+
+} // anonymous namespace
+
+
+//============================================================
+//  GLOBAL VARIABLES
+//============================================================
+
+std::atomic<bool> g_osd_trace_enabled(false);
+
+static std::atomic<osd_ticks_t> s_enabled_since(0);        // names recorded earlier may be gone
+
+static std::mutex s_rings_lock;
+static std::vector<std::unique_ptr<trace_ring> > s_rings;  // never freed, so events outlive their threads
+
+static thread_local trace_ring *t_ring = nullptr;
+static thread_local const char *t_thread_name = nullptr;
+
+
+//============================================================
+//  get_ring - get the calling thread's ring,
+//  creating it on first use
+//============================================================
+
+static trace_ring *get_ring()
+{
+	if (t_ring == nullptr)
+	{
+		std::lock_guard<std::mutex> lock(s_rings_lock);
+		s_rings.emplace_back(std::make_unique<trace_ring>(unsigned(s_rings.size() + 1), t_thread_name));
+		t_ring = s_rings.back().get();
+	}
+	return t_ring;
+}
+
+
+//============================================================
+//  osd_trace_record
+//============================================================
+
+void osd_trace_record(const char *name) noexcept
+{
+	trace_ring *const ring = (t_ring != nullptr) ? t_ring : get_ring();
+
+	// only this thread writes, so the head can be updated without a read-modify-write
+	uint64_t const head = ring->head.load(std::memory_order_relaxed);
+	trace_event &event = ring->events[head & (TRACE_RING_SIZE - 1)];
+	event.time.store(osd_ticks(), std::memory_order_relaxed);
+	event.name.store(name, std::memory_order_relaxed);
+	ring->head.store(head + 1, std::memory_order_release);
+}
+
+
+//============================================================
+//  osd_trace_enable
+//============================================================
+
+void osd_trace_enable(bool enable)
+{
+	if (enable && !g_osd_trace_enabled.load(std::memory_order_relaxed))
+		s_enabled_since.store(osd_ticks(), std::memory_order_relaxed);
+	g_osd_trace_enabled.store(enable, std::memory_order_relaxed);
+}
+
+
+//============================================================
+//  osd_trace_set_thread_name
+//============================================================
+
+void osd_trace_set_thread_name(const char *name)
+{
+	t_thread_name = name;
+	if (t_ring != nullptr)
+		t_ring->name.store(name, std::memory_order_relaxed);
+}
+
+
+//============================================================
+//  snapshot_ring - copy the trustworthy part of
+//  a ring and balance its begin/end events
+//============================================================
+
+static std::vector<trace_snapshot_event> snapshot_ring(trace_ring &ring, osd_ticks_t since)
+{
+	std::vector<trace_snapshot_event> result;
+
+	uint64_t const head = ring.head.load(std::memory_order_acquire);
+	uint64_t const available = std::min<uint64_t>(head, TRACE_RING_SIZE - TRACE_RING_SLACK);
+	result.reserve(available);
+	for (uint64_t index = head - available; index < head; index++)
+	{
+		trace_event const &event = ring.events[index & (TRACE_RING_SIZE - 1)];
+		result.push_back(trace_snapshot_event{ event.time.load(std::memory_order_relaxed), event.name.load(std::memory_order_relaxed) });
+	}
+
+	// anything the writer lapped while we were copying is unreliable
+	uint64_t const after = ring.head.load(std::memory_order_acquire);
+	if (after - (head - available) > TRACE_RING_SIZE)
+		result.erase(result.begin(), result.begin() + std::min<uint64_t>(available, after - (head - available) - TRACE_RING_SIZE));
+
+	// trim to the window and drop end events whose begin was lost
+	std::vector<trace_snapshot_event> balanced;
+	balanced.reserve(result.size());
+	unsigned depth = 0;
+	for (trace_snapshot_event const &event : result)
+	{
+		if (event.time < since)
+			continue;
+		if (event.name != nullptr)
+			depth++;
+		else if (depth == 0)
+			continue;
+		else
+			depth--;
+		balanced.push_back(event);
+	}
+	return balanced;
+}
+
+
+//============================================================
+//  write_string - write a JSON string
+//============================================================
+
+static void write_string(std::FILE *file, const char *str)
+{
+	std::fputc('"', file);
+	for ( ; *str != 0; str++)
+	{
+		if (*str == '"' || *str == '\\')
+			std::fputc('\\', file);
+		if (uint8_t(*str) >= 0x20)
+			std::fputc(*str, file);
+	}
+	std::fputc('"', file);
+}
+
+
+//============================================================
+//  osd_trace_write
+//============================================================
+
+bool osd_trace_write(std::string_view filename, double seconds)
+{
+	osd_ticks_t const now = osd_ticks();
+	osd_ticks_t const tps = osd_ticks_per_second();
+	osd_ticks_t const window = osd_ticks_t(seconds * double(tps));
+	osd_ticks_t const since = std::max((seconds > 0.0 && window < now) ? (now - window) : 0, s_enabled_since.load(std::memory_order_relaxed));
+
+	// take what we can from every ring before doing any I/O
+	std::vector<std::pair<trace_ring *, std::vector<trace_snapshot_event> > > snapshots;
+	{
+		std::lock_guard<std::mutex> lock(s_rings_lock);
+		for (auto &ring : s_rings)
+			snapshots.emplace_back(ring.get(), snapshot_ring(*ring, since));
+	}
+
+	osd_ticks_t origin = now;
+	for (auto &snapshot : snapshots)
+		if (!snapshot.second.empty())
+			origin = std::min(origin, snapshot.second.front().time);
+
+	std::FILE *const file = std::fopen(std::string(filename).c_str(), "w");
+	if (file == nullptr)
+		return false;
+
+	std::fputs("{\"traceEvents\":[\n", file);
+	bool first = true;
+	for (auto &snapshot : snapshots)
+	{
+		const char *const name = snapshot.first->name.load(std::memory_order_relaxed);
+		std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", first ? "" : ",\n", snapshot.first->id);
+		write_string(file, (name != nullptr) ? name : "thread");
+		std::fputs("}}", file);
+		first = false;
+
+		for (trace_snapshot_event const &event : snapshot.second)
+		{
+			double const usec = double(event.time - origin) * 1.0e6 / double(tps);
+			if (event.name != nullptr)
+			{
+				std::fputs(",\n{\"name\":", file);
+				write_string(file, event.name);
+				std::fprintf(file, ",\"ph\":\"B\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", snapshot.first->id, usec);
+			}
+			else
+			{
+				std::fprintf(file, ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", snapshot.first->id, usec);
+			}
+		}
+	}
+	std::fputs("\n],\"displayTimeUnit\":\"ms\"}\n", file);
+
+	bool const success = !std::ferror(file);
+	return (std::fclose(file) == 0) && success;
+}
+
+#endif // MAME_TRACE
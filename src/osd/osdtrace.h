@@ -0,0 +1,108 @@
+// license:BSD-3-Clause
+// copyright-holders:Aren-NES Team
+//============================================================
+//
+//  osdtrace.h - Timeline event tracing
+//
+//============================================================
+#ifndef MAME_OSD_OSDTRACE_H
+#define MAME_OSD_OSDTRACE_H
+
+#pragma once
+
+#include "osdcore.h"
+
+#include <atomic>
+#include <string_view>
+
+
+/***************************************************************************
+    EVENT TRACING
+
+    Begin/end events are recorded into a fixed-size ring buffer owned by
+    the calling thread, so recording takes no locks and old events are
+    overwritten.  Names must be strings with static storage duration (or
+    at least outlive the next dump), as only the pointer is stored.
+
+    Tracing is only compiled in when MAME_TRACE is defined; otherwise
+    every function below is an empty inline and costs nothing.
+***************************************************************************/
+
+#ifdef MAME_TRACE
+
+extern std::atomic<bool> g_osd_trace_enabled;
+
+void osd_trace_record(const char *name) noexcept;
+
+/*-----------------------------------------------------------------------------
+    osd_trace_enabled: check whether events are being recorded
+-----------------------------------------------------------------------------*/
+inline bool osd_trace_enabled() noexcept { return g_osd_trace_enabled.load(std::memory_order_relaxed); }
+
+/*-----------------------------------------------------------------------------
+    osd_trace_enable: start or stop recording events
+-----------------------------------------------------------------------------*/
+void osd_trace_enable(bool enable);
+
+/*-----------------------------------------------------------------------------
+    osd_trace_begin/osd_trace_end: record the start and end of a named
+    span on the calling thread; spans may be nested
+-----------------------------------------------------------------------------*/
+inline void osd_trace_begin(const char *name) noexcept { if (osd_trace_enabled()) osd_trace_record(name ? name : "unnamed"); }
+inline void osd_trace_end() noexcept { if (osd_trace_enabled()) osd_trace_record(nullptr); }
+
+/*-----------------------------------------------------------------------------
+    osd_trace_set_thread_name: name the calling thread in dumps
+
+    Parameters:
+
+        name - string with static storage duration
+-----------------------------------------------------------------------------*/
+void osd_trace_set_thread_name(const char *name);
+
+/*-----------------------------------------------------------------------------
+    osd_trace_write: write recorded events in Chrome trace event format,
+    suitable for about:tracing or Perfetto
+
+    Parameters:
+
+        filename - file to write
+
+        seconds - only write events from this many seconds before now,
+            or everything still in the buffers if zero
+
+    Return value:
+
+        true if the file was written successfully
+-----------------------------------------------------------------------------*/
+bool osd_trace_write(std::string_view filename, double seconds);
+
+#else // MAME_TRACE
+
+constexpr bool osd_trace_enabled() noexcept { return false; }
+inline void osd_trace_enable(bool enable) { }
+inline void osd_trace_begin(const char *name) noexcept { }
+inline void osd_trace_end() noexcept { }
+inline void osd_trace_set_thread_name(const char *name) { }
+inline bool osd_trace_write(std::string_view filename, double seconds) { return false; }
+
+#endif // MAME_TRACE
+
+
+/*-----------------------------------------------------------------------------
+    osd_trace_scope: record a span for the lifetime of the object
+-----------------------------------------------------------------------------*/
+class osd_trace_scope
+{
+public:
+	osd_trace_scope(const char *name) noexcept : m_active(osd_trace_enabled()) { if (m_active) osd_trace_begin(name); }
+	~osd_trace_scope() { if (m_active) osd_trace_end(); }
+
+	osd_trace_scope(const osd_trace_scope &) = delete;
+	osd_trace_scope &operator=(const osd_trace_scope &) = delete;
+
+private:
+	bool const m_active;
+};
+
+#endif // MAME_OSD_OSDTRACE_H
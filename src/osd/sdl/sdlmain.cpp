@@ -399,6 +399,14 @@ void sdl_osd_interface::init(running_machine &machine)
 		options().set_value(OSDOPTION_VIDEO, "none", OPTION_PRIORITY_MAXIMUM);
 		options().set_value(OPTION_SECONDS_TO_RUN, bench, OPTION_PRIORITY_MAXIMUM);
 	}
+	else if ((options().bench_startup() > 0) || *options().bench_manifest())
+	{
+		// run headless; the core decides when to exit
+		options().set_value(OPTION_SLEEP, false, OPTION_PRIORITY_MAXIMUM);
+		options().set_value(OPTION_THROTTLE, false, OPTION_PRIORITY_MAXIMUM);
+		options().set_value(OSDOPTION_SOUND, "none", OPTION_PRIORITY_MAXIMUM);
+		options().set_value(OSDOPTION_VIDEO, "none", OPTION_PRIORITY_MAXIMUM);
+	}
 
 	// Some driver options - must be before audio init!
 	stemp = options().audio_driver();
@@ -14,6 +14,7 @@
 #include "rendutil.h"
 #include "ui/uimain.h"
 #include "emuopts.h"
+#include "phasetrace.h"
 #include "uiinput.h"
 
 
@@ -54,6 +55,7 @@ static void get_resolution(const char *defdata, const char *data, osd_window_con
 
 bool sdl_osd_interface::video_init()
 {
+	phase_trace_scope scope("OSD window/renderer creation");
 	int index;
 
 	// extract data from the options
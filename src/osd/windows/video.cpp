@@ -12,6 +12,7 @@
 // MAME headers
 #include "emu.h"
 #include "emuopts.h"
+#include "phasetrace.h"
 #include "render.h"
 #include "uiinput.h"
 
@@ -51,6 +52,8 @@ static osd_window_config   windows[MAX_VIDEO_WINDOWS];        // configuration d
 
 bool windows_osd_interface::video_init()
 {
+	phase_trace_scope scope("OSD window/renderer creation");
+
 	// extract data from the options
 	extract_video_config();
 
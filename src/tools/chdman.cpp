@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <cctype>
+#include <chrono>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
@@ -66,6 +67,7 @@ const int MODE_GDI = 2;
 #define COMMAND_HELP "help"
 #define COMMAND_INFO "info"
 #define COMMAND_VERIFY "verify"
+#define COMMAND_BENCHMARK "benchmark"
 #define COMMAND_CREATE_RAW "createraw"
 #define COMMAND_CREATE_HD "createhd"
 #define COMMAND_CREATE_CD "createcd"
@@ -109,6 +111,7 @@ const int MODE_GDI = 2;
 #define OPTION_NUMPROCESSORS "numprocessors"
 #define OPTION_SIZE "size"
 #define OPTION_TEMPLATE "template"
+#define OPTION_READAHEAD "readahead"
 
 
 //**************************************************************************
@@ -120,6 +123,7 @@ typedef std::unordered_map<std::string, std::string *> parameters_map;
 template <typename Format, typename... Params> static void report_error(int error, Format &&fmt, Params &&...args);
 static void do_info(parameters_map &params);
 static void do_verify(parameters_map &params);
+static void do_benchmark(parameters_map &params);
 static void do_create_raw(parameters_map &params);
 static void do_create_hd(parameters_map &params);
 static void do_create_cd(parameters_map &params);
@@ -629,6 +633,7 @@ static const option_description s_options[] =
 	{ OPTION_VERBOSE,               "v",    false, ": output additional information" },
 	{ OPTION_SIZE,                  "s",    true, ": <bytes>: size of the output file" },
 	{ OPTION_TEMPLATE,              "tp",   true, ": <id>: use hard disk template (see listtemplates)" },
+	{ OPTION_READAHEAD,             "ra",   true, " <hunks>: number of hunks to decompress ahead of the reader" },
 };
 
 
@@ -649,6 +654,18 @@ static const command_description s_commands[] =
 		}
 	},
 
+	{ COMMAND_BENCHMARK, do_benchmark, ": times streaming reads from a CHD with and without read-ahead",
+		{
+			REQUIRED OPTION_INPUT,
+			OPTION_INPUT_PARENT,
+			OPTION_INPUT_START_BYTE,
+			OPTION_INPUT_START_HUNK,
+			OPTION_INPUT_LENGTH_BYTES,
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_READAHEAD
+		}
+	},
+
 	{ COMMAND_CREATE_RAW, do_create_raw, ": create a raw CHD from the input file",
 		{
 			REQUIRED OPTION_OUTPUT,
@@ -1665,6 +1682,86 @@ static void do_verify(parameters_map &params)
 }
 
 
+//-------------------------------------------------
+//  do_benchmark - time reading a CHD one unit at
+//  a time, the way an emulated drive does, with
+//  and without read-ahead
+//-------------------------------------------------
+
+static void do_benchmark(parameters_map &params)
+{
+	// parse out input files
+	chd_file input_parent_chd;
+	chd_file input_chd;
+	parse_input_chd_parameters(params, input_chd, input_parent_chd);
+
+	// determine the range to read
+	uint64_t input_start;
+	uint64_t input_end;
+	parse_input_start_end(params, input_chd.logical_bytes(), input_chd.hunk_bytes(), input_chd.hunk_bytes(), input_start, input_end);
+	if (input_start >= input_end)
+		report_error(1, "Nothing to read");
+
+	// determine how far to read ahead
+	uint32_t readahead = 8;
+	auto readahead_str = params.find(OPTION_READAHEAD);
+	if (readahead_str != params.end())
+		readahead = parse_number(readahead_str->second->c_str());
+	if (readahead == 0)
+		report_error(1, "Read-ahead must be at least one hunk");
+
+	// read a unit at a time, falling back to whole hunks if the CHD doesn't say
+	uint32_t unit_bytes = input_chd.unit_bytes() ? input_chd.unit_bytes() : input_chd.hunk_bytes();
+	std::vector<uint8_t> buffer(unit_bytes);
+
+	// output options
+	printf("Input file:   %s\n", params.find(OPTION_INPUT)->second->c_str());
+	printf("Input bytes:  %s\n", big_int_string(input_end - input_start).c_str());
+	printf("Unit size:    %s\n", big_int_string(unit_bytes).c_str());
+	printf("Read-ahead:   %u hunks\n", readahead);
+
+	// time one pass over the range
+	auto const run_pass = [&] (const char *name) -> double
+	{
+		auto const start = std::chrono::steady_clock::now();
+		for (uint64_t offset = input_start; offset < input_end; )
+		{
+			progress(false, "%s, %.1f%% complete... \r", name, 100.0 * double(offset - input_start) / double(input_end - input_start));
+
+			uint32_t bytes_to_read = (std::min<uint64_t>)(buffer.size(), input_end - offset);
+			std::error_condition err = input_chd.read_bytes(offset, &buffer[0], bytes_to_read);
+			if (err)
+				report_error(1, "Error reading CHD file (%s): %s", *params.find(OPTION_INPUT)->second, err.message());
+			offset += bytes_to_read;
+		}
+		double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		double const rate = (seconds > 0.0) ? (double(input_end - input_start) / seconds / 1048576.0) : 0.0;
+		printf("%-30s %8.3f seconds, %8.1f MB/s\n", name, seconds, rate);
+		return seconds;
+	};
+
+	// the first pass also warms up the host's file cache for the second
+	double const plain = run_pass("Reading without read-ahead");
+	std::error_condition err = input_chd.set_readahead(readahead, readahead * 4);
+	if (err)
+		report_error(1, "Error enabling read-ahead: %s", err.message());
+	double const ahead = run_pass("Reading with read-ahead");
+	chd_file::readahead_stats const stats = input_chd.readahead_statistics();
+	input_chd.set_readahead(0, 0);
+
+	// report how the cache did
+	uint64_t const reads = stats.hits + stats.misses;
+	printf("Speedup:      %.2fx\n", (ahead > 0.0) ? (plain / ahead) : 0.0);
+	printf("Cache hits:   %s (%.1f%%), %s had to wait\n",
+			big_int_string(stats.hits).c_str(),
+			reads ? (100.0 * double(stats.hits) / double(reads)) : 0.0,
+			big_int_string(stats.waits).c_str());
+	printf("Cache misses: %s\n", big_int_string(stats.misses).c_str());
+	printf("Prefetched:   %s hunks, %s wasted\n", big_int_string(stats.prefetched).c_str(), big_int_string(stats.wasted).c_str());
+	printf("Parent reads: %s\n", big_int_string(stats.parentreads).c_str());
+}
+
+
 //-------------------------------------------------
 //  do_create_raw - create a new compressed raw
 //  image from a raw file
@@ -0,0 +1,24 @@
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <algorithm>
+typedef uint8_t u8; typedef uint16_t u16; typedef uint32_t u32;
+[[noreturn]] static void fatalerror(const char *fmt, ...) { printf("%s", fmt); exit(1); }
+#include "rspvec.h"
+struct rsp_device {
+	union VECTOR_REG { uint64_t d[2]; uint32_t l[4]; uint16_t w[8]; int16_t s[8]; uint8_t b[16]; };
+	uint16_t SATURATE_ACCUM(int accum, int slice, uint16_t negative, uint16_t positive);
+	uint16_t          m_vres[8];
+	alignas(16) VECTOR_REG m_v[32];
+	alignas(16) VECTOR_REG m_accum[4];
+	uint8_t m_vcarry, m_vcompare, m_vclip1, m_vzero, m_vclip2;
+	int32_t m_reciprocal_res; uint32_t m_reciprocal_high; int32_t m_dp_allowed;
+	void handle_vector_ops(uint32_t op);
+	bool handle_vector_ops_simd(uint32_t op);
+	void verify_vector_ops_simd();
+	void unimplemented_opcode(uint32_t) {}
+	void logerror(...) {}
+};
+int main() { static rsp_device d; d.verify_vector_ops_simd(); printf("PASS\n"); return 0; }